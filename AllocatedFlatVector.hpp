@@ -18,12 +18,15 @@ namespace kF::Core
      * @tparam AllocateFunc Allocator
      * @tparam DeallocateFunc Deallocator
      * @tparam Range Range of container
+     * @tparam CustomHeaderType Custom type stored in header
+     * @tparam ReallocateFunc Optional in place reallocator
+     * @tparam GrowthPolicy Capacity growth policy
      */
-    template<typename Type, auto AllocateFunc, auto DeallocateFunc, std::integral Range = std::size_t, typename CustomHeaderType = Internal::NoCustomHeaderType>
-    using AllocatedFlatVector = Internal::VectorDetails<Internal::AllocatedFlatVectorBase<Type, Range, AllocateFunc, DeallocateFunc, CustomHeaderType>, Type, Range>;
+    template<typename Type, auto AllocateFunc, auto DeallocateFunc, std::integral Range = std::size_t, typename CustomHeaderType = Internal::NoCustomHeaderType, auto ReallocateFunc = nullptr, typename GrowthPolicy = DefaultGrowthPolicy>
+    using AllocatedFlatVector = Internal::VectorDetails<Internal::AllocatedFlatVectorBase<Type, Range, AllocateFunc, DeallocateFunc, CustomHeaderType, ReallocateFunc>, Type, Range, false, GrowthPolicy>;
 
     /** @brief 8 bytes vector using signed char with a reduced range
      * The vector must take an allocator and a deallocator functor */
-    template<typename Type, auto AllocateFunc, auto DeallocateFunc, typename CustomHeaderType = Internal::NoCustomHeaderType>
-    using AllocatedTinyFlatVector = AllocatedFlatVector<Type, AllocateFunc, DeallocateFunc, std::uint32_t, CustomHeaderType>;
+    template<typename Type, auto AllocateFunc, auto DeallocateFunc, typename CustomHeaderType = Internal::NoCustomHeaderType, auto ReallocateFunc = nullptr, typename GrowthPolicy = DefaultGrowthPolicy>
+    using AllocatedTinyFlatVector = AllocatedFlatVector<Type, AllocateFunc, DeallocateFunc, std::uint32_t, CustomHeaderType, ReallocateFunc, GrowthPolicy>;
 }
@@ -9,12 +9,12 @@
 
 namespace kF::Core::Internal
 {
-    template<typename Type, std::integral Range, auto AllocateFunc, auto DeallocateFunc, typename CustomHeaderType>
+    template<typename Type, std::integral Range, auto AllocateFunc, auto DeallocateFunc, typename CustomHeaderType, auto ReallocateFunc = nullptr>
     class AllocatedFlatVectorBase;
 }
 
 /** @brief Base implementation of a vector with size and capacity allocated with data */
-template<typename Type, std::integral Range, auto AllocateFunc, auto DeallocateFunc, typename CustomHeaderType>
+template<typename Type, std::integral Range, auto AllocateFunc, auto DeallocateFunc, typename CustomHeaderType, auto ReallocateFunc>
 class kF::Core::Internal::AllocatedFlatVectorBase : public FlatVectorBase<Type, Range, CustomHeaderType>
 {
 protected:
@@ -37,4 +37,23 @@ protected:
             ptr->customType.~CustomHeaderType();
         DeallocateFunc(ptr, sizeof(Header) + sizeof(Type) * capacity, alignof(Header));
     }
+
+    /** @brief Resize a buffer with its header in place when possible, only available with a ReallocateFunc
+     *  @return nullptr if the buffer could not be resized, in which case it is left untouched */
+    [[nodiscard]] Type *reallocate(Type * const data, const Range currentCapacity, const Range capacity) noexcept
+        requires (!std::is_null_pointer_v<decltype(ReallocateFunc)> && IsTriviallyRelocatable<CustomHeaderType>::Value)
+    {
+        const auto ptr = reinterpret_cast<Header *>(ReallocateFunc(reinterpret_cast<Header *>(data) - 1,
+                sizeof(Header) + sizeof(Type) * currentCapacity, sizeof(Header) + sizeof(Type) * capacity, alignof(Header)));
+        if (!ptr) [[unlikely]]
+            return nullptr;
+        return reinterpret_cast<Type *>(ptr + 1);
+    }
+};
+
+/** @brief AllocatedFlatVectorBase only owns a heap pointer */
+template<typename Type, std::integral Range, auto AllocateFunc, auto DeallocateFunc, typename CustomHeaderType, auto ReallocateFunc>
+struct kF::Core::IsTriviallyRelocatable<kF::Core::Internal::AllocatedFlatVectorBase<Type, Range, AllocateFunc, DeallocateFunc, CustomHeaderType, ReallocateFunc>>
+{
+    static constexpr bool Value = true;
 };
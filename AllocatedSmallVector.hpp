@@ -19,12 +19,13 @@ namespace kF::Core
      * @tparam AllocateFunc Allocator
      * @tparam DeallocateFunc Deallocator
      * @tparam Range Range of container
+     * @tparam GrowthPolicy Capacity growth policy
      */
-    template<typename Type, std::size_t OptimizedCapacity, auto AllocateFunc, auto DeallocateFunc, std::integral Range = std::size_t>
-    using AllocatedSmallVector = Internal::VectorDetails<Internal::AllocatedSmallVectorBase<Type, OptimizedCapacity, AllocateFunc, DeallocateFunc, Range>, Type, Range, true>;
+    template<typename Type, std::size_t OptimizedCapacity, auto AllocateFunc, auto DeallocateFunc, std::integral Range = std::size_t, typename GrowthPolicy = DefaultGrowthPolicy>
+    using AllocatedSmallVector = Internal::VectorDetails<Internal::AllocatedSmallVectorBase<Type, OptimizedCapacity, AllocateFunc, DeallocateFunc, Range>, Type, Range, true, GrowthPolicy>;
 
     /** @brief Small optimized vector with a reduced range
      * The vector must take an allocator and a deallocator functor */
-    template<typename Type, std::size_t OptimizedCapacity, auto AllocateFunc, auto DeallocateFunc>
-    using AllocatedTinySmallVector = AllocatedSmallVector<Type, OptimizedCapacity, AllocateFunc, DeallocateFunc, std::uint32_t>;
+    template<typename Type, std::size_t OptimizedCapacity, auto AllocateFunc, auto DeallocateFunc, typename GrowthPolicy = DefaultGrowthPolicy>
+    using AllocatedTinySmallVector = AllocatedSmallVector<Type, OptimizedCapacity, AllocateFunc, DeallocateFunc, std::uint32_t, GrowthPolicy>;
 }
@@ -34,3 +34,10 @@ protected:
             DeallocateFunc(data, sizeof(Type) * capacity, alignof(Type));
     }
 };
+
+/** @brief AllocatedSmallVectorBase may point to its own cache */
+template<typename Type, std::size_t OptimizedCapacity, auto AllocateFunc, auto DeallocateFunc, std::integral Range>
+struct kF::Core::IsTriviallyRelocatable<kF::Core::Internal::AllocatedSmallVectorBase<Type, OptimizedCapacity, AllocateFunc, DeallocateFunc, Range>>
+{
+    static constexpr bool Value = false;
+};
@@ -5,7 +5,7 @@
 
 #pragma once
 
-#include "VectorDetails.hpp"
+#include "StringDetails.hpp"
 #include "AllocatedVector.hpp"
 
 namespace kF::Core
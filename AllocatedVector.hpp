@@ -19,12 +19,14 @@ namespace kF::Core
      * @tparam AllocateFunc Allocator
      * @tparam DeallocateFunc Deallocator
      * @tparam Range Range of container
+     * @tparam ReallocateFunc Optional in place reallocator
+     * @tparam GrowthPolicy Capacity growth policy
      */
-    template<typename Type, auto AllocateFunc, auto DeallocateFunc, std::integral Range = std::size_t>
-    using AllocatedVector = Internal::VectorDetails<Internal::AllocatedVectorBase<Type, Range, AllocateFunc, DeallocateFunc>, Type, Range>;
+    template<typename Type, auto AllocateFunc, auto DeallocateFunc, std::integral Range = std::size_t, auto ReallocateFunc = nullptr, typename GrowthPolicy = DefaultGrowthPolicy>
+    using AllocatedVector = Internal::VectorDetails<Internal::AllocatedVectorBase<Type, Range, AllocateFunc, DeallocateFunc, ReallocateFunc>, Type, Range, false, GrowthPolicy>;
 
     /** @brief 16 bytes vector with a reduced range
      * The vector must take an allocator and a deallocator functor */
-    template<typename Type, auto AllocateFunc, auto DeallocateFunc>
-    using AllocatedTinyVector = AllocatedVector<Type, AllocateFunc, DeallocateFunc, std::uint32_t>;
+    template<typename Type, auto AllocateFunc, auto DeallocateFunc, auto ReallocateFunc = nullptr, typename GrowthPolicy = DefaultGrowthPolicy>
+    using AllocatedTinyVector = AllocatedVector<Type, AllocateFunc, DeallocateFunc, std::uint32_t, ReallocateFunc, GrowthPolicy>;
 }
\ No newline at end of file
@@ -9,12 +9,12 @@
 
 namespace kF::Core::Internal
 {
-    template<typename Type, std::integral Range, auto AllocateFunc, auto DeallocateFunc>
+    template<typename Type, std::integral Range, auto AllocateFunc, auto DeallocateFunc, auto ReallocateFunc = nullptr>
     class AllocatedVectorBase;
 }
 
 /** @brief Base implementation of a vector with size and capacity cached */
-template<typename Type, std::integral Range, auto AllocateFunc, auto DeallocateFunc>
+template<typename Type, std::integral Range, auto AllocateFunc, auto DeallocateFunc, auto ReallocateFunc>
 class kF::Core::Internal::AllocatedVectorBase : public VectorBase<Type, Range>
 {
 protected:
@@ -25,4 +25,17 @@ protected:
     /** @brief Deallocates a buffer */
     void deallocate(Type * const data, const Range capacity) noexcept
         { DeallocateFunc(data, sizeof(Type) * capacity, alignof(Type)); }
+
+    /** @brief Resize a buffer in place when possible, only available with a ReallocateFunc
+     *  @return nullptr if the buffer could not be resized, in which case it is left untouched */
+    [[nodiscard]] Type *reallocate(Type * const data, const Range currentCapacity, const Range capacity) noexcept
+        requires (!std::is_null_pointer_v<decltype(ReallocateFunc)>)
+        { return reinterpret_cast<Type *>(ReallocateFunc(data, sizeof(Type) * currentCapacity, sizeof(Type) * capacity, alignof(Type))); }
+};
+
+/** @brief AllocatedVectorBase only owns a heap pointer */
+template<typename Type, std::integral Range, auto AllocateFunc, auto DeallocateFunc, auto ReallocateFunc>
+struct kF::Core::IsTriviallyRelocatable<kF::Core::Internal::AllocatedVectorBase<Type, Range, AllocateFunc, DeallocateFunc, ReallocateFunc>>
+{
+    static constexpr bool Value = true;
 };
@@ -0,0 +1,132 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Allocation policies of large arrays
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <bit>
+
+#if defined(__linux__)
+# include <sys/mman.h>
+# include <sys/syscall.h>
+# include <unistd.h>
+#endif
+
+#include "Utils.hpp"
+
+namespace kF::Core
+{
+    /**
+     * @brief Allocation policies decide where the buffer of a large array lives
+     *  A policy exposes two static functions:
+     *   - 'Allocate(bytes, alignment)' returning a buffer or nullptr on failure
+     *   - 'Deallocate(data, bytes, alignment)' releasing a buffer with the same 'bytes' and 'alignment' used to allocate it
+     */
+
+    /** @brief Size of a huge page */
+    constexpr std::size_t HugePageSize = 2ul * 1024 * 1024;
+
+    /** @brief Huge page usage of mapped allocations */
+    enum class HugePageMode
+    {
+        None,           // Regular pages
+        Transparent,    // Huge page aligned mapping advised with 'MADV_HUGEPAGE'
+        Explicit        // Pre-reserved huge pages ('MAP_HUGETLB'), falls back to 'Transparent' when none are available
+    };
+
+    /** @brief NUMA placement of mapped allocations */
+    enum class NumaMode
+    {
+        FirstTouch,     // Pages land on the node of the thread touching them first
+        Interleave,     // Pages are interleaved over every allowed node
+        Node            // Pages are placed on a preferred node, falling back to others when it is full
+    };
+
+    /** @brief Aligned heap allocation, default policy */
+    struct DefaultAllocationPolicy;
+
+    /** @brief Heap allocation aligned to a SIMD width, rounded up to a multiple of that width with zeroed padding
+     *  Full width aligned loads never read past the allocation */
+    template<std::size_t Width = CacheLineSize>
+    struct SimdAllocationPolicy;
+
+    /** @brief Allocation suited to AVX2 loads */
+    using Avx2AllocationPolicy = SimdAllocationPolicy<32>;
+
+    /** @brief Allocation suited to AVX-512 loads */
+    using Avx512AllocationPolicy = SimdAllocationPolicy<64>;
+
+    /** @brief Minimum alignment of the buffers returned by an allocation policy, given by its optional 'Alignment' member */
+    template<typename AllocationPolicy>
+    constexpr std::size_t AllocationPolicyAlignment = 1ul;
+    template<typename AllocationPolicy> requires requires { AllocationPolicy::Alignment; }
+    constexpr std::size_t AllocationPolicyAlignment<AllocationPolicy> = AllocationPolicy::Alignment;
+
+    /** @brief Anonymous memory mapping with huge pages and NUMA placement hints, other systems than linux use the default policy */
+    template<HugePageMode HugePages = HugePageMode::Transparent, NumaMode Numa = NumaMode::FirstTouch, unsigned int PreferredNode = 0u>
+    struct MappedAllocationPolicy;
+
+    /** @brief Mapping advised to use transparent huge pages */
+    using TransparentHugePageAllocationPolicy = MappedAllocationPolicy<HugePageMode::Transparent>;
+
+    /** @brief Mapping using explicit huge pages when available */
+    using HugePageAllocationPolicy = MappedAllocationPolicy<HugePageMode::Explicit>;
+
+    /** @brief Transparent huge page mapping interleaved over every NUMA node */
+    using NumaInterleaveAllocationPolicy = MappedAllocationPolicy<HugePageMode::Transparent, NumaMode::Interleave>;
+
+    /** @brief Transparent huge page mapping placed on a preferred NUMA node */
+    template<unsigned int PreferredNode>
+    using NumaNodeAllocationPolicy = MappedAllocationPolicy<HugePageMode::Transparent, NumaMode::Node, PreferredNode>;
+}
+
+struct kF::Core::DefaultAllocationPolicy
+{
+    /** @brief Allocate a buffer */
+    [[nodiscard]] static void *Allocate(const std::size_t bytes, const std::size_t alignment) noexcept
+        { return Utils::AlignedAlloc(bytes, alignment); }
+
+    /** @brief Deallocate a buffer */
+    static void Deallocate(void * const data, const std::size_t, const std::size_t) noexcept
+        { Utils::AlignedFree(data); }
+};
+
+template<std::size_t Width>
+struct kF::Core::SimdAllocationPolicy
+{
+    static_assert(std::has_single_bit(Width), "SimdAllocationPolicy: Width must be a power of 2");
+
+    /** @brief Alignment of every buffer */
+    static constexpr std::size_t Alignment = Width;
+
+    /** @brief Allocate a buffer */
+    [[nodiscard]] static void *Allocate(const std::size_t bytes, const std::size_t alignment) noexcept;
+
+    /** @brief Deallocate a buffer */
+    static void Deallocate(void * const data, const std::size_t, const std::size_t) noexcept
+        { Utils::AlignedFree(data); }
+};
+
+template<kF::Core::HugePageMode HugePages, kF::Core::NumaMode Numa, unsigned int PreferredNode>
+struct kF::Core::MappedAllocationPolicy
+{
+    /** @brief Allocate a buffer */
+    [[nodiscard]] static void *Allocate(const std::size_t bytes, const std::size_t alignment) noexcept;
+
+    /** @brief Deallocate a buffer */
+    static void Deallocate(void * const data, const std::size_t bytes, const std::size_t alignment) noexcept;
+
+private:
+    /** @brief Get the granularity of a mapping */
+    [[nodiscard]] static std::size_t Granularity(const std::size_t alignment) noexcept;
+
+    /** @brief Map 'bytes' aligned to 'alignment' */
+    [[nodiscard]] static void *MapAligned(const std::size_t bytes, const std::size_t alignment) noexcept;
+
+    /** @brief Apply the NUMA policy to a mapping */
+    static void ApplyNumaPolicy(void * const data, const std::size_t bytes) noexcept;
+};
+
+#include "AllocationPolicy.ipp"
@@ -0,0 +1,121 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Allocation policies of large arrays
+ */
+
+template<std::size_t Width>
+inline void *kF::Core::SimdAllocationPolicy<Width>::Allocate(const std::size_t bytes, const std::size_t alignment) noexcept
+{
+    const auto padded = (bytes + Width - 1) & ~(Width - 1);
+    const auto data = Utils::AlignedAlloc<std::byte>(padded, std::max(alignment, Width));
+
+    if (data) [[likely]]
+        std::memset(data + bytes, 0, padded - bytes);
+    return data;
+}
+
+template<kF::Core::HugePageMode HugePages, kF::Core::NumaMode Numa, unsigned int PreferredNode>
+inline void *kF::Core::MappedAllocationPolicy<HugePages, Numa, PreferredNode>::Allocate(const std::size_t bytes, const std::size_t alignment) noexcept
+{
+#if defined(__linux__)
+    const auto granularity = Granularity(alignment);
+    const auto length = (bytes + granularity - 1) & ~(granularity - 1);
+    void *data = nullptr;
+
+    if constexpr (HugePages == HugePageMode::Explicit) {
+        data = ::mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+        if (data == MAP_FAILED) [[unlikely]]
+            data = nullptr;
+    }
+    if (!data) {
+        data = MapAligned(length, granularity);
+        if (!data) [[unlikely]]
+            return nullptr;
+        if constexpr (HugePages != HugePageMode::None)
+            ::madvise(data, length, MADV_HUGEPAGE);
+    }
+    ApplyNumaPolicy(data, length);
+    return data;
+#else
+    return DefaultAllocationPolicy::Allocate(bytes, alignment);
+#endif
+}
+
+template<kF::Core::HugePageMode HugePages, kF::Core::NumaMode Numa, unsigned int PreferredNode>
+inline void kF::Core::MappedAllocationPolicy<HugePages, Numa, PreferredNode>::Deallocate(void * const data, const std::size_t bytes, const std::size_t alignment) noexcept
+{
+#if defined(__linux__)
+    const auto granularity = Granularity(alignment);
+    ::munmap(data, (bytes + granularity - 1) & ~(granularity - 1));
+#else
+    DefaultAllocationPolicy::Deallocate(data, bytes, alignment);
+#endif
+}
+
+template<kF::Core::HugePageMode HugePages, kF::Core::NumaMode Numa, unsigned int PreferredNode>
+inline std::size_t kF::Core::MappedAllocationPolicy<HugePages, Numa, PreferredNode>::Granularity(const std::size_t alignment) noexcept
+{
+#if defined(__linux__)
+    static const auto PageSize = static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+    const auto granularity = std::max(HugePages == HugePageMode::None ? PageSize : std::max(PageSize, HugePageSize), alignment);
+    return std::bit_ceil(granularity);
+#else
+    return alignment;
+#endif
+}
+
+template<kF::Core::HugePageMode HugePages, kF::Core::NumaMode Numa, unsigned int PreferredNode>
+inline void *kF::Core::MappedAllocationPolicy<HugePages, Numa, PreferredNode>::MapAligned(const std::size_t bytes, const std::size_t alignment) noexcept
+{
+#if defined(__linux__)
+    // Over-map by 'alignment' then trim both ends, huge pages are only used by the kernel on aligned ranges
+    const auto raw = ::mmap(nullptr, bytes + alignment, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (raw == MAP_FAILED) [[unlikely]]
+        return nullptr;
+    const auto begin = reinterpret_cast<std::uintptr_t>(raw);
+    const auto alignedBegin = (begin + alignment - 1) & ~(alignment - 1);
+    if (const auto head = alignedBegin - begin; head)
+        ::munmap(raw, head);
+    if (const auto tail = alignment - (alignedBegin - begin); tail)
+        ::munmap(reinterpret_cast<void *>(alignedBegin + bytes), tail);
+    return reinterpret_cast<void *>(alignedBegin);
+#else
+    static_cast<void>(bytes);
+    static_cast<void>(alignment);
+    return nullptr;
+#endif
+}
+
+template<kF::Core::HugePageMode HugePages, kF::Core::NumaMode Numa, unsigned int PreferredNode>
+inline void kF::Core::MappedAllocationPolicy<HugePages, Numa, PreferredNode>::ApplyNumaPolicy(
+        [[maybe_unused]] void * const data, [[maybe_unused]] const std::size_t bytes) noexcept
+{
+#if defined(__linux__) && defined(SYS_mbind) && defined(SYS_get_mempolicy)
+    // Policies of <numaif.h>, redefined to avoid a dependency over libnuma
+    constexpr int PolicyPreferred = 1;
+    constexpr int PolicyInterleave = 3;
+    constexpr unsigned long FlagMemsAllowed = 1ul << 2;
+    constexpr std::size_t MaxNodes = 1024;
+    constexpr std::size_t BitsPerMask = sizeof(unsigned long) * 8;
+
+    if constexpr (Numa == NumaMode::FirstTouch) {
+        return;
+    } else {
+        unsigned long nodes[MaxNodes / BitsPerMask] {};
+        int policy;
+
+        if constexpr (Numa == NumaMode::Interleave) {
+            int mode = 0;
+            if (::syscall(SYS_get_mempolicy, &mode, nodes, MaxNodes, nullptr, FlagMemsAllowed)) [[unlikely]]
+                return;
+            policy = PolicyInterleave;
+        } else {
+            static_assert(PreferredNode < MaxNodes, "MappedAllocationPolicy: PreferredNode out of range");
+            nodes[PreferredNode / BitsPerMask] = 1ul << (PreferredNode % BitsPerMask);
+            policy = PolicyPreferred;
+        }
+        // Placement is only a hint, a failure leaves the first touch policy
+        ::syscall(SYS_mbind, data, bytes, policy, nodes, MaxNodes + 1, 0u);
+    }
+#endif
+}
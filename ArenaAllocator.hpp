@@ -0,0 +1,150 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Monotonic arena allocator
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <new>
+
+#include "Utils.hpp"
+
+namespace kF::Core
+{
+    class ArenaAllocator;
+
+    /** @brief Allocate function bound to a static arena, usable as AllocateFunc of Allocated containers */
+    template<ArenaAllocator &Arena>
+    [[nodiscard]] void *ArenaAllocate(const std::size_t bytes, const std::size_t alignment) noexcept;
+
+    /** @brief Deallocate function bound to a static arena, usable as DeallocateFunc of Allocated containers */
+    template<ArenaAllocator &Arena>
+    void ArenaDeallocate(void * const data, const std::size_t bytes, const std::size_t alignment) noexcept;
+
+    /** @brief Reallocate function bound to a static arena, usable as ReallocateFunc of Allocated containers */
+    template<ArenaAllocator &Arena>
+    [[nodiscard]] void *ArenaReallocate(void * const data, const std::size_t bytes, const std::size_t newBytes, const std::size_t alignment) noexcept;
+}
+
+/**
+ * @brief Monotonic allocator that serves allocations by bumping a pointer inside large blocks
+ *  Memory is never given back one allocation at a time (except the last one), it is reclaimed in O(1)
+ *  by rewinding to a marker or by resetting the whole arena. Blocks are kept for reuse until 'release' is called.
+ *  Containers using the arena must be destroyed before rewinding past their allocations.
+ */
+class kF::Core::ArenaAllocator
+{
+public:
+    /** @brief Default size of a block */
+    static constexpr std::size_t DefaultBlockSize = 64 * 1024;
+
+    /** @brief Header of a memory block, its data directly follows */
+    struct alignas_cacheline Block
+    {
+        Block *next { nullptr };
+        std::size_t capacity { 0 };
+    };
+
+    /** @brief Position in the arena that can be rewinded to */
+    struct Marker
+    {
+        Block *block { nullptr };
+        std::size_t head { 0 };
+    };
+
+    /** @brief Rewind the arena to the position it had at construction when destroyed */
+    class ScopedMarker
+    {
+    public:
+        /** @brief Mark the arena */
+        ScopedMarker(ArenaAllocator &arena) noexcept : _arena(arena), _marker(arena.mark()) {}
+
+        /** @brief Rewind the arena */
+        ~ScopedMarker(void) noexcept { _arena.rewind(_marker); }
+
+        /** @brief Get the marker */
+        [[nodiscard]] const Marker &marker(void) const noexcept { return _marker; }
+
+    private:
+        ArenaAllocator &_arena;
+        Marker _marker;
+
+        /** @brief Copy and move constructors disabled */
+        ScopedMarker(const ScopedMarker &other) = delete;
+        ScopedMarker(ScopedMarker &&other) = delete;
+    };
+
+
+    /** @brief Get the arena of the current thread */
+    [[nodiscard]] static ArenaAllocator &ThreadLocal(void) noexcept;
+
+    /** @brief Allocate using the arena of the current thread */
+    [[nodiscard]] static void *ThreadLocalAllocate(const std::size_t bytes, const std::size_t alignment) noexcept
+        { return ThreadLocal().allocate(bytes, alignment); }
+
+    /** @brief Deallocate using the arena of the current thread */
+    static void ThreadLocalDeallocate(void * const data, const std::size_t bytes, const std::size_t alignment) noexcept
+        { ThreadLocal().deallocate(data, bytes, alignment); }
+
+    /** @brief Reallocate in place using the arena of the current thread */
+    [[nodiscard]] static void *ThreadLocalReallocate(void * const data, const std::size_t bytes, const std::size_t newBytes, const std::size_t alignment) noexcept
+        { return ThreadLocal().reallocate(data, bytes, newBytes, alignment); }
+
+
+    /** @brief Construct the arena without allocating any block */
+    ArenaAllocator(const std::size_t blockSize = DefaultBlockSize) noexcept : _blockSize(blockSize) {}
+
+    /** @brief Release all blocks */
+    ~ArenaAllocator(void) noexcept { release(); }
+
+
+    /** @brief Allocate memory by bumping the head of the current block
+     *  @return nullptr if a new block could not be allocated */
+    [[nodiscard]] void *allocate(const std::size_t bytes, const std::size_t alignment) noexcept;
+
+    /** @brief Deallocate memory, only reclaimed if it is the last allocation */
+    void deallocate(void * const data, const std::size_t bytes, const std::size_t alignment) noexcept;
+
+    /** @brief Resize memory in place, only possible if it is the last allocation and the current block has room
+     *  @return nullptr if the allocation could not be resized, in which case it is left untouched */
+    [[nodiscard]] void *reallocate(void * const data, const std::size_t bytes, const std::size_t newBytes, const std::size_t alignment) noexcept;
+
+
+    /** @brief Get a marker of the current position */
+    [[nodiscard]] Marker mark(void) const noexcept { return Marker { _block, _head }; }
+
+    /** @brief Rewind to a previous marker, all allocations made after the marker are invalidated */
+    void rewind(const Marker &marker) noexcept { _block = marker.block; _head = marker.head; }
+
+    /** @brief Rewind to the beginning of the arena, keeping its blocks */
+    void reset(void) noexcept { rewind(Marker {}); }
+
+    /** @brief Release every block of the arena */
+    void release(void) noexcept;
+
+
+    /** @brief Get the default block size */
+    [[nodiscard]] std::size_t blockSize(void) const noexcept { return _blockSize; }
+
+    /** @brief Get the total capacity of all blocks owned by the arena */
+    [[nodiscard]] std::size_t reservedBytes(void) const noexcept;
+
+private:
+    Block *_first { nullptr };
+    Block *_block { nullptr };
+    std::size_t _head { 0 };
+    std::size_t _blockSize { DefaultBlockSize };
+
+    /** @brief Slow path of the allocation, select or create a block that fits the request */
+    [[nodiscard]] void *allocateSlow(const std::size_t bytes, const std::size_t alignment) noexcept;
+
+    /** @brief Try to allocate inside the current block */
+    [[nodiscard]] void *tryAllocate(const std::size_t bytes, const std::size_t alignment) noexcept;
+
+    /** @brief Copy and move constructors disabled */
+    ArenaAllocator(const ArenaAllocator &other) = delete;
+    ArenaAllocator(ArenaAllocator &&other) = delete;
+};
+
+#include "ArenaAllocator.ipp"
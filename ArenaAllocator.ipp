@@ -0,0 +1,120 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Monotonic arena allocator
+ */
+
+template<kF::Core::ArenaAllocator &Arena>
+inline void *kF::Core::ArenaAllocate(const std::size_t bytes, const std::size_t alignment) noexcept
+{
+    return Arena.allocate(bytes, alignment);
+}
+
+template<kF::Core::ArenaAllocator &Arena>
+inline void kF::Core::ArenaDeallocate(void * const data, const std::size_t bytes, const std::size_t alignment) noexcept
+{
+    Arena.deallocate(data, bytes, alignment);
+}
+
+template<kF::Core::ArenaAllocator &Arena>
+inline void *kF::Core::ArenaReallocate(void * const data, const std::size_t bytes, const std::size_t newBytes, const std::size_t alignment) noexcept
+{
+    return Arena.reallocate(data, bytes, newBytes, alignment);
+}
+
+inline kF::Core::ArenaAllocator &kF::Core::ArenaAllocator::ThreadLocal(void) noexcept
+{
+    static thread_local ArenaAllocator arena;
+
+    return arena;
+}
+
+inline void *kF::Core::ArenaAllocator::allocate(const std::size_t bytes, const std::size_t alignment) noexcept
+{
+    if (const auto data = tryAllocate(bytes, alignment); data) [[likely]]
+        return data;
+    else
+        return allocateSlow(bytes, alignment);
+}
+
+inline void *kF::Core::ArenaAllocator::tryAllocate(const std::size_t bytes, const std::size_t alignment) noexcept
+{
+    if (!_block) [[unlikely]]
+        return nullptr;
+    const auto base = reinterpret_cast<std::uintptr_t>(_block + 1);
+    const auto begin = (base + _head + alignment - 1) & ~(alignment - 1);
+    const auto end = begin + bytes;
+
+    if (end > base + _block->capacity) [[unlikely]]
+        return nullptr;
+    _head = end - base;
+    return reinterpret_cast<void *>(begin);
+}
+
+inline void *kF::Core::ArenaAllocator::allocateSlow(const std::size_t bytes, const std::size_t alignment) noexcept
+{
+    // Block data is cacheline aligned, only stricter alignments need padding
+    const auto required = bytes + (alignment > alignof(Block) ? alignment - alignof(Block) : 0);
+    auto next = _block ? _block->next : _first;
+
+    if (!next || next->capacity < required) {
+        const auto capacity = std::max(_blockSize, required);
+        const auto block = Utils::AlignedAlloc<alignof(Block), Block>(sizeof(Block) + capacity);
+        if (!block) [[unlikely]]
+            return nullptr;
+        new (block) Block { next, capacity };
+        if (_block)
+            _block->next = block;
+        else
+            _first = block;
+        next = block;
+    }
+    _block = next;
+    _head = 0;
+    return tryAllocate(bytes, alignment);
+}
+
+inline void kF::Core::ArenaAllocator::deallocate(void * const data, const std::size_t bytes, const std::size_t) noexcept
+{
+    if (!_block) [[unlikely]]
+        return;
+    const auto base = reinterpret_cast<std::byte *>(_block + 1);
+    const auto ptr = reinterpret_cast<std::byte *>(data);
+
+    if (ptr + bytes == base + _head && ptr >= base)
+        _head = static_cast<std::size_t>(ptr - base);
+}
+
+inline void *kF::Core::ArenaAllocator::reallocate(void * const data, const std::size_t bytes, const std::size_t newBytes, const std::size_t) noexcept
+{
+    if (!_block) [[unlikely]]
+        return nullptr;
+    const auto base = reinterpret_cast<std::byte *>(_block + 1);
+    const auto ptr = reinterpret_cast<std::byte *>(data);
+    const auto offset = static_cast<std::size_t>(ptr - base);
+
+    if (ptr + bytes != base + _head || ptr < base || offset + newBytes > _block->capacity)
+        return nullptr;
+    _head = offset + newBytes;
+    return data;
+}
+
+inline void kF::Core::ArenaAllocator::release(void) noexcept
+{
+    for (auto block = _first; block;) {
+        const auto next = block->next;
+        Utils::AlignedFree(block);
+        block = next;
+    }
+    _first = nullptr;
+    _block = nullptr;
+    _head = 0;
+}
+
+inline std::size_t kF::Core::ArenaAllocator::reservedBytes(void) const noexcept
+{
+    std::size_t total = 0;
+
+    for (auto block = _first; block; block = block->next)
+        total += block->capacity;
+    return total;
+}
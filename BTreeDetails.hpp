@@ -0,0 +1,474 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: BTreeDetails
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <initializer_list>
+#include <stdexcept>
+
+#include "Assert.hpp"
+#include "Utils.hpp"
+#include "SimdSearch.hpp"
+
+namespace kF::Core
+{
+    /** @brief Default byte size of a B+tree node, 4 cache lines */
+    constexpr std::size_t BTreeDefaultNodeSize = 4ul * CacheLineSize;
+}
+
+namespace kF::Core::Internal
+{
+    /** @brief Key type usable for B+tree lookups, any type the comparator accepts on both sides */
+    template<typename LookupKey, typename Key, typename Compare>
+    concept BTreeLookupKey = std::predicate<const Compare &, const Key &, const LookupKey &>
+        && std::predicate<const Compare &, const LookupKey &, const Key &>;
+
+    /** @brief Value column of a leaf, empty for sets */
+    template<typename Value, std::size_t Capacity>
+    struct BTreeValues
+    {
+        alignas(Value) std::byte storage[sizeof(Value) * Capacity];
+
+        [[nodiscard]] Value *data(void) noexcept { return reinterpret_cast<Value *>(storage); }
+    };
+
+    template<std::size_t Capacity>
+    struct BTreeValues<void, Capacity>
+    {};
+
+    template<typename Key, typename Value, std::integral Range, typename Compare, auto AllocateFunc, auto DeallocateFunc, std::size_t NodeSize>
+    class BTreeDetails;
+}
+
+/** @brief Ordered B+tree of keys, with an optional value per key stored in a separate column of each leaf
+ *  Nodes span a few cache lines, leaves are linked for iteration and inserting or erasing only moves elements within a node
+ *  Without value (Value = void), the tree keeps equivalent keys like a sorted vector, with a value keys are unique
+ *  Internal nodes hold copies of keys, any insertion or removal invalidates iterators and references */
+template<typename Key, typename Value, std::integral Range, typename Compare, auto AllocateFunc, auto DeallocateFunc, std::size_t NodeSize>
+class kF::Core::Internal::BTreeDetails
+{
+    struct NodeHeader;
+    struct LeafNode;
+    struct InternalNode;
+
+public:
+    /** @brief True if each key has a value */
+    static constexpr bool IsMap = !std::is_void_v<Value>;
+
+    /** @brief Byte size of a value */
+    static constexpr std::size_t ValueSize = ConstexprTernary(IsMap, sizeof(Value), 0ul);
+
+    /** @brief Count of elements per leaf */
+    static constexpr std::size_t LeafCapacity = std::max((NodeSize - 4ul * sizeof(void *)) / (sizeof(Key) + ValueSize), 4ul);
+
+    /** @brief Count of keys per internal node */
+    static constexpr std::size_t InternalCapacity = std::max((NodeSize - 3ul * sizeof(void *)) / (sizeof(Key) + sizeof(void *)), 4ul);
+
+    /** @brief Minimum count of elements of a leaf that is not the root */
+    static constexpr std::size_t LeafMinimum = LeafCapacity / 2;
+
+    /** @brief Minimum count of keys of an internal node that is not the root */
+    static constexpr std::size_t InternalMinimum = (InternalCapacity - 1) / 2;
+
+    static_assert(NodeSize > 4ul * sizeof(void *), "BTreeDetails: NodeSize is too small");
+    static_assert(std::max(LeafCapacity, InternalCapacity) <= std::numeric_limits<std::uint16_t>::max(), "BTreeDetails: NodeSize is too large");
+    static_assert(nothrow_move_constructible(Key) && nothrow_destructible(Key), "BTreeDetails: Key must be nothrow movable");
+    static_assert(std::copyable<Key>, "BTreeDetails: Key must be copyable as internal nodes hold copies of keys");
+
+
+    /** @brief Bidirectional iterator over the keys in order, maps also give access to the value of each key */
+    template<bool IsConst>
+    class IteratorBase
+    {
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = Key;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const Key *;
+        using reference = const Key &;
+
+        /** @brief Default constructor */
+        IteratorBase(void) noexcept = default;
+
+        /** @brief Copy constructor */
+        IteratorBase(const IteratorBase &other) noexcept = default;
+
+        /** @brief Conversion from mutable to constant iterator */
+        IteratorBase(const IteratorBase<false> &other) noexcept requires IsConst : _leaf(other._leaf), _index(other._index) {}
+
+        /** @brief Copy assignment */
+        IteratorBase &operator=(const IteratorBase &other) noexcept = default;
+
+        /** @brief Get the key */
+        [[nodiscard]] const Key &key(void) const noexcept { return _leaf->keys()[_index]; }
+        [[nodiscard]] const Key &operator*(void) const noexcept { return key(); }
+        [[nodiscard]] const Key *operator->(void) const noexcept { return &key(); }
+
+        /** @brief Get the value of the key */
+        [[nodiscard]] auto &value(void) const noexcept requires IsMap
+        {
+            if constexpr (IsConst)
+                return std::as_const(_leaf->values()[_index]);
+            else
+                return _leaf->values()[_index];
+        }
+
+        /** @brief Increment / decrement operators */
+        IteratorBase &operator++(void) noexcept;
+        IteratorBase operator++(int) noexcept { auto tmp = *this; ++*this; return tmp; }
+        IteratorBase &operator--(void) noexcept;
+        IteratorBase operator--(int) noexcept { auto tmp = *this; --*this; return tmp; }
+
+        /** @brief Comparison operators */
+        [[nodiscard]] bool operator==(const IteratorBase &other) const noexcept = default;
+
+    private:
+        LeafNode *_leaf { nullptr };
+        std::size_t _index { 0 };
+
+        /** @brief Position constructor */
+        IteratorBase(LeafNode * const leaf, const std::size_t index) noexcept : _leaf(leaf), _index(index) {}
+
+        friend class BTreeDetails;
+        friend class IteratorBase<!IsConst>;
+    };
+
+    /** @brief Iterator types */
+    using Iterator = IteratorBase<false>;
+    using ConstIterator = IteratorBase<true>;
+
+
+    /** @brief Default constructor */
+    BTreeDetails(void) noexcept = default;
+
+    /** @brief Copy constructor, the node structure is copied as is */
+    BTreeDetails(const BTreeDetails &other) { copy(other); }
+
+    /** @brief Move constructor */
+    BTreeDetails(BTreeDetails &&other) noexcept { swap(other); }
+
+    /** @brief Range constructor */
+    template<std::input_iterator InputIterator> requires (!IsMap)
+    BTreeDetails(InputIterator from, InputIterator to) { insert(from, to); }
+
+    /** @brief Initializer list constructor */
+    BTreeDetails(std::initializer_list<Key> &&init) requires (!IsMap) { insert(init.begin(), init.end()); }
+
+    /** @brief Initializer list constructor, the first occurrence of a duplicated key is kept */
+    template<typename Pair = std::pair<Key, Value>> requires IsMap
+    BTreeDetails(std::initializer_list<Pair> &&init)
+        { for (const auto &pair : init) tryEmplace(pair.first, pair.second); }
+
+    /** @brief Release the tree */
+    ~BTreeDetails(void) noexcept { clear(); }
+
+    /** @brief Copy assignment */
+    BTreeDetails &operator=(const BTreeDetails &other);
+
+    /** @brief Move assignment */
+    BTreeDetails &operator=(BTreeDetails &&other) noexcept { swap(other); return *this; }
+
+    /** @brief Swap two instances */
+    void swap(BTreeDetails &other) noexcept;
+
+
+    /** @brief Get the count of elements */
+    [[nodiscard]] Range size(void) const noexcept { return _size; }
+
+    /** @brief Check if the tree is empty */
+    [[nodiscard]] bool empty(void) const noexcept { return !_size; }
+
+    /** @brief Fast empty check */
+    [[nodiscard]] explicit operator bool(void) const noexcept { return !empty(); }
+
+
+    /** @brief Begin / end overloads */
+    [[nodiscard]] Iterator begin(void) noexcept { return Iterator(_first, 0); }
+    [[nodiscard]] Iterator end(void) noexcept { return Iterator(_last, _last ? _last->count : 0ul); }
+    [[nodiscard]] ConstIterator begin(void) const noexcept { return ConstIterator(_first, 0); }
+    [[nodiscard]] ConstIterator end(void) const noexcept { return ConstIterator(_last, _last ? _last->count : 0ul); }
+    [[nodiscard]] ConstIterator cbegin(void) const noexcept { return begin(); }
+    [[nodiscard]] ConstIterator cend(void) const noexcept { return end(); }
+
+    /** @brief Get first key */
+    [[nodiscard]] const Key &front(void) const noexcept { return _first->keys()[0]; }
+
+    /** @brief Get last key */
+    [[nodiscard]] const Key &back(void) const noexcept { return _last->keys()[_last->count - 1]; }
+
+
+    /** @brief Get the first element not ordered before 'key' */
+    template<typename LookupKey> requires BTreeLookupKey<LookupKey, Key, Compare>
+    [[nodiscard]] Iterator lowerBound(const LookupKey &key) noexcept_invocable(Compare, const Key &, const LookupKey &)
+        { return bound<false>(key); }
+    template<typename LookupKey> requires BTreeLookupKey<LookupKey, Key, Compare>
+    [[nodiscard]] ConstIterator lowerBound(const LookupKey &key) const noexcept_invocable(Compare, const Key &, const LookupKey &)
+        { return const_cast<BTreeDetails *>(this)->bound<false>(key); }
+
+    /** @brief Get the first element ordered after 'key' */
+    template<typename LookupKey> requires BTreeLookupKey<LookupKey, Key, Compare>
+    [[nodiscard]] Iterator upperBound(const LookupKey &key) noexcept_invocable(Compare, const LookupKey &, const Key &)
+        { return bound<true>(key); }
+    template<typename LookupKey> requires BTreeLookupKey<LookupKey, Key, Compare>
+    [[nodiscard]] ConstIterator upperBound(const LookupKey &key) const noexcept_invocable(Compare, const LookupKey &, const Key &)
+        { return const_cast<BTreeDetails *>(this)->bound<true>(key); }
+
+    /** @brief Finds where to insert an element, after its equivalent elements */
+    [[nodiscard]] Iterator findSortedPlacement(const Key &key) noexcept_invocable(Compare, const Key &, const Key &)
+        { return upperBound(key); }
+    [[nodiscard]] ConstIterator findSortedPlacement(const Key &key) const noexcept_invocable(Compare, const Key &, const Key &)
+        { return upperBound(key); }
+
+    /** @brief Find the first element equivalent to 'key', returns 'end()' if it is missing */
+    template<typename LookupKey> requires BTreeLookupKey<LookupKey, Key, Compare>
+    [[nodiscard]] Iterator find(const LookupKey &key)
+        noexcept(nothrow_invocable(Compare, const Key &, const LookupKey &) && nothrow_invocable(Compare, const LookupKey &, const Key &));
+    template<typename LookupKey> requires BTreeLookupKey<LookupKey, Key, Compare>
+    [[nodiscard]] ConstIterator find(const LookupKey &key) const
+        noexcept(nothrow_invocable(Compare, const Key &, const LookupKey &) && nothrow_invocable(Compare, const LookupKey &, const Key &))
+        { return const_cast<BTreeDetails *>(this)->find(key); }
+
+    /** @brief Check if the tree contains 'key' */
+    template<typename LookupKey> requires BTreeLookupKey<LookupKey, Key, Compare>
+    [[nodiscard]] bool contains(const LookupKey &key) const
+        noexcept(nothrow_invocable(Compare, const Key &, const LookupKey &) && nothrow_invocable(Compare, const LookupKey &, const Key &))
+        { return find(key) != end(); }
+
+
+    /** @brief Push an element into the tree, after its equivalent elements */
+    template<typename ...Args> requires (!IsMap) && std::constructible_from<Key, Args...>
+    const Key &push(Args &&...args)
+        { return *insertAfterEquivalents(Key(std::forward<Args>(args)...)); }
+
+    /** @brief Insert an value by copy, returning its iterator */
+    Iterator insert(const Key &key) requires (!IsMap) { return insertAfterEquivalents(Key(key)); }
+
+    /** @brief Insert an value by move, returning its iterator */
+    Iterator insert(Key &&key) requires (!IsMap) { return insertAfterEquivalents(std::move(key)); }
+
+    /** @brief Insert an initializer list */
+    void insert(std::initializer_list<Key> &&init) requires (!IsMap) { insert(init.begin(), init.end()); }
+
+    /** @brief Insert a range of element by iterating over iterators */
+    template<std::input_iterator InputIterator> requires (!IsMap)
+    void insert(InputIterator from, InputIterator to)
+        { for (; from != to; ++from) push(*from); }
+
+
+    /** @brief Find the value of 'key', returns nullptr if it is missing */
+    template<typename LookupKey> requires IsMap && BTreeLookupKey<LookupKey, Key, Compare>
+    [[nodiscard]] auto *findValue(const LookupKey &key)
+        noexcept(nothrow_invocable(Compare, const Key &, const LookupKey &) && nothrow_invocable(Compare, const LookupKey &, const Key &))
+        { const auto it = find(key); return it != end() ? &it.value() : nullptr; }
+    template<typename LookupKey> requires IsMap && BTreeLookupKey<LookupKey, Key, Compare>
+    [[nodiscard]] const auto *findValue(const LookupKey &key) const
+        noexcept(nothrow_invocable(Compare, const Key &, const LookupKey &) && nothrow_invocable(Compare, const LookupKey &, const Key &))
+        { return const_cast<BTreeDetails *>(this)->findValue(key); }
+
+    /** @brief Get the value of an existing key, throws in debug mode if the key is missing */
+    template<typename LookupKey> requires IsMap && BTreeLookupKey<LookupKey, Key, Compare>
+    [[nodiscard]] auto &at(const LookupKey &key) noexcept_ndebug
+    {
+        const auto it = find(key);
+        kFAssert(it != end(),
+            throw std::out_of_range("Core::BTreeMap::at: Key not found"));
+        return it.value();
+    }
+    template<typename LookupKey> requires IsMap && BTreeLookupKey<LookupKey, Key, Compare>
+    [[nodiscard]] const auto &at(const LookupKey &key) const noexcept_ndebug
+        { return const_cast<BTreeDetails *>(this)->at(key); }
+
+    /** @brief Get the value of a key, inserting a default constructed value if it is missing */
+    template<typename LookupKey> requires IsMap && BTreeLookupKey<LookupKey, Key, Compare> && std::constructible_from<Key, LookupKey>
+    [[nodiscard]] auto &operator[](LookupKey &&key)
+        { return tryEmplace(std::forward<LookupKey>(key)).first.value(); }
+
+    /** @brief Insert a value constructed from 'args' if 'key' is missing
+     *  Neither the key nor the value are constructed if 'key' is already stored
+     *  @return The iterator of the key and true if it has been inserted */
+    template<typename LookupKey, typename ...Args>
+        requires IsMap && BTreeLookupKey<LookupKey, Key, Compare> && std::constructible_from<Key, LookupKey>
+    std::pair<Iterator, bool> tryEmplace(LookupKey &&key, Args &&...args)
+    {
+        if (!_root) [[unlikely]]
+            return std::make_pair(insertAt(nullptr, 0, Key(std::forward<LookupKey>(key)), std::forward<Args>(args)...), true);
+        const auto leaf = findLeaf<false>(key);
+        const auto pos = SearchKeys<false>(leaf->keys(), leaf->count, key);
+        const auto it = normalize(leaf, pos);
+        if (it != end() && !Compare{}(key, *it))
+            return std::make_pair(it, false);
+        return std::make_pair(insertAt(leaf, pos, Key(std::forward<LookupKey>(key)), std::forward<Args>(args)...), true);
+    }
+
+    /** @brief Insert 'value' if 'key' is missing, else assign it to the stored value
+     *  @return The iterator of the key and true if it has been inserted */
+    template<typename LookupKey, typename ValueType>
+        requires IsMap && BTreeLookupKey<LookupKey, Key, Compare> && std::constructible_from<Key, LookupKey>
+    std::pair<Iterator, bool> insertOrAssign(LookupKey &&key, ValueType &&value)
+    {
+        auto result = tryEmplace(std::forward<LookupKey>(key), std::forward<ValueType>(value));
+        if (!result.second)
+            result.first.value() = std::forward<ValueType>(value);
+        return result;
+    }
+
+    /** @brief Call 'functor(key, value)' on each entry in key order */
+    template<typename Functor> requires IsMap
+    void forEach(Functor &&functor)
+        { for (auto it = begin(), last = end(); it != last; ++it) std::invoke(functor, it.key(), it.value()); }
+    template<typename Functor> requires IsMap
+    void forEach(Functor &&functor) const
+        { for (auto it = begin(), last = end(); it != last; ++it) std::invoke(functor, it.key(), it.value()); }
+
+
+    /** @brief Erase an element, returning the iterator of the next one */
+    Iterator erase(const Iterator pos) noexcept { return erase(ConstIterator(pos)); }
+    Iterator erase(const ConstIterator pos) noexcept;
+
+    /** @brief Erase a range of elements, returning the iterator of the element following the range */
+    Iterator erase(const ConstIterator from, const ConstIterator to) noexcept;
+
+    /** @brief Erase the first element equivalent to 'key'
+     *  @return True if an element has been erased */
+    template<typename LookupKey> requires BTreeLookupKey<LookupKey, Key, Compare>
+    bool erase(const LookupKey &key)
+        noexcept(nothrow_invocable(Compare, const Key &, const LookupKey &) && nothrow_invocable(Compare, const LookupKey &, const Key &));
+
+
+    /** @brief Destroy all elements and release every node */
+    void clear(void) noexcept;
+
+    /** @brief Same as clear, the tree never keeps unused nodes */
+    void release(void) noexcept { clear(); }
+
+
+    /** @brief Comparison operators */
+    [[nodiscard]] bool operator==(const BTreeDetails &other) const noexcept;
+    [[nodiscard]] bool operator!=(const BTreeDetails &other) const noexcept { return !operator==(other); }
+
+private:
+    /** @brief Common header of nodes */
+    struct NodeHeader
+    {
+        InternalNode *parent { nullptr };
+        std::uint16_t count { 0 };
+        bool isLeaf { false };
+    };
+
+    /** @brief Leaf node, holding elements */
+    struct alignas_cacheline LeafNode : public NodeHeader
+    {
+        LeafNode *prev { nullptr };
+        LeafNode *next { nullptr };
+        alignas(Key) std::byte keyStorage[sizeof(Key) * LeafCapacity];
+        [[no_unique_address]] BTreeValues<Value, LeafCapacity> valueStorage;
+
+        LeafNode(void) noexcept { this->isLeaf = true; }
+
+        [[nodiscard]] Key *keys(void) noexcept { return reinterpret_cast<Key *>(keyStorage); }
+        [[nodiscard]] auto *values(void) noexcept requires IsMap { return valueStorage.data(); }
+    };
+
+    /** @brief Internal node, holding separators and children */
+    struct alignas_cacheline InternalNode : public NodeHeader
+    {
+        alignas(Key) std::byte keyStorage[sizeof(Key) * InternalCapacity];
+        NodeHeader *children[InternalCapacity + 1];
+
+        [[nodiscard]] Key *keys(void) noexcept { return reinterpret_cast<Key *>(keyStorage); }
+    };
+
+    NodeHeader *_root { nullptr };
+    LeafNode *_first { nullptr };
+    LeafNode *_last { nullptr };
+    Range _size { 0 };
+
+
+    /** @brief Allocate a node */
+    template<typename Node>
+    [[nodiscard]] static Node *AllocateNode(void) noexcept_ndebug;
+
+    /** @brief Deallocate a node without destroying its elements */
+    template<typename Node>
+    static void DeallocateNode(Node * const node) noexcept
+        { DeallocateFunc(node, sizeof(Node), alignof(Node)); }
+
+    /** @brief Get the index of the first key not ordered before (lower) or after (upper) 'key' */
+    template<bool Upper, typename LookupKey>
+    [[nodiscard]] static std::size_t SearchKeys(const Key * const keys, const std::size_t count, const LookupKey &key) noexcept;
+
+    /** @brief Get the index of a child in its parent */
+    [[nodiscard]] static std::size_t ChildIndex(const InternalNode * const parent, const NodeHeader * const child) noexcept
+        { return static_cast<std::size_t>(std::find(parent->children, parent->children + parent->count + 1, child) - parent->children); }
+
+    /** @brief Move the leaf elements [from, to[ of 'source' to uninitialized position 'output' of 'target' */
+    static void MoveElements(LeafNode * const source, const std::size_t from, const std::size_t to, LeafNode * const target, const std::size_t output) noexcept;
+
+    /** @brief Shift the elements of a leaf to leave 'pos' uninitialized */
+    static void OpenSlot(LeafNode * const leaf, const std::size_t pos) noexcept;
+
+    /** @brief Shift the elements of a leaf to fill the already destroyed 'pos' */
+    static void CloseSlot(LeafNode * const leaf, const std::size_t pos) noexcept;
+
+    /** @brief Insert a key and its right child at 'index' of an internal node that is not full */
+    static void InsertSeparator(InternalNode * const node, const std::size_t index, Key &&key, NodeHeader * const right) noexcept;
+
+    /** @brief Move 'separator' and every key and child of 'source' at the end of 'target', then release 'source' */
+    static void MergeInternals(InternalNode * const target, Key &separator, InternalNode * const source) noexcept;
+
+    /** @brief Destroy a node, its elements and all its children */
+    static void DestroyNode(NodeHeader * const node) noexcept;
+
+
+    /** @brief Get the leaf where the lower or upper bound of 'key' is */
+    template<bool Upper, typename LookupKey>
+    [[nodiscard]] LeafNode *findLeaf(const LookupKey &key) const noexcept;
+
+    /** @brief Get the lower or upper bound of 'key' */
+    template<bool Upper, typename LookupKey>
+    [[nodiscard]] Iterator bound(const LookupKey &key) noexcept;
+
+    /** @brief Get the iterator of a leaf position, moving to the next leaf if the position is past the end of a leaf */
+    [[nodiscard]] Iterator normalize(LeafNode * const leaf, const std::size_t index) const noexcept
+        { return index == leaf->count && leaf->next ? Iterator(leaf->next, 0) : Iterator(leaf, index); }
+
+    /** @brief Insert a key after its equivalent keys */
+    Iterator insertAfterEquivalents(Key &&key);
+
+    /** @brief Insert an element at a sorted position of a leaf, splitting it if it is full */
+    template<typename ...ValueArgs>
+    Iterator insertAt(LeafNode *leaf, std::size_t pos, Key &&key, ValueArgs &&...valueArgs);
+
+    /** @brief Register 'right' as the next sibling of 'left' in their parent, 'separator' is between both */
+    void insertSeparator(NodeHeader * const left, Key &&separator, NodeHeader * const right) noexcept_ndebug;
+
+    /** @brief Erase a key and the child following it from an internal node then rebalance it */
+    void eraseSeparator(InternalNode * const node, const std::size_t keyIndex) noexcept;
+
+    /** @brief Borrow from or merge with a sibling, updating the position of an element of the leaf */
+    void rebalanceLeaf(LeafNode *&leaf, std::size_t &pos) noexcept;
+
+    /** @brief Borrow from or merge with a sibling */
+    void rebalanceInternal(InternalNode * const node) noexcept;
+
+    /** @brief Remove a leaf from the leaf list */
+    void unlinkLeaf(LeafNode * const leaf) noexcept;
+
+    /** @brief Copy the structure of another tree, the tree must be empty */
+    void copy(const BTreeDetails &other);
+
+    /** @brief Copy a node and its children, linking copied leaves after 'previous' */
+    [[nodiscard]] NodeHeader *copyNode(NodeHeader * const node, InternalNode * const parent, LeafNode *&previous);
+};
+
+/** @brief A B+tree only owns heap nodes which never point back to it */
+template<typename Key, typename Mapped, std::integral Range, typename Compare, auto AllocateFunc, auto DeallocateFunc, std::size_t NodeSize>
+struct kF::Core::IsTriviallyRelocatable<kF::Core::Internal::BTreeDetails<Key, Mapped, Range, Compare, AllocateFunc, DeallocateFunc, NodeSize>>
+{
+    static constexpr bool Value = true;
+};
+
+#include "BTreeDetails.ipp"
@@ -0,0 +1,498 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: BTreeDetails
+ */
+
+#define BTREE_TEMPLATE template<typename Key, typename Value, std::integral Range, typename Compare, auto AllocateFunc, auto DeallocateFunc, std::size_t NodeSize>
+#define BTREE_DETAILS kF::Core::Internal::BTreeDetails<Key, Value, Range, Compare, AllocateFunc, DeallocateFunc, NodeSize>
+
+BTREE_TEMPLATE
+template<bool IsConst>
+inline typename BTREE_DETAILS::template IteratorBase<IsConst> &BTREE_DETAILS::IteratorBase<IsConst>::operator++(void) noexcept
+{
+    if (++_index == _leaf->count && _leaf->next) {
+        _leaf = _leaf->next;
+        _index = 0;
+    }
+    return *this;
+}
+
+BTREE_TEMPLATE
+template<bool IsConst>
+inline typename BTREE_DETAILS::template IteratorBase<IsConst> &BTREE_DETAILS::IteratorBase<IsConst>::operator--(void) noexcept
+{
+    if (!_index) {
+        _leaf = _leaf->prev;
+        _index = _leaf->count;
+    }
+    --_index;
+    return *this;
+}
+
+BTREE_TEMPLATE
+inline BTREE_DETAILS &BTREE_DETAILS::operator=(const BTreeDetails &other)
+{
+    if (this != &other) [[likely]] {
+        clear();
+        copy(other);
+    }
+    return *this;
+}
+
+BTREE_TEMPLATE
+inline void BTREE_DETAILS::swap(BTreeDetails &other) noexcept
+{
+    std::swap(_root, other._root);
+    std::swap(_first, other._first);
+    std::swap(_last, other._last);
+    std::swap(_size, other._size);
+}
+
+BTREE_TEMPLATE
+template<typename LookupKey> requires kF::Core::Internal::BTreeLookupKey<LookupKey, Key, Compare>
+inline typename BTREE_DETAILS::Iterator BTREE_DETAILS::find(const LookupKey &key)
+    noexcept(nothrow_invocable(Compare, const Key &, const LookupKey &) && nothrow_invocable(Compare, const LookupKey &, const Key &))
+{
+    const auto it = lowerBound(key);
+
+    if (it != end() && !Compare{}(key, *it)) [[likely]]
+        return it;
+    return end();
+}
+
+BTREE_TEMPLATE
+inline typename BTREE_DETAILS::Iterator BTREE_DETAILS::erase(const ConstIterator pos) noexcept
+{
+    auto leaf = pos._leaf;
+    auto index = pos._index;
+
+    leaf->keys()[index].~Key();
+    if constexpr (IsMap)
+        leaf->values()[index].~Value();
+    CloseSlot(leaf, index);
+    --leaf->count;
+    --_size;
+    if (leaf == _root) {
+        if (!leaf->count) [[unlikely]] {
+            DeallocateNode(leaf);
+            _root = nullptr;
+            _first = nullptr;
+            _last = nullptr;
+            return end();
+        }
+    } else if (leaf->count < LeafMinimum)
+        rebalanceLeaf(leaf, index);
+    return normalize(leaf, index);
+}
+
+BTREE_TEMPLATE
+inline typename BTREE_DETAILS::Iterator BTREE_DETAILS::erase(const ConstIterator from, const ConstIterator to) noexcept
+{
+    // Rebalancing moves elements between leaves, so 'to' is not valid anymore after the first erasure
+    auto count = std::distance(from, to);
+    auto it = Iterator(from._leaf, from._index);
+
+    while (count--)
+        it = erase(it);
+    return it;
+}
+
+BTREE_TEMPLATE
+template<typename LookupKey> requires kF::Core::Internal::BTreeLookupKey<LookupKey, Key, Compare>
+inline bool BTREE_DETAILS::erase(const LookupKey &key)
+    noexcept(nothrow_invocable(Compare, const Key &, const LookupKey &) && nothrow_invocable(Compare, const LookupKey &, const Key &))
+{
+    const auto it = find(key);
+
+    if (it == end())
+        return false;
+    erase(it);
+    return true;
+}
+
+BTREE_TEMPLATE
+inline void BTREE_DETAILS::clear(void) noexcept
+{
+    if (!_root)
+        return;
+    DestroyNode(_root);
+    _root = nullptr;
+    _first = nullptr;
+    _last = nullptr;
+    _size = 0;
+}
+
+BTREE_TEMPLATE
+inline bool BTREE_DETAILS::operator==(const BTreeDetails &other) const noexcept
+{
+    if (_size != other._size)
+        return false;
+    for (auto it = begin(), otherIt = other.begin(), last = end(); it != last; ++it, ++otherIt) {
+        if (!(it.key() == otherIt.key()))
+            return false;
+        if constexpr (IsMap) {
+            if (!(it.value() == otherIt.value()))
+                return false;
+        }
+    }
+    return true;
+}
+
+BTREE_TEMPLATE
+template<typename Node>
+inline Node *BTREE_DETAILS::AllocateNode(void) noexcept_ndebug
+{
+    const auto node = reinterpret_cast<Node *>(AllocateFunc(sizeof(Node), alignof(Node)));
+
+    kFAssert(node,
+        throw std::runtime_error("Core::BTree::AllocateNode: Malloc failed"));
+    return new (node) Node;
+}
+
+BTREE_TEMPLATE
+template<bool Upper, typename LookupKey>
+inline std::size_t BTREE_DETAILS::SearchKeys(const Key * const keys, const std::size_t count, const LookupKey &key) noexcept
+{
+    if constexpr (std::is_same_v<LookupKey, Key> && Utils::SimdSearchableCompare<Key, Compare>) {
+        if constexpr (Upper)
+            return static_cast<std::size_t>(Utils::SimdUpperBound(keys, keys + count, key) - keys);
+        else
+            return static_cast<std::size_t>(Utils::SimdLowerBound(keys, keys + count, key) - keys);
+    } else if constexpr (Upper)
+        return static_cast<std::size_t>(std::upper_bound(keys, keys + count, key, Compare{}) - keys);
+    else
+        return static_cast<std::size_t>(std::lower_bound(keys, keys + count, key, Compare{}) - keys);
+}
+
+BTREE_TEMPLATE
+inline void BTREE_DETAILS::MoveElements(LeafNode * const source, const std::size_t from, const std::size_t to,
+        LeafNode * const target, const std::size_t output) noexcept
+{
+    Utils::RelocateForward(source->keys() + from, source->keys() + to, target->keys() + output);
+    if constexpr (IsMap)
+        Utils::RelocateForward(source->values() + from, source->values() + to, target->values() + output);
+}
+
+BTREE_TEMPLATE
+inline void BTREE_DETAILS::OpenSlot(LeafNode * const leaf, const std::size_t pos) noexcept
+{
+    Utils::RelocateBackward(leaf->keys() + pos, leaf->keys() + leaf->count, leaf->keys() + leaf->count + 1);
+    if constexpr (IsMap)
+        Utils::RelocateBackward(leaf->values() + pos, leaf->values() + leaf->count, leaf->values() + leaf->count + 1);
+}
+
+BTREE_TEMPLATE
+inline void BTREE_DETAILS::CloseSlot(LeafNode * const leaf, const std::size_t pos) noexcept
+{
+    Utils::RelocateForward(leaf->keys() + pos + 1, leaf->keys() + leaf->count, leaf->keys() + pos);
+    if constexpr (IsMap)
+        Utils::RelocateForward(leaf->values() + pos + 1, leaf->values() + leaf->count, leaf->values() + pos);
+}
+
+BTREE_TEMPLATE
+inline void BTREE_DETAILS::InsertSeparator(InternalNode * const node, const std::size_t index, Key &&key, NodeHeader * const right) noexcept
+{
+    const auto keys = node->keys();
+    const auto children = node->children;
+
+    Utils::RelocateBackward(keys + index, keys + node->count, keys + node->count + 1);
+    new (keys + index) Key(std::move(key));
+    std::copy_backward(children + index + 1, children + node->count + 1, children + node->count + 2);
+    children[index + 1] = right;
+    right->parent = node;
+    ++node->count;
+}
+
+BTREE_TEMPLATE
+inline void BTREE_DETAILS::MergeInternals(InternalNode * const target, Key &separator, InternalNode * const source) noexcept
+{
+    const auto offset = target->count + 1ul;
+
+    new (target->keys() + target->count) Key(std::move(separator));
+    Utils::RelocateForward(source->keys(), source->keys() + source->count, target->keys() + offset);
+    for (auto i = 0ul; i <= source->count; ++i) {
+        target->children[offset + i] = source->children[i];
+        source->children[i]->parent = target;
+    }
+    target->count += source->count + 1;
+    DeallocateNode(source);
+}
+
+BTREE_TEMPLATE
+inline void BTREE_DETAILS::DestroyNode(NodeHeader * const node) noexcept
+{
+    if (node->isLeaf) {
+        const auto leaf = static_cast<LeafNode *>(node);
+        std::destroy_n(leaf->keys(), leaf->count);
+        if constexpr (IsMap)
+            std::destroy_n(leaf->values(), leaf->count);
+        DeallocateNode(leaf);
+    } else {
+        const auto internal = static_cast<InternalNode *>(node);
+        std::destroy_n(internal->keys(), internal->count);
+        for (auto i = 0ul; i <= internal->count; ++i)
+            DestroyNode(internal->children[i]);
+        DeallocateNode(internal);
+    }
+}
+
+BTREE_TEMPLATE
+template<bool Upper, typename LookupKey>
+inline typename BTREE_DETAILS::LeafNode *BTREE_DETAILS::findLeaf(const LookupKey &key) const noexcept
+{
+    auto node = _root;
+
+    while (!node->isLeaf) {
+        const auto internal = static_cast<InternalNode *>(node);
+        node = internal->children[SearchKeys<Upper>(internal->keys(), internal->count, key)];
+    }
+    return static_cast<LeafNode *>(node);
+}
+
+BTREE_TEMPLATE
+template<bool Upper, typename LookupKey>
+inline typename BTREE_DETAILS::Iterator BTREE_DETAILS::bound(const LookupKey &key) noexcept
+{
+    if (!_root) [[unlikely]]
+        return end();
+    const auto leaf = findLeaf<Upper>(key);
+    return normalize(leaf, SearchKeys<Upper>(leaf->keys(), leaf->count, key));
+}
+
+BTREE_TEMPLATE
+inline typename BTREE_DETAILS::Iterator BTREE_DETAILS::insertAfterEquivalents(Key &&key)
+{
+    if (!_root) [[unlikely]]
+        return insertAt(nullptr, 0, std::move(key));
+    const auto leaf = findLeaf<true>(key);
+    return insertAt(leaf, SearchKeys<true>(leaf->keys(), leaf->count, key), std::move(key));
+}
+
+BTREE_TEMPLATE
+template<typename ...ValueArgs>
+inline typename BTREE_DETAILS::Iterator BTREE_DETAILS::insertAt(LeafNode *leaf, std::size_t pos, Key &&key, ValueArgs &&...valueArgs)
+{
+    // Everything that may throw is constructed before the tree is modified
+    auto value = ConstexprTernaryRef(IsMap, Value(std::forward<ValueArgs>(valueArgs)...), nullptr);
+
+    if (!leaf) [[unlikely]] {
+        leaf = AllocateNode<LeafNode>();
+        _root = leaf;
+        _first = leaf;
+        _last = leaf;
+    } else if (leaf->count == LeafCapacity) {
+        constexpr auto Middle = (LeafCapacity + 1) / 2;
+        Key separator(leaf->keys()[Middle]);
+        const auto right = AllocateNode<LeafNode>();
+        MoveElements(leaf, Middle, LeafCapacity, right, 0);
+        right->count = static_cast<std::uint16_t>(LeafCapacity - Middle);
+        leaf->count = static_cast<std::uint16_t>(Middle);
+        right->prev = leaf;
+        right->next = leaf->next;
+        if (leaf->next)
+            leaf->next->prev = right;
+        else
+            _last = right;
+        leaf->next = right;
+        insertSeparator(leaf, std::move(separator), right);
+        if (pos > Middle) {
+            leaf = right;
+            pos -= Middle;
+        }
+    }
+    OpenSlot(leaf, pos);
+    new (leaf->keys() + pos) Key(std::move(key));
+    if constexpr (IsMap)
+        new (leaf->values() + pos) Value(std::move(value));
+    ++leaf->count;
+    ++_size;
+    return Iterator(leaf, pos);
+}
+
+BTREE_TEMPLATE
+inline void BTREE_DETAILS::insertSeparator(NodeHeader * const left, Key &&separator, NodeHeader * const right) noexcept_ndebug
+{
+    auto parent = left->parent;
+
+    if (!parent) {
+        parent = AllocateNode<InternalNode>();
+        parent->children[0] = left;
+        left->parent = parent;
+        _root = parent;
+    }
+    const auto index = ChildIndex(parent, left);
+    if (parent->count != InternalCapacity) [[likely]] {
+        InsertSeparator(parent, index, std::move(separator), right);
+        return;
+    }
+    // Split the full parent around its middle key, which is promoted to the grand parent
+    constexpr auto Middle = InternalCapacity / 2;
+    const auto sibling = AllocateNode<InternalNode>();
+    Key promoted(std::move(parent->keys()[Middle]));
+    parent->keys()[Middle].~Key();
+    Utils::RelocateForward(parent->keys() + Middle + 1, parent->keys() + InternalCapacity, sibling->keys());
+    for (auto i = Middle + 1; i <= InternalCapacity; ++i) {
+        sibling->children[i - Middle - 1] = parent->children[i];
+        parent->children[i]->parent = sibling;
+    }
+    sibling->count = static_cast<std::uint16_t>(InternalCapacity - Middle - 1);
+    parent->count = static_cast<std::uint16_t>(Middle);
+    if (index <= Middle)
+        InsertSeparator(parent, index, std::move(separator), right);
+    else
+        InsertSeparator(sibling, index - Middle - 1, std::move(separator), right);
+    insertSeparator(parent, std::move(promoted), sibling);
+}
+
+BTREE_TEMPLATE
+inline void BTREE_DETAILS::eraseSeparator(InternalNode * const node, const std::size_t keyIndex) noexcept
+{
+    const auto keys = node->keys();
+    const auto children = node->children;
+
+    keys[keyIndex].~Key();
+    Utils::RelocateForward(keys + keyIndex + 1, keys + node->count, keys + keyIndex);
+    std::copy(children + keyIndex + 2, children + node->count + 1, children + keyIndex + 1);
+    --node->count;
+    if (node == _root) {
+        if (!node->count) {
+            _root = children[0];
+            _root->parent = nullptr;
+            DeallocateNode(node);
+        }
+    } else if (node->count < InternalMinimum)
+        rebalanceInternal(node);
+}
+
+BTREE_TEMPLATE
+inline void BTREE_DETAILS::rebalanceLeaf(LeafNode *&leaf, std::size_t &pos) noexcept
+{
+    const auto parent = leaf->parent;
+    const auto index = ChildIndex(parent, leaf);
+    const auto left = index ? static_cast<LeafNode *>(parent->children[index - 1]) : nullptr;
+    const auto right = index < parent->count ? static_cast<LeafNode *>(parent->children[index + 1]) : nullptr;
+
+    if (left && left->count > LeafMinimum) {
+        OpenSlot(leaf, 0);
+        MoveElements(left, left->count - 1ul, left->count, leaf, 0);
+        --left->count;
+        ++leaf->count;
+        parent->keys()[index - 1] = leaf->keys()[0];
+        ++pos;
+    } else if (right && right->count > LeafMinimum) {
+        MoveElements(right, 0, 1, leaf, leaf->count);
+        ++leaf->count;
+        CloseSlot(right, 0);
+        --right->count;
+        parent->keys()[index] = right->keys()[0];
+    } else if (left) {
+        MoveElements(leaf, 0, leaf->count, left, left->count);
+        pos += left->count;
+        left->count = static_cast<std::uint16_t>(left->count + leaf->count);
+        unlinkLeaf(leaf);
+        DeallocateNode(leaf);
+        leaf = left;
+        eraseSeparator(parent, index - 1);
+    } else {
+        MoveElements(right, 0, right->count, leaf, leaf->count);
+        leaf->count = static_cast<std::uint16_t>(leaf->count + right->count);
+        unlinkLeaf(right);
+        DeallocateNode(right);
+        eraseSeparator(parent, index);
+    }
+}
+
+BTREE_TEMPLATE
+inline void BTREE_DETAILS::rebalanceInternal(InternalNode * const node) noexcept
+{
+    const auto parent = node->parent;
+    const auto index = ChildIndex(parent, node);
+    const auto left = index ? static_cast<InternalNode *>(parent->children[index - 1]) : nullptr;
+    const auto right = index < parent->count ? static_cast<InternalNode *>(parent->children[index + 1]) : nullptr;
+
+    if (left && left->count > InternalMinimum) {
+        // Rotate the last child of the left sibling through the parent
+        Utils::RelocateBackward(node->keys(), node->keys() + node->count, node->keys() + node->count + 1);
+        std::copy_backward(node->children, node->children + node->count + 1, node->children + node->count + 2);
+        new (node->keys()) Key(std::move(parent->keys()[index - 1]));
+        parent->keys()[index - 1] = std::move(left->keys()[left->count - 1]);
+        left->keys()[left->count - 1].~Key();
+        node->children[0] = left->children[left->count];
+        node->children[0]->parent = node;
+        --left->count;
+        ++node->count;
+    } else if (right && right->count > InternalMinimum) {
+        // Rotate the first child of the right sibling through the parent
+        new (node->keys() + node->count) Key(std::move(parent->keys()[index]));
+        parent->keys()[index] = std::move(right->keys()[0]);
+        node->children[node->count + 1] = right->children[0];
+        node->children[node->count + 1]->parent = node;
+        ++node->count;
+        right->keys()[0].~Key();
+        Utils::RelocateForward(right->keys() + 1, right->keys() + right->count, right->keys());
+        std::copy(right->children + 1, right->children + right->count + 1, right->children);
+        --right->count;
+    } else if (left) {
+        MergeInternals(left, parent->keys()[index - 1], node);
+        eraseSeparator(parent, index - 1);
+    } else {
+        MergeInternals(node, parent->keys()[index], right);
+        eraseSeparator(parent, index);
+    }
+}
+
+BTREE_TEMPLATE
+inline void BTREE_DETAILS::unlinkLeaf(LeafNode * const leaf) noexcept
+{
+    if (leaf->prev)
+        leaf->prev->next = leaf->next;
+    else
+        _first = leaf->next;
+    if (leaf->next)
+        leaf->next->prev = leaf->prev;
+    else
+        _last = leaf->prev;
+}
+
+BTREE_TEMPLATE
+inline void BTREE_DETAILS::copy(const BTreeDetails &other)
+{
+    if (!other._root)
+        return;
+    LeafNode *previous = nullptr;
+    _root = copyNode(other._root, nullptr, previous);
+    _last = previous;
+    _size = other._size;
+}
+
+BTREE_TEMPLATE
+inline typename BTREE_DETAILS::NodeHeader *BTREE_DETAILS::copyNode(NodeHeader * const node, InternalNode * const parent, LeafNode *&previous)
+{
+    if (node->isLeaf) {
+        const auto leaf = static_cast<LeafNode *>(node);
+        const auto copy = AllocateNode<LeafNode>();
+        std::uninitialized_copy_n(leaf->keys(), leaf->count, copy->keys());
+        if constexpr (IsMap)
+            std::uninitialized_copy_n(leaf->values(), leaf->count, copy->values());
+        copy->count = leaf->count;
+        copy->parent = parent;
+        copy->prev = previous;
+        if (previous)
+            previous->next = copy;
+        else
+            _first = copy;
+        previous = copy;
+        return copy;
+    }
+    const auto internal = static_cast<InternalNode *>(node);
+    const auto copy = AllocateNode<InternalNode>();
+    std::uninitialized_copy_n(internal->keys(), internal->count, copy->keys());
+    copy->count = internal->count;
+    copy->parent = parent;
+    for (auto i = 0ul; i <= internal->count; ++i)
+        copy->children[i] = copyNode(internal->children[i], copy, previous);
+    return copy;
+}
+
+#undef BTREE_DETAILS
+#undef BTREE_TEMPLATE
@@ -0,0 +1,36 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: BTreeMap
+ */
+
+#pragma once
+
+#include "AllocationPolicy.hpp"
+#include "BTreeDetails.hpp"
+
+namespace kF::Core
+{
+    /**
+     * @brief Map of unique keys stored in a B+tree, each leaf keeps its keys and values in separate columns
+     * Searches only touch keys, values are read once their position is known
+     * The default comparator is transparent, so keys can be looked up by any type comparable with them
+     *
+     * @tparam Key Key type
+     * @tparam Value Value type
+     * @tparam Range Range of container
+     * @tparam Compare Compare operator
+     * @tparam NodeSize Byte size of a node
+     */
+    template<typename Key, typename Value, std::integral Range = std::size_t, typename Compare = std::less<>, std::size_t NodeSize = BTreeDefaultNodeSize>
+    using BTreeMap = Internal::BTreeDetails<Key, Value, Range, Compare,
+        &DefaultAllocationPolicy::Allocate, &DefaultAllocationPolicy::Deallocate, NodeSize>;
+
+    /** @brief B+tree map with a reduced range */
+    template<typename Key, typename Value, typename Compare = std::less<>, std::size_t NodeSize = BTreeDefaultNodeSize>
+    using TinyBTreeMap = BTreeMap<Key, Value, std::uint32_t, Compare, NodeSize>;
+
+    /** @brief B+tree map that must take an allocator and a deallocator functor */
+    template<typename Key, typename Value, auto AllocateFunc, auto DeallocateFunc, std::integral Range = std::size_t,
+            typename Compare = std::less<>, std::size_t NodeSize = BTreeDefaultNodeSize>
+    using AllocatedBTreeMap = Internal::BTreeDetails<Key, Value, Range, Compare, AllocateFunc, DeallocateFunc, NodeSize>;
+}
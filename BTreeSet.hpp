@@ -0,0 +1,34 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: BTreeSet
+ */
+
+#pragma once
+
+#include "AllocationPolicy.hpp"
+#include "BTreeDetails.hpp"
+
+namespace kF::Core
+{
+    /**
+     * @brief Ordered keys stored in a B+tree, equivalent keys are kept in insertion order like a sorted vector
+     * Insertions and removals only move the elements of one node, which makes it faster than a sorted vector for write-heavy workloads
+     *
+     * @tparam Type Key type
+     * @tparam Range Range of container
+     * @tparam Compare Compare operator
+     * @tparam NodeSize Byte size of a node
+     */
+    template<typename Type, std::integral Range = std::size_t, typename Compare = std::less<Type>, std::size_t NodeSize = BTreeDefaultNodeSize>
+    using BTreeSet = Internal::BTreeDetails<Type, void, Range, Compare,
+        &DefaultAllocationPolicy::Allocate, &DefaultAllocationPolicy::Deallocate, NodeSize>;
+
+    /** @brief B+tree set with a reduced range */
+    template<typename Type, typename Compare = std::less<Type>, std::size_t NodeSize = BTreeDefaultNodeSize>
+    using TinyBTreeSet = BTreeSet<Type, std::uint32_t, Compare, NodeSize>;
+
+    /** @brief B+tree set that must take an allocator and a deallocator functor */
+    template<typename Type, auto AllocateFunc, auto DeallocateFunc, std::integral Range = std::size_t,
+            typename Compare = std::less<Type>, std::size_t NodeSize = BTreeDefaultNodeSize>
+    using AllocatedBTreeSet = Internal::BTreeDetails<Type, void, Range, Compare, AllocateFunc, DeallocateFunc, NodeSize>;
+}
@@ -6,6 +6,16 @@ set(KubeCoreBenchmarksSources
     ${KubeCoreBenchmarksDir}/Main.cpp
     ${KubeCoreBenchmarksDir}/bench_SPSCQueue.cpp
     ${KubeCoreBenchmarksDir}/bench_MPMCQueue.cpp
+    ${KubeCoreBenchmarksDir}/bench_PoolAllocator.cpp
+    ${KubeCoreBenchmarksDir}/bench_GrowthPolicy.cpp
+    ${KubeCoreBenchmarksDir}/bench_Vector.cpp
+    ${KubeCoreBenchmarksDir}/bench_SmallVector.cpp
+    ${KubeCoreBenchmarksDir}/bench_SharedFlatVector.cpp
+    ${KubeCoreBenchmarksDir}/bench_Parallel.cpp
+    ${KubeCoreBenchmarksDir}/bench_SoAVector.cpp
+    ${KubeCoreBenchmarksDir}/bench_FlatMap.cpp
+    ${KubeCoreBenchmarksDir}/bench_SortedVector.cpp
+    ${KubeCoreBenchmarksDir}/bench_BTree.cpp
 )
 
 add_executable(${CMAKE_PROJECT_NAME} ${KubeCoreBenchmarksSources})
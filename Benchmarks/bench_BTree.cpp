@@ -0,0 +1,125 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Benchmark of ordered containers under random insertions and lookups, sorted vector against B+tree and red-black tree
+ */
+
+#include <random>
+#include <set>
+
+#include <benchmark/benchmark.h>
+
+#include <Kube/Core/Vector.hpp>
+#include <Kube/Core/SortedVector.hpp>
+#include <Kube/Core/BTreeSet.hpp>
+
+using namespace kF;
+
+/** @brief Count of lookups per iteration */
+constexpr auto LookupCount = 1024ul;
+
+/** @brief Generate 'count' random keys */
+static Core::Vector<std::uint64_t> MakeKeys(const std::size_t count, const std::uint64_t seed)
+{
+    std::mt19937_64 engine(seed);
+    Core::Vector<std::uint64_t> keys;
+
+    keys.pushN(count, [&](const auto) { return engine(); });
+    return keys;
+}
+
+/** @brief Insert a random key in the container */
+template<typename Container>
+static void Insert(Container &container, const std::uint64_t key)
+{
+    if constexpr (requires { container.push(key); })
+        container.push(key);
+    else
+        container.insert(key);
+}
+
+/** @brief Get the first element of the container not ordered before 'key' */
+template<typename Container>
+static auto LowerBound(Container &container, const std::uint64_t key)
+{
+    if constexpr (requires { container.lowerBound(key); })
+        return container.lowerBound(key);
+    else
+        return container.lower_bound(key);
+}
+
+/** @brief Build a container of 'count' random keys */
+template<typename Container>
+static void Ordered_RandomInsert(benchmark::State &state)
+{
+    const auto count = static_cast<std::size_t>(state.range(0));
+    const auto keys = MakeKeys(count, 42);
+
+    for (auto _ : state) {
+        Container container;
+        for (const auto key : keys)
+            Insert(container, key);
+        benchmark::DoNotOptimize(container);
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+
+/** @brief Replace random keys of a container of 'count' keys, the size stays constant */
+template<typename Container>
+static void Ordered_RandomChurn(benchmark::State &state)
+{
+    const auto count = static_cast<std::size_t>(state.range(0));
+    const auto keys = MakeKeys(count, 42);
+    const auto inserted = MakeKeys(LookupCount, 7);
+    Container container;
+
+    for (const auto key : keys)
+        Insert(container, key);
+    for (auto _ : state) {
+        for (auto i = 0ul; i < LookupCount; ++i) {
+            container.erase(LowerBound(container, keys[i]));
+            Insert(container, inserted[i]);
+        }
+        state.PauseTiming();
+        for (auto i = 0ul; i < LookupCount; ++i) {
+            container.erase(LowerBound(container, inserted[i]));
+            Insert(container, keys[i]);
+        }
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed(state.iterations() * LookupCount);
+}
+
+/** @brief Lookup random stored keys in a container of 'count' keys */
+template<typename Container>
+static void Ordered_Lookup(benchmark::State &state)
+{
+    const auto count = static_cast<std::size_t>(state.range(0));
+    const auto keys = MakeKeys(count, 42);
+    Container container;
+
+    for (const auto key : keys)
+        Insert(container, key);
+    for (auto _ : state) {
+        std::size_t found = 0;
+        for (auto i = 0ul; i < LookupCount; ++i)
+            found += LowerBound(container, keys[(i * 7919) % count]) != container.end();
+        benchmark::DoNotOptimize(found);
+    }
+    state.SetItemsProcessed(state.iterations() * LookupCount);
+}
+
+using SortedVectorSet = Core::SortedVector<std::uint64_t>;
+using BTreeSet = Core::BTreeSet<std::uint64_t>;
+using StdMultiset = std::multiset<std::uint64_t>;
+
+BENCHMARK_TEMPLATE(Ordered_RandomInsert, SortedVectorSet)->RangeMultiplier(8)->Range(64, 1 << 18);
+BENCHMARK_TEMPLATE(Ordered_RandomInsert, BTreeSet)->RangeMultiplier(8)->Range(64, 1 << 20);
+BENCHMARK_TEMPLATE(Ordered_RandomInsert, StdMultiset)->RangeMultiplier(8)->Range(64, 1 << 20);
+
+BENCHMARK_TEMPLATE(Ordered_RandomChurn, SortedVectorSet)->RangeMultiplier(8)->Range(1024, 1 << 20);
+BENCHMARK_TEMPLATE(Ordered_RandomChurn, BTreeSet)->RangeMultiplier(8)->Range(1024, 1 << 20);
+BENCHMARK_TEMPLATE(Ordered_RandomChurn, StdMultiset)->RangeMultiplier(8)->Range(1024, 1 << 20);
+
+BENCHMARK_TEMPLATE(Ordered_Lookup, SortedVectorSet)->RangeMultiplier(8)->Range(1024, 1 << 20);
+BENCHMARK_TEMPLATE(Ordered_Lookup, BTreeSet)->RangeMultiplier(8)->Range(1024, 1 << 20);
+BENCHMARK_TEMPLATE(Ordered_Lookup, StdMultiset)->RangeMultiplier(8)->Range(1024, 1 << 20);
@@ -0,0 +1,127 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Benchmark of flat maps against node based and hashed standard maps
+ */
+
+#include <array>
+#include <map>
+#include <random>
+#include <unordered_map>
+
+#include <benchmark/benchmark.h>
+
+#include <Kube/Core/Vector.hpp>
+#include <Kube/Core/FlatMap.hpp>
+
+using namespace kF;
+
+/** @brief Value large enough to make key and value interleaving costly */
+using Payload = std::array<std::uint64_t, 4>;
+
+using FlatMap = Core::FlatMap<std::uint64_t, Payload>;
+using StdMap = std::map<std::uint64_t, Payload>;
+using StdUnorderedMap = std::unordered_map<std::uint64_t, Payload>;
+
+/** @brief Count of lookups per iteration */
+constexpr auto LookupCount = 1024ul;
+
+/** @brief Generate 'count' unique keys in random order */
+[[nodiscard]] static Core::Vector<std::uint64_t> MakeKeys(const std::size_t count)
+{
+    Core::Vector<std::uint64_t> keys;
+    keys.pushN(count, [](const auto i) { return i * 2654435761ul; });
+    std::shuffle(keys.begin(), keys.end(), std::mt19937_64(42));
+    return keys;
+}
+
+template<typename Map>
+static void Insert(Map &map, const std::uint64_t key)
+{
+    if constexpr (requires { map.findIndex(key); })
+        map.tryEmplace(key, Payload { key });
+    else
+        map.try_emplace(key, Payload { key });
+}
+
+template<typename Map>
+[[nodiscard]] static const Payload *Find(const Map &map, const std::uint64_t key)
+{
+    if constexpr (requires { map.findIndex(key); }) {
+        return map.find(key);
+    } else {
+        const auto it = map.find(key);
+        return it != map.end() ? &it->second : nullptr;
+    }
+}
+
+/** @brief Lookup random existing keys */
+template<typename Map>
+static void FlatMap_Find(benchmark::State &state)
+{
+    const auto count = static_cast<std::size_t>(state.range(0));
+    const auto keys = MakeKeys(count);
+    Map map;
+
+    for (const auto key : keys)
+        Insert(map, key);
+    std::mt19937_64 engine(7);
+    Core::Vector<std::uint64_t> lookups;
+    lookups.pushN(LookupCount, [&](const auto) { return keys[engine() % count]; });
+    for (auto _ : state) {
+        std::uint64_t sum = 0;
+        for (const auto key : lookups)
+            sum += (*Find(map, key))[0];
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * LookupCount);
+}
+
+/** @brief Lookup random missing keys */
+template<typename Map>
+static void FlatMap_FindMissing(benchmark::State &state)
+{
+    const auto count = static_cast<std::size_t>(state.range(0));
+    const auto keys = MakeKeys(count);
+    Map map;
+
+    for (const auto key : keys)
+        Insert(map, key);
+    std::mt19937_64 engine(7);
+    Core::Vector<std::uint64_t> lookups;
+    lookups.pushN(LookupCount, [&](const auto) { return keys[engine() % count] + 1; });
+    for (auto _ : state) {
+        std::size_t found = 0;
+        for (const auto key : lookups)
+            found += Find(map, key) != nullptr;
+        benchmark::DoNotOptimize(found);
+    }
+    state.SetItemsProcessed(state.iterations() * LookupCount);
+}
+
+/** @brief Build a map from keys in random order */
+template<typename Map>
+static void FlatMap_Insert(benchmark::State &state)
+{
+    const auto count = static_cast<std::size_t>(state.range(0));
+    const auto keys = MakeKeys(count);
+
+    for (auto _ : state) {
+        Map map;
+        for (const auto key : keys)
+            Insert(map, key);
+        benchmark::DoNotOptimize(map);
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+
+BENCHMARK_TEMPLATE(FlatMap_Find, FlatMap)->RangeMultiplier(16)->Range(16, 1 << 20);
+BENCHMARK_TEMPLATE(FlatMap_Find, StdMap)->RangeMultiplier(16)->Range(16, 1 << 20);
+BENCHMARK_TEMPLATE(FlatMap_Find, StdUnorderedMap)->RangeMultiplier(16)->Range(16, 1 << 20);
+BENCHMARK_TEMPLATE(FlatMap_FindMissing, FlatMap)->RangeMultiplier(16)->Range(16, 1 << 20);
+BENCHMARK_TEMPLATE(FlatMap_FindMissing, StdMap)->RangeMultiplier(16)->Range(16, 1 << 20);
+BENCHMARK_TEMPLATE(FlatMap_FindMissing, StdUnorderedMap)->RangeMultiplier(16)->Range(16, 1 << 20);
+
+// Sorted insertion moves half of both columns per key, so random order builds stop before the quadratic cost dominates
+BENCHMARK_TEMPLATE(FlatMap_Insert, FlatMap)->RangeMultiplier(16)->Range(16, 1 << 16);
+BENCHMARK_TEMPLATE(FlatMap_Insert, StdMap)->RangeMultiplier(16)->Range(16, 1 << 16);
+BENCHMARK_TEMPLATE(FlatMap_Insert, StdUnorderedMap)->RangeMultiplier(16)->Range(16, 1 << 16);
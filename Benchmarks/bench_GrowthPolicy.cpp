@@ -0,0 +1,51 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Benchmark of vector growth policies
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <Kube/Core/Vector.hpp>
+
+using namespace kF;
+
+using Doubling = Core::DoublingGrowthPolicy;
+using OneAndHalf = Core::OneAndHalfGrowthPolicy;
+using SizeClass = Core::SizeClassGrowthPolicy<>;
+using Page = Core::PageGrowthPolicy<>;
+
+#define GENERATE_TESTS(TEST) \
+    TEST(Doubling) \
+    TEST(OneAndHalf) \
+    TEST(SizeClass) \
+    TEST(Page)
+
+/** @brief Push throughput, 'PeakBytes' is the largest footprint reached while relocating (old + new buffer)
+ *  and 'SlackBytes' the unused capacity left once every element is pushed */
+#define GROWTHPOLICY_PUSH(Policy) \
+static void GrowthPolicy_Push_##Policy(benchmark::State &state) \
+{ \
+    const auto count = static_cast<std::size_t>(state.range(0)); \
+    std::size_t peakBytes = 0ul, slackBytes = 0ul; \
+    for (auto _ : state) { \
+        Core::Vector<std::size_t, std::size_t, Policy> vector; \
+        for (auto i = 0ul; i < count; ++i) \
+            vector.push(i); \
+        benchmark::DoNotOptimize(vector.data()); \
+        slackBytes = (vector.capacity() - vector.size()) * sizeof(std::size_t); \
+    } \
+    Core::Vector<std::size_t, std::size_t, Policy> vector; \
+    for (auto i = 0ul, capacity = 0ul; i < count; ++i) { \
+        vector.push(i); \
+        if (vector.capacity() != capacity) { \
+            peakBytes = std::max(peakBytes, (capacity + vector.capacity()) * sizeof(std::size_t)); \
+            capacity = vector.capacity(); \
+        } \
+    } \
+    state.SetItemsProcessed(state.iterations() * count); \
+    state.counters["PeakBytes"] = static_cast<double>(peakBytes); \
+    state.counters["SlackBytes"] = static_cast<double>(slackBytes); \
+} \
+BENCHMARK(GrowthPolicy_Push_##Policy)->RangeMultiplier(16)->Range(16, 1 << 20);
+
+GENERATE_TESTS(GROWTHPOLICY_PUSH)
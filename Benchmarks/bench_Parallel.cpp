@@ -0,0 +1,71 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Benchmark of parallel construction, fill and destruction of large arrays
+ */
+
+#include <string>
+
+#include <benchmark/benchmark.h>
+
+#include <Kube/Core/HeapArray.hpp>
+#include <Kube/Core/Vector.hpp>
+
+using namespace kF;
+
+/** @brief Count of elements of each array */
+constexpr auto Count = 1ul << 22;
+
+/** @brief Non trivial element owning a heap buffer */
+constexpr auto LongString = "String that is long enough to not be small optimized";
+
+/** @brief Allocate and construct a heap array then release it, time includes the first touch of every page */
+template<typename Type>
+static void HeapArray_AllocateParallel(benchmark::State &state, const Type &value)
+{
+    const auto threadCount = static_cast<std::size_t>(state.range(0));
+
+    for (auto _ : state) {
+        Core::HeapArray<Type> array;
+        array.allocateParallel(Count, threadCount, value);
+        benchmark::DoNotOptimize(array.data());
+        array.releaseParallel(threadCount);
+    }
+    state.SetItemsProcessed(state.iterations() * Count);
+}
+
+/** @brief Resize a vector by copying an element then release it */
+template<typename Type>
+static void Vector_ResizeParallel(benchmark::State &state, const Type &value)
+{
+    const auto threadCount = static_cast<std::size_t>(state.range(0));
+
+    for (auto _ : state) {
+        Core::Vector<Type> vector;
+        vector.resizeParallel(Count, threadCount, value);
+        benchmark::DoNotOptimize(vector.data());
+        vector.releaseParallel(threadCount);
+    }
+    state.SetItemsProcessed(state.iterations() * Count);
+}
+
+/** @brief Fill an already allocated vector, without page faults */
+template<typename Type>
+static void Vector_RefillParallel(benchmark::State &state, const Type &value)
+{
+    const auto threadCount = static_cast<std::size_t>(state.range(0));
+    Core::Vector<Type> vector;
+    vector.resizeParallel(Count, threadCount, value);
+
+    for (auto _ : state) {
+        vector.resizeParallel(Count, threadCount, value);
+        benchmark::DoNotOptimize(vector.data());
+    }
+    state.SetItemsProcessed(state.iterations() * Count);
+}
+
+BENCHMARK_CAPTURE(HeapArray_AllocateParallel, Integer, 42ul)->RangeMultiplier(2)->Range(1, 16)->UseRealTime();
+BENCHMARK_CAPTURE(HeapArray_AllocateParallel, String, std::string(LongString))->RangeMultiplier(2)->Range(1, 16)->UseRealTime();
+BENCHMARK_CAPTURE(Vector_ResizeParallel, Integer, 42ul)->RangeMultiplier(2)->Range(1, 16)->UseRealTime();
+BENCHMARK_CAPTURE(Vector_ResizeParallel, String, std::string(LongString))->RangeMultiplier(2)->Range(1, 16)->UseRealTime();
+BENCHMARK_CAPTURE(Vector_RefillParallel, Integer, 42ul)->RangeMultiplier(2)->Range(1, 16)->UseRealTime();
+BENCHMARK_CAPTURE(Vector_RefillParallel, String, std::string(LongString))->RangeMultiplier(2)->Range(1, 16)->UseRealTime();
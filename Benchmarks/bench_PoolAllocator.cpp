@@ -0,0 +1,74 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Benchmark of PoolAllocator class
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <Kube/Core/PoolAllocator.hpp>
+
+using namespace kF;
+
+constexpr std::size_t BatchSize = 256;
+
+#define GENERATE_TESTS(TEST) \
+    TEST(16) \
+    TEST(64) \
+    TEST(512)
+
+#define ALLOCATOR_BATCH(Name, AllocateExpr, DeallocateExpr, Size) \
+static void Name##_Batch_##Size(benchmark::State &state) \
+{ \
+    void *ptrs[BatchSize]; \
+    for (auto _ : state) { \
+        for (auto &ptr : ptrs) { \
+            ptr = AllocateExpr; \
+            benchmark::DoNotOptimize(ptr); \
+        } \
+        for (auto ptr : ptrs) \
+            DeallocateExpr; \
+    } \
+    state.SetItemsProcessed(state.iterations() * BatchSize); \
+} \
+BENCHMARK(Name##_Batch_##Size)->ThreadRange(1, 16)->UseRealTime();
+
+#define POOLALLOCATOR_BATCH(Size) \
+    ALLOCATOR_BATCH(PoolAllocator, Core::PoolAllocator::Allocate(Size, alignof(std::size_t)), Core::PoolAllocator::Deallocate(ptr, Size, alignof(std::size_t)), Size)
+
+#define ALIGNEDALLOC_BATCH(Size) \
+    ALLOCATOR_BATCH(AlignedAlloc, Core::Utils::AlignedAlloc<alignof(std::size_t)>(Size), Core::Utils::AlignedFree(ptr), Size)
+
+GENERATE_TESTS(POOLALLOCATOR_BATCH)
+GENERATE_TESTS(ALIGNEDALLOC_BATCH)
+
+#define ALLOCATOR_CHURN(Name, AllocateExpr, DeallocateExpr) \
+static void Name##_Churn(benchmark::State &state) \
+{ \
+    constexpr std::size_t Sizes[] = { 24, 40, 72, 136, 264 }; \
+    void *ptrs[BatchSize] {}; \
+    std::size_t sizes[BatchSize] {}; \
+    std::size_t i = 0; \
+    for (auto _ : state) { \
+        const auto index = i % BatchSize; \
+        if (auto ptr = ptrs[index]; ptr) { \
+            const auto size = sizes[index]; \
+            DeallocateExpr; \
+        } \
+        const auto size = Sizes[i % std::size(Sizes)]; \
+        ptrs[index] = AllocateExpr; \
+        sizes[index] = size; \
+        benchmark::DoNotOptimize(ptrs[index]); \
+        ++i; \
+    } \
+    for (auto index = 0ul; index < BatchSize; ++index) { \
+        if (auto ptr = ptrs[index]; ptr) { \
+            const auto size = sizes[index]; \
+            DeallocateExpr; \
+        } \
+    } \
+    state.SetItemsProcessed(state.iterations()); \
+} \
+BENCHMARK(Name##_Churn)->ThreadRange(1, 16)->UseRealTime();
+
+ALLOCATOR_CHURN(PoolAllocator, Core::PoolAllocator::Allocate(size, alignof(std::size_t)), Core::PoolAllocator::Deallocate(ptr, size, alignof(std::size_t)))
+ALLOCATOR_CHURN(AlignedAlloc, Core::Utils::AlignedAlloc<alignof(std::size_t)>(size), (static_cast<void>(size), Core::Utils::AlignedFree(ptr)))
@@ -0,0 +1,69 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Benchmark of shared flat vectors against deep copies
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <Kube/Core/Vector.hpp>
+#include <Kube/Core/SharedFlatVector.hpp>
+
+using namespace kF;
+
+/** @brief Count of consumers receiving a copy of the table */
+constexpr auto FanOut = 16ul;
+
+template<typename Container>
+[[nodiscard]] static Container MakeTable(const std::size_t count)
+{
+    Core::FlatVector<std::size_t, std::size_t, Core::Internal::SharedFlatHeader> table;
+    table.pushN(count, [](const auto i) { return i; });
+    return Container(std::move(table));
+}
+
+/** @brief Copy a table to every consumer, each one reads a single element */
+template<typename Container>
+static void SharedFlatVector_FanOut(benchmark::State &state)
+{
+    const auto count = static_cast<std::size_t>(state.range(0));
+    const auto table = MakeTable<Container>(count);
+    Core::Vector<Container> consumers(FanOut);
+
+    for (auto _ : state) {
+        for (auto &consumer : consumers)
+            consumer = table;
+        std::size_t sum = 0;
+        for (const auto &consumer : consumers)
+            sum += consumer[count / 2];
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * FanOut);
+}
+
+/** @brief Copy a table to every consumer, a single one edits it */
+template<typename Container>
+static void SharedFlatVector_FanOutEdit(benchmark::State &state)
+{
+    const auto count = static_cast<std::size_t>(state.range(0));
+    const auto table = MakeTable<Container>(count);
+    Core::Vector<Container> consumers(FanOut);
+
+    for (auto _ : state) {
+        for (auto &consumer : consumers)
+            consumer = table;
+        if constexpr (requires { consumers[0].edit(); })
+            consumers[0].edit()[0] = 42;
+        else
+            consumers[0][0] = 42;
+        benchmark::DoNotOptimize(consumers[0].data());
+    }
+    state.SetItemsProcessed(state.iterations() * FanOut);
+}
+
+using FlatVector = Core::FlatVector<std::size_t, std::size_t, Core::Internal::SharedFlatHeader>;
+using SharedFlatVector = Core::SharedFlatVector<std::size_t>;
+
+BENCHMARK_TEMPLATE(SharedFlatVector_FanOut, FlatVector)->RangeMultiplier(16)->Range(16, 1 << 20);
+BENCHMARK_TEMPLATE(SharedFlatVector_FanOut, SharedFlatVector)->RangeMultiplier(16)->Range(16, 1 << 20);
+BENCHMARK_TEMPLATE(SharedFlatVector_FanOutEdit, FlatVector)->RangeMultiplier(16)->Range(16, 1 << 20);
+BENCHMARK_TEMPLATE(SharedFlatVector_FanOutEdit, SharedFlatVector)->RangeMultiplier(16)->Range(16, 1 << 20);
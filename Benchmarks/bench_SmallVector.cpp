@@ -0,0 +1,107 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Benchmark of small vectors moved and swapped inside a container
+ */
+
+#include <algorithm>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <Kube/Core/SmallVector.hpp>
+
+using namespace kF;
+
+/** @brief Element types, trivially relocatable or not */
+using Word = std::size_t;
+using Text = std::string;
+
+/** @brief Container aliases taking only an element type */
+template<typename Type>
+using StdVector = std::vector<Type>;
+template<typename Type>
+using SmallVector = Core::SmallVector<Type, 4>;
+template<typename Type>
+using TinySmallVector = Core::TinySmallVector<Type, 4>;
+template<typename Type>
+using CompactSmallVector = Core::CompactSmallVector<Type, 4>;
+
+/** @brief Push an element in any container */
+template<typename Container, typename Type>
+static void Push(Container &container, Type &&value)
+{
+    if constexpr (requires { container.push(std::forward<Type>(value)); })
+        container.push(std::forward<Type>(value));
+    else
+        container.push_back(std::forward<Type>(value));
+}
+
+/** @brief Build 'count' small containers, a fifth of them exceeds the small optimization */
+template<typename Container>
+[[nodiscard]] static std::vector<Container> MakeContainers(const std::size_t count)
+{
+    using Type = std::remove_cvref_t<decltype(*std::declval<Container &>().begin())>;
+
+    std::vector<Container> containers(count);
+    for (auto i = 0ul; i < count; ++i) {
+        for (auto j = 0ul, size = i % 5 + 2; j < size; ++j) {
+            if constexpr (std::is_same_v<Type, Text>)
+                Push(containers[i], std::to_string(i + j));
+            else
+                Push(containers[i], static_cast<Type>(i + j));
+        }
+    }
+    return containers;
+}
+
+template<typename Container>
+static void SmallVector_Shuffle(benchmark::State &state)
+{
+    const auto count = static_cast<std::size_t>(state.range(0));
+    auto containers = MakeContainers<Container>(count);
+    std::mt19937 engine(42);
+
+    for (auto _ : state) {
+        std::shuffle(containers.begin(), containers.end(), engine);
+        benchmark::DoNotOptimize(containers.data());
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+
+/** @brief Sort containers by their elements, the shuffle restoring the input is not measured */
+template<typename Container>
+static void SmallVector_Sort(benchmark::State &state)
+{
+    const auto count = static_cast<std::size_t>(state.range(0));
+    auto containers = MakeContainers<Container>(count);
+    std::mt19937 engine(42);
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        std::shuffle(containers.begin(), containers.end(), engine);
+        state.ResumeTiming();
+        std::sort(containers.begin(), containers.end(), [](const auto &lhs, const auto &rhs) {
+            return std::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+        });
+        benchmark::DoNotOptimize(containers.data());
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+
+#define SMALLVECTOR_BENCHMARK(Operation, Container, Type) \
+    BENCHMARK_TEMPLATE(SmallVector_##Operation, Container<Type>)->RangeMultiplier(16)->Range(256, 1 << 20);
+
+#define GENERATE_CONTAINER_BENCHMARKS(Container, Type) \
+    SMALLVECTOR_BENCHMARK(Shuffle, Container, Type) \
+    SMALLVECTOR_BENCHMARK(Sort, Container, Type)
+
+#define GENERATE_TYPE_BENCHMARKS(Type) \
+    GENERATE_CONTAINER_BENCHMARKS(StdVector, Type) \
+    GENERATE_CONTAINER_BENCHMARKS(SmallVector, Type) \
+    GENERATE_CONTAINER_BENCHMARKS(TinySmallVector, Type) \
+    GENERATE_CONTAINER_BENCHMARKS(CompactSmallVector, Type)
+
+GENERATE_TYPE_BENCHMARKS(Word)
+GENERATE_TYPE_BENCHMARKS(Text)
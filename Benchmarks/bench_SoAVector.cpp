@@ -0,0 +1,115 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Benchmark of structure-of-arrays against array-of-structures on partial field iteration
+ */
+
+#include <array>
+
+#include <benchmark/benchmark.h>
+
+#include <Kube/Core/Vector.hpp>
+#include <Kube/Core/SoAVector.hpp>
+
+using namespace kF;
+
+/** @brief Cacheline sized component */
+struct Particle
+{
+    float x {}, y {}, z {};
+    float vx {}, vy {}, vz {};
+    float mass {};
+    std::uint32_t id {};
+    double lifetime {};
+    std::uint64_t flags[3] {};
+};
+
+static_assert_sizeof(Particle, 64);
+
+using Particles = Core::SoAVector<float, float, float, float, float, float, float, std::uint32_t, double, std::array<std::uint64_t, 3>>;
+
+constexpr float DeltaTime = 1.0f / 60.0f;
+
+[[nodiscard]] static Core::Vector<Particle> MakeAoS(const std::size_t count)
+{
+    Core::Vector<Particle> particles;
+    particles.pushN(count, [](const auto i) {
+        const auto value = static_cast<float>(i);
+        return Particle { .x = value, .y = value, .z = value, .vx = 1.0f, .vy = 2.0f, .vz = 3.0f, .mass = value, .id = static_cast<std::uint32_t>(i) };
+    });
+    return particles;
+}
+
+[[nodiscard]] static Particles MakeSoA(const std::size_t count)
+{
+    Particles particles;
+    particles.reserve(count);
+    for (auto i = 0ul; i < count; ++i) {
+        const auto value = static_cast<float>(i);
+        particles.push(value, value, value, 1.0f, 2.0f, 3.0f, value, static_cast<std::uint32_t>(i), 0.0, std::array<std::uint64_t, 3> {});
+    }
+    return particles;
+}
+
+/** @brief Integrate positions, reading 6 of the 10 fields */
+static void AoS_Integrate(benchmark::State &state)
+{
+    auto particles = MakeAoS(static_cast<std::size_t>(state.range(0)));
+
+    for (auto _ : state) {
+        for (auto &particle : particles) {
+            particle.x += particle.vx * DeltaTime;
+            particle.y += particle.vy * DeltaTime;
+            particle.z += particle.vz * DeltaTime;
+        }
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static void SoA_Integrate(benchmark::State &state)
+{
+    auto particles = MakeSoA(static_cast<std::size_t>(state.range(0)));
+
+    for (auto _ : state) {
+        auto [x, y, z, vx, vy, vz] = particles.columns<0, 1, 2, 3, 4, 5>();
+        for (auto i = 0ul; i < x.size(); ++i) {
+            x[i] += vx[i] * DeltaTime;
+            y[i] += vy[i] * DeltaTime;
+            z[i] += vz[i] * DeltaTime;
+        }
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+/** @brief Sum the mass, reading a single field */
+static void AoS_SumMass(benchmark::State &state)
+{
+    const auto particles = MakeAoS(static_cast<std::size_t>(state.range(0)));
+
+    for (auto _ : state) {
+        float sum = 0.0f;
+        for (const auto &particle : particles)
+            sum += particle.mass;
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static void SoA_SumMass(benchmark::State &state)
+{
+    const auto particles = MakeSoA(static_cast<std::size_t>(state.range(0)));
+
+    for (auto _ : state) {
+        float sum = 0.0f;
+        for (const auto mass : particles.column<6>())
+            sum += mass;
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(AoS_Integrate)->RangeMultiplier(16)->Range(1 << 10, 1 << 22);
+BENCHMARK(SoA_Integrate)->RangeMultiplier(16)->Range(1 << 10, 1 << 22);
+BENCHMARK(AoS_SumMass)->RangeMultiplier(16)->Range(1 << 10, 1 << 22);
+BENCHMARK(SoA_SumMass)->RangeMultiplier(16)->Range(1 << 10, 1 << 22);
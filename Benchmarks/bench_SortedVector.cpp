@@ -0,0 +1,98 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Benchmark of sorted vector lookups, binary search against SIMD search and a frozen Eytzinger index
+ */
+
+#include <random>
+
+#include <benchmark/benchmark.h>
+
+#include <Kube/Core/Vector.hpp>
+#include <Kube/Core/SortedVector.hpp>
+
+using namespace kF;
+
+/** @brief Count of lookups per iteration */
+constexpr auto LookupCount = 1024ul;
+
+/** @brief Build a sorted vector of 'count' odd keys and a list of random lookups, half of them missing */
+template<typename Type>
+static void MakeLookups(const std::size_t count, Core::SortedVector<Type> &vector, Core::Vector<Type> &lookups)
+{
+    std::mt19937_64 engine(42);
+
+    vector.pushN(count, [](const auto i) { return static_cast<Type>(i * 2 + 1); });
+    lookups.pushN(LookupCount, [&](const auto) { return static_cast<Type>(engine() % (count * 2)); });
+}
+
+/** @brief Lookup with a binary search over the sorted array */
+template<typename Type>
+static void SortedVector_LowerBound(benchmark::State &state)
+{
+    const auto count = static_cast<std::size_t>(state.range(0));
+    Core::SortedVector<Type> vector;
+    Core::Vector<Type> lookups;
+
+    MakeLookups(count, vector, lookups);
+    for (auto _ : state) {
+        std::size_t sum = 0;
+        for (const auto key : lookups)
+            sum += static_cast<std::size_t>(std::lower_bound(vector.begin(), vector.end(), key) - vector.begin());
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * LookupCount);
+}
+
+/** @brief Lookup with a frozen index */
+template<typename Type>
+static void SortedVector_FrozenLowerBound(benchmark::State &state)
+{
+    const auto count = static_cast<std::size_t>(state.range(0));
+    Core::SortedVector<Type> vector;
+    Core::Vector<Type> lookups;
+
+    MakeLookups(count, vector, lookups);
+    const auto index = vector.freeze();
+    for (auto _ : state) {
+        std::size_t sum = 0;
+        for (const auto key : lookups)
+            sum += index.lowerBound(key);
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * LookupCount);
+}
+
+BENCHMARK_TEMPLATE(SortedVector_LowerBound, std::uint32_t)->RangeMultiplier(16)->Range(16, 1 << 24);
+BENCHMARK_TEMPLATE(SortedVector_FrozenLowerBound, std::uint32_t)->RangeMultiplier(16)->Range(16, 1 << 24);
+BENCHMARK_TEMPLATE(SortedVector_LowerBound, std::uint64_t)->RangeMultiplier(16)->Range(16, 1 << 24);
+BENCHMARK_TEMPLATE(SortedVector_FrozenLowerBound, std::uint64_t)->RangeMultiplier(16)->Range(16, 1 << 24);
+
+/** @brief Latency of dependent lookups, each key depends on the previous result */
+template<typename Type, bool UseSimd>
+static void SortedVector_LookupLatency(benchmark::State &state)
+{
+    const auto count = static_cast<std::size_t>(state.range(0));
+    Core::SortedVector<Type> vector;
+    Core::Vector<Type> lookups;
+
+    MakeLookups(count, vector, lookups);
+    for (auto _ : state) {
+        std::size_t last = 0;
+        for (const auto key : lookups) {
+            const auto dependentKey = static_cast<Type>(key + static_cast<Type>(last & 1));
+            if constexpr (UseSimd)
+                last = static_cast<std::size_t>(vector.lowerBound(dependentKey) - vector.begin());
+            else
+                last = static_cast<std::size_t>(std::lower_bound(vector.begin(), vector.end(), dependentKey) - vector.begin());
+        }
+        benchmark::DoNotOptimize(last);
+    }
+    state.SetItemsProcessed(state.iterations() * LookupCount);
+}
+
+BENCHMARK_TEMPLATE(SortedVector_LookupLatency, std::uint32_t, false)->RangeMultiplier(4)->Range(64, 1 << 24);
+BENCHMARK_TEMPLATE(SortedVector_LookupLatency, std::uint32_t, true)->RangeMultiplier(4)->Range(64, 1 << 24);
+BENCHMARK_TEMPLATE(SortedVector_LookupLatency, float, false)->RangeMultiplier(4)->Range(64, 1 << 24);
+BENCHMARK_TEMPLATE(SortedVector_LookupLatency, float, true)->RangeMultiplier(4)->Range(64, 1 << 24);
+BENCHMARK_TEMPLATE(SortedVector_LookupLatency, std::uint64_t, false)->RangeMultiplier(4)->Range(64, 1 << 24);
+BENCHMARK_TEMPLATE(SortedVector_LookupLatency, std::uint64_t, true)->RangeMultiplier(4)->Range(64, 1 << 24);
@@ -0,0 +1,273 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Benchmark of every vector variant against std::vector
+ */
+
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <Kube/Core/Vector.hpp>
+#include <Kube/Core/SmallVector.hpp>
+#include <Kube/Core/FlatVector.hpp>
+#include <Kube/Core/AllocatedVector.hpp>
+#include <Kube/Core/AllocatedSmallVector.hpp>
+#include <Kube/Core/AllocatedFlatVector.hpp>
+#include <Kube/Core/HeapArray.hpp>
+#include <Kube/Core/PoolAllocator.hpp>
+
+using namespace kF;
+
+/** @brief Element types, from 1 byte to a non-trivial type */
+using Byte = std::uint8_t;
+using Word = std::size_t;
+struct Line { std::size_t values[8] {}; };
+using Text = std::string;
+
+/** @brief Container aliases taking only an element type */
+template<typename Type>
+using StdVector = std::vector<Type>;
+template<typename Type>
+using Vector = Core::Vector<Type>;
+template<typename Type>
+using TinyVector = Core::TinyVector<Type>;
+template<typename Type>
+using SmallVector = Core::SmallVector<Type, 8>;
+template<typename Type>
+using CompactSmallVector = Core::CompactSmallVector<Type, 8>;
+template<typename Type>
+using FlatVector = Core::FlatVector<Type>;
+template<typename Type>
+using AllocatedVector = Core::AllocatedVector<Type, &Core::PoolAllocator::Allocate, &Core::PoolAllocator::Deallocate>;
+template<typename Type>
+using AllocatedSmallVector = Core::AllocatedSmallVector<Type, 8, &Core::PoolAllocator::Allocate, &Core::PoolAllocator::Deallocate>;
+template<typename Type>
+using AllocatedFlatVector = Core::AllocatedFlatVector<Type, &Core::PoolAllocator::Allocate, &Core::PoolAllocator::Deallocate>;
+template<typename Type>
+using HeapArray = Core::HeapArray<Type>;
+
+/** @brief Build the i-th value of an element type */
+template<typename Type>
+[[nodiscard]] static Type MakeValue(const std::size_t i) noexcept
+{
+    if constexpr (std::is_same_v<Type, Text>)
+        return "Non small optimized string #" + std::to_string(i);
+    else if constexpr (std::is_same_v<Type, Line>)
+        return Line { { i, i, i, i, i, i, i, i } };
+    else
+        return static_cast<Type>(i);
+}
+
+/** @brief Reduce an element to a number so iteration can't be optimized away */
+template<typename Type>
+[[nodiscard]] static std::size_t Reduce(const Type &value) noexcept
+{
+    if constexpr (std::is_same_v<Type, Text>)
+        return value.size();
+    else if constexpr (std::is_same_v<Type, Line>)
+        return value.values[0];
+    else
+        return static_cast<std::size_t>(value);
+}
+
+/** @brief Push an element in any container */
+template<typename Container, typename Type>
+static void Push(Container &container, Type &&value)
+{
+    if constexpr (requires { container.push(std::forward<Type>(value)); })
+        container.push(std::forward<Type>(value));
+    else
+        container.push_back(std::forward<Type>(value));
+}
+
+/** @brief Pop an element of any container */
+template<typename Container>
+static void Pop(Container &container)
+{
+    if constexpr (requires { container.pop(); })
+        container.pop();
+    else
+        container.pop_back();
+}
+
+/** @brief Fill a container with 'count' elements */
+template<typename Container>
+[[nodiscard]] static Container MakeContainer(const std::size_t count)
+{
+    using Type = std::remove_cvref_t<decltype(*std::declval<Container &>().begin())>;
+
+    if constexpr (std::is_same_v<Container, HeapArray<Type>>) {
+        Container container(count);
+        for (auto i = 0ul; i < count; ++i)
+            container[i] = MakeValue<Type>(i);
+        return container;
+    } else {
+        Container container;
+        for (auto i = 0ul; i < count; ++i)
+            Push(container, MakeValue<Type>(i));
+        return container;
+    }
+}
+
+/** @brief Counts from 4 to 10M, large counts are skipped when a container would exceed 256MiB */
+template<typename Type>
+static void Counts(benchmark::internal::Benchmark *benchmark)
+{
+    constexpr std::size_t MaxBytes = 256ul * 1024 * 1024;
+    constexpr std::size_t Counts[] = { 4, 64, 1024, 16 * 1024, 256 * 1024, 4 * 1024 * 1024, 10 * 1000 * 1000 };
+
+    for (const auto count : Counts) {
+        if (count * sizeof(Type) <= MaxBytes)
+            benchmark->Arg(static_cast<std::int64_t>(count));
+    }
+}
+
+template<typename Container>
+static void Vector_Push(benchmark::State &state)
+{
+    using Type = std::remove_cvref_t<decltype(*std::declval<Container &>().begin())>;
+    const auto count = static_cast<std::size_t>(state.range(0));
+    const auto value = MakeValue<Type>(42);
+
+    for (auto _ : state) {
+        Container container;
+        for (auto i = 0ul; i < count; ++i)
+            Push(container, value);
+        benchmark::DoNotOptimize(container.data());
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+
+/** @brief Insert one element at 'numerator / 4' of the container, then pop the last element to keep its size */
+template<typename Container, std::size_t Numerator>
+static void Vector_Insert(benchmark::State &state)
+{
+    using Type = std::remove_cvref_t<decltype(*std::declval<Container &>().begin())>;
+    auto container = MakeContainer<Container>(static_cast<std::size_t>(state.range(0)));
+    const auto value = MakeValue<Type>(42);
+
+    for (auto _ : state) {
+        container.insert(container.begin() + container.size() * Numerator / 4, value);
+        Pop(container);
+        benchmark::DoNotOptimize(container.data());
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+template<typename Container>
+static void Vector_InsertFront(benchmark::State &state) { Vector_Insert<Container, 0>(state); }
+
+template<typename Container>
+static void Vector_InsertMiddle(benchmark::State &state) { Vector_Insert<Container, 2>(state); }
+
+/** @brief Erase the middle element, then push one to keep the container size */
+template<typename Container>
+static void Vector_EraseMiddle(benchmark::State &state)
+{
+    using Type = std::remove_cvref_t<decltype(*std::declval<Container &>().begin())>;
+    auto container = MakeContainer<Container>(static_cast<std::size_t>(state.range(0)));
+    const auto value = MakeValue<Type>(42);
+
+    for (auto _ : state) {
+        container.erase(container.begin() + container.size() / 2);
+        Push(container, value);
+        benchmark::DoNotOptimize(container.data());
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+template<typename Container>
+static void Vector_Iterate(benchmark::State &state)
+{
+    const auto count = static_cast<std::size_t>(state.range(0));
+    const auto container = MakeContainer<Container>(count);
+
+    for (auto _ : state) {
+        std::size_t sum = 0;
+        for (const auto &value : container)
+            sum += Reduce(value);
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+
+template<typename Container>
+static void Vector_Copy(benchmark::State &state)
+{
+    const auto count = static_cast<std::size_t>(state.range(0));
+    const auto container = MakeContainer<Container>(count);
+
+    for (auto _ : state) {
+        Container copy(container);
+        benchmark::DoNotOptimize(copy.data());
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+
+/** @brief Move the container out and back, small vectors relocate their cache */
+template<typename Container>
+static void Vector_Move(benchmark::State &state)
+{
+    auto container = MakeContainer<Container>(static_cast<std::size_t>(state.range(0)));
+
+    for (auto _ : state) {
+        Container tmp(std::move(container));
+        benchmark::DoNotOptimize(tmp.data());
+        container = std::move(tmp);
+        benchmark::DoNotOptimize(container.data());
+    }
+    state.SetItemsProcessed(state.iterations() * 2);
+}
+
+template<typename Container>
+static void Vector_Swap(benchmark::State &state)
+{
+    const auto count = static_cast<std::size_t>(state.range(0));
+    auto lhs = MakeContainer<Container>(count);
+    auto rhs = MakeContainer<Container>(count);
+
+    for (auto _ : state) {
+        lhs.swap(rhs);
+        benchmark::DoNotOptimize(lhs.data());
+        benchmark::DoNotOptimize(rhs.data());
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+#define VECTOR_BENCHMARK(Operation, Container, Type) \
+    BENCHMARK_TEMPLATE(Vector_##Operation, Container<Type>)->Apply(Counts<Type>);
+
+/** @brief Operations available on every growable container */
+#define GENERATE_VECTOR_BENCHMARKS(Container, Type) \
+    VECTOR_BENCHMARK(Push, Container, Type) \
+    VECTOR_BENCHMARK(InsertFront, Container, Type) \
+    VECTOR_BENCHMARK(InsertMiddle, Container, Type) \
+    VECTOR_BENCHMARK(EraseMiddle, Container, Type) \
+    VECTOR_BENCHMARK(Iterate, Container, Type) \
+    VECTOR_BENCHMARK(Copy, Container, Type) \
+    VECTOR_BENCHMARK(Move, Container, Type) \
+    VECTOR_BENCHMARK(Swap, Container, Type)
+
+/** @brief Operations available on fixed size arrays */
+#define GENERATE_ARRAY_BENCHMARKS(Container, Type) \
+    VECTOR_BENCHMARK(Iterate, Container, Type) \
+    VECTOR_BENCHMARK(Move, Container, Type) \
+    VECTOR_BENCHMARK(Swap, Container, Type)
+
+#define GENERATE_TYPE_BENCHMARKS(Type) \
+    GENERATE_VECTOR_BENCHMARKS(StdVector, Type) \
+    GENERATE_VECTOR_BENCHMARKS(Vector, Type) \
+    GENERATE_VECTOR_BENCHMARKS(TinyVector, Type) \
+    GENERATE_VECTOR_BENCHMARKS(SmallVector, Type) \
+    GENERATE_VECTOR_BENCHMARKS(CompactSmallVector, Type) \
+    GENERATE_VECTOR_BENCHMARKS(FlatVector, Type) \
+    GENERATE_VECTOR_BENCHMARKS(AllocatedVector, Type) \
+    GENERATE_VECTOR_BENCHMARKS(AllocatedSmallVector, Type) \
+    GENERATE_VECTOR_BENCHMARKS(AllocatedFlatVector, Type) \
+    GENERATE_ARRAY_BENCHMARKS(HeapArray, Type)
+
+GENERATE_TYPE_BENCHMARKS(Byte)
+GENERATE_TYPE_BENCHMARKS(Word)
+GENERATE_TYPE_BENCHMARKS(Line)
+GENERATE_TYPE_BENCHMARKS(Text)
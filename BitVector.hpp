@@ -0,0 +1,24 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: BitVector
+ */
+
+#pragma once
+
+#include "PackedVector.hpp"
+
+namespace kF::Core
+{
+    /**
+     * @brief Vector of booleans packed into 64 bits words
+     *
+     * @tparam Range Range of container
+     * @tparam GrowthPolicy Capacity growth policy of the words
+     */
+    template<std::integral Range = std::size_t, typename GrowthPolicy = DefaultGrowthPolicy>
+    using BitVector = PackedVector<1, Range, GrowthPolicy>;
+
+    /** @brief 16 bytes bit vector with a reduced range */
+    template<typename GrowthPolicy = DefaultGrowthPolicy>
+    using TinyBitVector = BitVector<std::uint32_t, GrowthPolicy>;
+}
@@ -0,0 +1,136 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: CompactSmallVectorBase
+ */
+
+#pragma once
+
+#include <limits>
+
+#include "Utils.hpp"
+
+namespace kF::Core::Internal
+{
+    template<typename Type, std::size_t OptimizedCapacity, std::integral Range>
+    class CompactSmallVectorBase;
+}
+
+/** @brief Base implementation of a small vector whose cache shares its storage with the heap pointer and capacity
+ *  The highest bit of the size tells if the vector spilled on the heap, thus the maximum size is halved
+ *  A released vector is tagged as spilled with a null heap pointer */
+template<typename Type, std::size_t OptimizedCapacity, std::integral Range>
+class kF::Core::Internal::CompactSmallVectorBase
+{
+public:
+    static_assert(OptimizedCapacity > 0, "CompactSmallVectorBase: OptimizedCapacity must not be null");
+    static_assert(std::is_unsigned_v<Range>, "CompactSmallVectorBase: Range must be unsigned to store the heap tag");
+
+    /** @brief Output iterator */
+    using Iterator = Type *;
+
+    /** @brief Input iterator */
+    using ConstIterator = const Type *;
+
+
+    /** @brief Always safe ! */
+    [[nodiscard]] constexpr bool isSafe(void) const noexcept { return true; }
+
+    /** @brief Fast empty check */
+    [[nodiscard]] bool empty(void) const noexcept { return !sizeUnsafe(); }
+
+
+    /** @brief Get internal data pointer */
+    [[nodiscard]] Type *data(void) noexcept { return dataUnsafe(); }
+    [[nodiscard]] const Type *data(void) const noexcept { return dataUnsafe(); }
+    [[nodiscard]] Type *dataUnsafe(void) noexcept { return isCacheUsed() ? optimizedData() : _storage.heap.data; }
+    [[nodiscard]] const Type *dataUnsafe(void) const noexcept { return isCacheUsed() ? optimizedData() : _storage.heap.data; }
+
+
+    /** @brief Get the size of the vector */
+    [[nodiscard]] Range size(void) const noexcept { return sizeUnsafe(); }
+    [[nodiscard]] Range sizeUnsafe(void) const noexcept { return static_cast<Range>(_size & ~HeapTag); }
+
+
+    /** @brief Get the capacity of the vector */
+    [[nodiscard]] Range capacity(void) const noexcept { return capacityUnsafe(); }
+    [[nodiscard]] Range capacityUnsafe(void) const noexcept
+        { return isCacheUsed() ? static_cast<Range>(OptimizedCapacity) : _storage.heap.capacity; }
+
+
+    /** @brief Unsafe begin / end overloads */
+    [[nodiscard]] Iterator beginUnsafe(void) noexcept { return data(); }
+    [[nodiscard]] Iterator endUnsafe(void) noexcept { return data() + sizeUnsafe(); }
+    [[nodiscard]] ConstIterator beginUnsafe(void) const noexcept { return data(); }
+    [[nodiscard]] ConstIterator endUnsafe(void) const noexcept { return data() + sizeUnsafe(); }
+
+    /** @brief Begin / end overloads */
+    [[nodiscard]] Iterator begin(void) noexcept { return beginUnsafe(); }
+    [[nodiscard]] Iterator end(void) noexcept { return endUnsafe(); }
+    [[nodiscard]] ConstIterator begin(void) const noexcept { return beginUnsafe(); }
+    [[nodiscard]] ConstIterator end(void) const noexcept { return endUnsafe(); }
+
+
+    /** @brief Steal another instance */
+    void steal(CompactSmallVectorBase &other) noexcept(nothrow_forward_constructible(Type) && nothrow_destructible(Type));
+
+    /** @brief Swap two instances */
+    void swap(CompactSmallVectorBase &other) noexcept(nothrow_forward_constructible(Type) && nothrow_destructible(Type));
+
+
+    /** @brief Tell if the vector currently use its cache or a heap allocation*/
+    [[nodiscard]] bool isCacheUsed(void) const noexcept
+        { return !(_size & HeapTag); }
+
+protected:
+    /** @brief Protected data setter, only the cache clears the heap tag and null also resets the capacity */
+    void setData(Type * const data) noexcept;
+
+    /** @brief Protected size setter */
+    void setSize(const Range size) noexcept { _size = static_cast<Range>(size | (_size & HeapTag)); }
+
+    /** @brief Protected capacity setter, ignored while the cache is used */
+    void setCapacity(const Range capacity) noexcept
+        { if (!isCacheUsed()) _storage.heap.capacity = capacity; }
+
+
+    /** @brief Allocates a new buffer */
+    [[nodiscard]] Type *allocate(const Range capacity) noexcept;
+
+    /** @brief Deallocates a buffer */
+    void deallocate(Type * const data, const Range capacity) noexcept;
+
+    /** @brief Get a pointer to the data cache */
+    [[nodiscard]] Type *optimizedData(void) noexcept
+        { return reinterpret_cast<Type *>(&_storage.cache); }
+    [[nodiscard]] const Type *optimizedData(void) const noexcept
+        { return reinterpret_cast<const Type *>(&_storage.cache); }
+
+private:
+    /** @brief Tag bit of the size telling if the vector spilled on the heap */
+    static constexpr Range HeapTag = static_cast<Range>(Range(1) << (std::numeric_limits<Range>::digits - 1));
+
+    /** @brief Heap state, only valid once spilled */
+    struct Heap
+    {
+        Type *data;
+        Range capacity;
+    };
+
+    /** @brief Cache and heap state share the same storage */
+    union Storage
+    {
+        Heap heap;
+        alignas(alignof(Type)) std::byte cache[sizeof(Type) * OptimizedCapacity];
+    };
+
+    Storage _storage {};
+    Range _size { HeapTag };
+};
+
+/** @brief CompactSmallVectorBase never points to itself, it is relocatable if its elements are */
+template<typename Type, std::size_t OptimizedCapacity, std::integral Range>
+struct kF::Core::IsTriviallyRelocatable<kF::Core::Internal::CompactSmallVectorBase<Type, OptimizedCapacity, Range>>
+    : public kF::Core::IsTriviallyRelocatable<Type>
+{};
+
+#include "CompactSmallVectorBase.ipp"
@@ -0,0 +1,72 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: CompactSmallVectorBase
+ */
+
+template<typename Type, std::size_t OptimizedCapacity, std::integral Range>
+inline void kF::Core::Internal::CompactSmallVectorBase<Type, OptimizedCapacity, Range>::steal(CompactSmallVectorBase &other)
+    noexcept(nothrow_forward_constructible(Type) && nothrow_destructible(Type))
+{
+    std::destroy(beginUnsafe(), endUnsafe());
+    if (!isCacheUsed() && _storage.heap.data)
+        deallocate(_storage.heap.data, _storage.heap.capacity);
+    if constexpr (IsTriviallyRelocatable<Type>::Value)
+        std::memcpy(&_storage, &other._storage, sizeof(_storage));
+    else if (other.isCacheUsed())
+        Utils::RelocateForward(other.beginUnsafe(), other.endUnsafe(), optimizedData());
+    else
+        _storage.heap = other._storage.heap;
+    _size = other._size;
+    other._storage.heap = Heap {};
+    other._size = HeapTag;
+}
+
+template<typename Type, std::size_t OptimizedCapacity, std::integral Range>
+inline void kF::Core::Internal::CompactSmallVectorBase<Type, OptimizedCapacity, Range>::swap(CompactSmallVectorBase &other)
+    noexcept(nothrow_forward_constructible(Type) && nothrow_destructible(Type))
+{
+    if constexpr (IsTriviallyRelocatable<Type>::Value) {
+        Storage tmp;
+        std::memcpy(&tmp, &_storage, sizeof(_storage));
+        std::memcpy(&_storage, &other._storage, sizeof(_storage));
+        std::memcpy(&other._storage, &tmp, sizeof(_storage));
+        std::swap(_size, other._size);
+    } else if (!isCacheUsed() && !other.isCacheUsed()) {
+        std::swap(_storage.heap, other._storage.heap);
+        std::swap(_size, other._size);
+    } else {
+        CompactSmallVectorBase tmp;
+        tmp.steal(other);
+        other.steal(*this);
+        steal(tmp);
+    }
+}
+
+template<typename Type, std::size_t OptimizedCapacity, std::integral Range>
+inline void kF::Core::Internal::CompactSmallVectorBase<Type, OptimizedCapacity, Range>::setData(Type * const data) noexcept
+{
+    if (data == optimizedData()) {
+        _size = static_cast<Range>(_size & ~HeapTag);
+    } else {
+        if (!data) [[unlikely]]
+            _storage.heap.capacity = Range {};
+        _storage.heap.data = data;
+        _size = static_cast<Range>(_size | HeapTag);
+    }
+}
+
+template<typename Type, std::size_t OptimizedCapacity, std::integral Range>
+inline Type *kF::Core::Internal::CompactSmallVectorBase<Type, OptimizedCapacity, Range>::allocate(const Range capacity) noexcept
+{
+    if (capacity <= OptimizedCapacity) [[likely]]
+        return optimizedData();
+    else
+        return reinterpret_cast<Type *>(Utils::AlignedAlloc<alignof(Type)>(sizeof(Type) * capacity));
+}
+
+template<typename Type, std::size_t OptimizedCapacity, std::integral Range>
+inline void kF::Core::Internal::CompactSmallVectorBase<Type, OptimizedCapacity, Range>::deallocate(Type * const data, const Range) noexcept
+{
+    if (data != optimizedData()) [[unlikely]]
+        Utils::AlignedFree(data);
+}
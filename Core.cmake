@@ -12,24 +12,66 @@ set(KubeCoreSources
     ${KubeCoreDir}/AllocatedString.hpp
     ${KubeCoreDir}/AllocatedVector.hpp
     ${KubeCoreDir}/AllocatedVectorBase.hpp
+    ${KubeCoreDir}/AllocationPolicy.hpp
+    ${KubeCoreDir}/AllocationPolicy.ipp
+    ${KubeCoreDir}/ArenaAllocator.hpp
+    ${KubeCoreDir}/ArenaAllocator.ipp
     ${KubeCoreDir}/Assert.hpp
+    ${KubeCoreDir}/BTreeDetails.hpp
+    ${KubeCoreDir}/BTreeDetails.ipp
+    ${KubeCoreDir}/BTreeMap.hpp
+    ${KubeCoreDir}/BTreeSet.hpp
+    ${KubeCoreDir}/BitVector.hpp
+    ${KubeCoreDir}/CompactSmallVectorBase.hpp
+    ${KubeCoreDir}/CompactSmallVectorBase.ipp
     ${KubeCoreDir}/Dispatcher.hpp
     ${KubeCoreDir}/DispatcherDetails.hpp
+    ${KubeCoreDir}/EytzingerIndex.hpp
+    ${KubeCoreDir}/EytzingerIndex.ipp
+    ${KubeCoreDir}/FlatImage.hpp
+    ${KubeCoreDir}/FlatImage.ipp
+    ${KubeCoreDir}/FlatMap.hpp
+    ${KubeCoreDir}/FlatMapDetails.hpp
+    ${KubeCoreDir}/FlatMapDetails.ipp
+    ${KubeCoreDir}/FlatSet.hpp
+    ${KubeCoreDir}/FlatSetDetails.hpp
+    ${KubeCoreDir}/FlatSetDetails.ipp
     ${KubeCoreDir}/FlatString.hpp
     ${KubeCoreDir}/FlatVector.hpp
     ${KubeCoreDir}/FlatVectorBase.hpp
     ${KubeCoreDir}/FlatVectorBase.ipp
     ${KubeCoreDir}/Functor.hpp
+    ${KubeCoreDir}/GrowthPolicy.hpp
     ${KubeCoreDir}/Hash.hpp
     ${KubeCoreDir}/HeapArray.hpp
     ${KubeCoreDir}/HeapArray.ipp
+    ${KubeCoreDir}/InlineVector.hpp
+    ${KubeCoreDir}/InlineVectorBase.hpp
+    ${KubeCoreDir}/InlineVectorBase.ipp
     ${KubeCoreDir}/MacroUtils.hpp
     ${KubeCoreDir}/MPMCQueue.hpp
     ${KubeCoreDir}/MPMCQueue.ipp
+    ${KubeCoreDir}/PackedVector.hpp
+    ${KubeCoreDir}/PackedVector.ipp
+    ${KubeCoreDir}/Parallel.hpp
+    ${KubeCoreDir}/Parallel.ipp
+    ${KubeCoreDir}/PoolAllocator.hpp
+    ${KubeCoreDir}/PoolAllocator.ipp
+    ${KubeCoreDir}/SharedFlatDetails.hpp
+    ${KubeCoreDir}/SharedFlatDetails.ipp
+    ${KubeCoreDir}/SharedFlatString.hpp
+    ${KubeCoreDir}/SharedFlatVector.hpp
+    ${KubeCoreDir}/SimdSearch.hpp
+    ${KubeCoreDir}/SimdSearch.ipp
     ${KubeCoreDir}/SmallString.hpp
     ${KubeCoreDir}/SmallVector.hpp
     ${KubeCoreDir}/SmallVectorBase.hpp
     ${KubeCoreDir}/SmallVectorBase.ipp
+    ${KubeCoreDir}/SoAHeapArray.hpp
+    ${KubeCoreDir}/SoAHeapArray.ipp
+    ${KubeCoreDir}/SoALayout.hpp
+    ${KubeCoreDir}/SoAVector.hpp
+    ${KubeCoreDir}/SoAVector.ipp
     ${KubeCoreDir}/SortedAllocatedFlatVector.hpp
     ${KubeCoreDir}/SortedAllocatedSmallVector.hpp
     ${KubeCoreDir}/SortedAllocatedVector.hpp
@@ -60,9 +102,12 @@ set(KubeCoreSources
 
 add_library(${PROJECT_NAME} INTERFACE ${KubeCoreSources})
 
-# target_link_libraries(${PROJECT_NAME}
-# PUBLIC
-# )
+find_package(Threads REQUIRED)
+
+target_link_libraries(${PROJECT_NAME}
+INTERFACE
+    Threads::Threads
+)
 
 if(${KF_TESTS})
     include(${KubeCoreDir}/Tests/CoreTests.cmake)
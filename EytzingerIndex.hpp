@@ -0,0 +1,100 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: EytzingerIndex
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <bit>
+
+#include "HeapArray.hpp"
+
+namespace kF::Core
+{
+    /**
+     * @brief Read-only search index over a sorted range, keys are copied in breadth-first (Eytzinger) order
+     * The top levels of the implicit tree share a few cache lines and the descendants of a node are prefetched
+     * several levels ahead, lookups are branchless and return ranks in the sorted range
+     * The index is a snapshot, it must be rebuilt once its source is modified
+     *
+     * @tparam Type Key type
+     * @tparam Range Range of the indexed container
+     * @tparam Compare Compare operator the source range is sorted with
+     */
+    template<typename Type, std::integral Range = std::size_t, typename Compare = std::less<Type>>
+    class EytzingerIndex;
+}
+
+template<typename Type, std::integral Range, typename Compare>
+class kF::Core::EytzingerIndex
+{
+public:
+    /** @brief Count of keys per cache line, the descendants of a node 'log2(KeysPerLine)' levels below are contiguous */
+    static constexpr std::size_t KeysPerLine = std::max<std::size_t>(CacheLineSize / sizeof(Type), 1ul);
+
+
+    /** @brief Default constructor */
+    EytzingerIndex(void) noexcept = default;
+
+    /** @brief Build constructor */
+    EytzingerIndex(const Type * const from, const Type * const to) { build(from, to); }
+
+    /** @brief Move constructor */
+    EytzingerIndex(EytzingerIndex &&other) noexcept = default;
+
+    /** @brief Release the index */
+    ~EytzingerIndex(void) noexcept_destructible(Type) = default;
+
+    /** @brief Move assignment */
+    EytzingerIndex &operator=(EytzingerIndex &&other) noexcept = default;
+
+    /** @brief Swap two instances */
+    void swap(EytzingerIndex &other) noexcept { _keys.swap(other._keys); _ranks.swap(other._ranks); }
+
+
+    /** @brief Get the count of indexed keys */
+    [[nodiscard]] Range size(void) const noexcept { return static_cast<Range>(_ranks.empty() ? 0ul : _ranks.size() - 1); }
+
+    /** @brief Check if the index is empty */
+    [[nodiscard]] bool empty(void) const noexcept { return _ranks.empty(); }
+
+
+    /** @brief Rebuild the index from a sorted range */
+    void build(const Type * const from, const Type * const to);
+
+    /** @brief Release the index */
+    void release(void) noexcept_destructible(Type) { _keys.release(); _ranks.release(); }
+
+
+    /** @brief Get the rank of the first key not ordered before 'key', 'size()' if there is none */
+    template<typename LookupKey>
+    [[nodiscard]] Range lowerBound(const LookupKey &key) const noexcept_invocable(Compare, const Type &, const LookupKey &);
+
+    /** @brief Get the rank of the first key ordered after 'key', 'size()' if there is none */
+    template<typename LookupKey>
+    [[nodiscard]] Range upperBound(const LookupKey &key) const noexcept_invocable(Compare, const LookupKey &, const Type &);
+
+    /** @brief Get the rank of a key equivalent to 'key', 'size()' if it is missing */
+    template<typename LookupKey>
+    [[nodiscard]] Range find(const LookupKey &key) const
+        noexcept(nothrow_invocable(Compare, const Type &, const LookupKey &) && nothrow_invocable(Compare, const LookupKey &, const Type &));
+
+    /** @brief Check if the index contains a key equivalent to 'key' */
+    template<typename LookupKey>
+    [[nodiscard]] bool contains(const LookupKey &key) const
+        noexcept(nothrow_invocable(Compare, const Type &, const LookupKey &) && nothrow_invocable(Compare, const LookupKey &, const Type &))
+        { return find(key) != size(); }
+
+private:
+    /** @brief Keys in breadth-first order starting at index 1, the root */
+    AlignedHeapArray<Type> _keys {};
+    /** @brief Sorted rank of each key, index 0 holds 'size()' so that a failed descent maps to the end */
+    HeapArray<Range> _ranks {};
+
+    /** @brief Descend the tree, going right when 'isBefore(node)' and return the last node where it went left, 0 if none */
+    template<typename IsBefore>
+    [[nodiscard]] std::size_t descend(IsBefore &&isBefore) const noexcept_invocable(IsBefore, const Type &);
+};
+
+#include "EytzingerIndex.ipp"
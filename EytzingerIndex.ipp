@@ -0,0 +1,84 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: EytzingerIndex
+ */
+
+template<typename Type, std::integral Range, typename Compare>
+inline void kF::Core::EytzingerIndex<Type, Range, Compare>::build(const Type * const from, const Type * const to)
+{
+    const auto count = static_cast<std::size_t>(to - from);
+
+    if (!count) [[unlikely]] {
+        release();
+        return;
+    }
+    _keys.allocate(count + 1, *from);
+    _ranks.allocate(count + 1, static_cast<Range>(count));
+    // In-order traversal of the implicit tree, the i-th visited node receives the i-th sorted key
+    auto node = 1ul;
+    while (node * 2 <= count)
+        node *= 2;
+    for (auto i = 0ul; i < count; ++i) {
+        _keys[node] = from[i];
+        _ranks[node] = static_cast<Range>(i);
+        if (node * 2 + 1 <= count) {
+            node = node * 2 + 1;
+            while (node * 2 <= count)
+                node *= 2;
+        } else
+            node >>= std::countr_one(node) + 1;
+    }
+}
+
+template<typename Type, std::integral Range, typename Compare>
+template<typename IsBefore>
+inline std::size_t kF::Core::EytzingerIndex<Type, Range, Compare>::descend(IsBefore &&isBefore) const
+    noexcept_invocable(IsBefore, const Type &)
+{
+    const auto count = _keys.size() - 1;
+    const auto keys = _keys.data();
+    auto node = 1ul;
+
+    while (node <= count) {
+#if defined(__GNUC__) || defined(__clang__)
+        __builtin_prefetch(keys + node * KeysPerLine);
+#endif
+        node = node * 2 + static_cast<std::size_t>(isBefore(keys[node]));
+    }
+    // Drop the trailing right turns and the last left turn, what remains is the node where the descent last went left
+    return node >> (std::countr_one(node) + 1);
+}
+
+template<typename Type, std::integral Range, typename Compare>
+template<typename LookupKey>
+inline Range kF::Core::EytzingerIndex<Type, Range, Compare>::lowerBound(const LookupKey &key) const
+    noexcept_invocable(Compare, const Type &, const LookupKey &)
+{
+    if (empty()) [[unlikely]]
+        return 0;
+    return _ranks[descend([&key](const Type &other) { return Compare{}(other, key); })];
+}
+
+template<typename Type, std::integral Range, typename Compare>
+template<typename LookupKey>
+inline Range kF::Core::EytzingerIndex<Type, Range, Compare>::upperBound(const LookupKey &key) const
+    noexcept_invocable(Compare, const LookupKey &, const Type &)
+{
+    if (empty()) [[unlikely]]
+        return 0;
+    return _ranks[descend([&key](const Type &other) { return !Compare{}(key, other); })];
+}
+
+template<typename Type, std::integral Range, typename Compare>
+template<typename LookupKey>
+inline Range kF::Core::EytzingerIndex<Type, Range, Compare>::find(const LookupKey &key) const
+    noexcept(nothrow_invocable(Compare, const Type &, const LookupKey &) && nothrow_invocable(Compare, const LookupKey &, const Type &))
+{
+    if (empty()) [[unlikely]]
+        return 0;
+    const auto node = descend([&key](const Type &other) { return Compare{}(other, key); });
+
+    if (node && !Compare{}(key, _keys[node])) [[likely]]
+        return _ranks[node];
+    return size();
+}
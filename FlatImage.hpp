@@ -0,0 +1,251 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Relocatable image of flat vectors, loadable without copy from any read-only memory
+ */
+
+#pragma once
+
+#include <bit>
+#include <string_view>
+
+#include "Assert.hpp"
+#include "FlatVector.hpp"
+#include "Vector.hpp"
+
+namespace kF::Core
+{
+    /** @brief Header in front of every flat image */
+    struct FlatImageHeader;
+
+    /** @brief Offset of a flat vector block inside an image, used to nest vectors in trivially copyable elements */
+    template<typename Type, std::integral Range = std::size_t, typename CustomHeaderType = Internal::NoCustomHeaderType, std::size_t DataAlignment = alignof(Type)>
+    struct FlatImageRef;
+
+    /** @brief Read-only view over a flat vector block of an image */
+    template<typename Type, std::integral Range = std::size_t, typename CustomHeaderType = Internal::NoCustomHeaderType, std::size_t DataAlignment = alignof(Type)>
+    class FlatImageView;
+
+    /** @brief Non-owning loader of a flat image */
+    class FlatImage;
+
+    /** @brief Builder of a flat image */
+    class FlatImageWriter;
+
+    /** @brief Offset of a flat string block inside an image */
+    template<std::integral Range = std::size_t>
+    using FlatImageStringRef = FlatImageRef<char, Range>;
+
+    /** @brief Read-only view over a flat string block of an image */
+    template<std::integral Range = std::size_t>
+    using FlatImageStringView = FlatImageView<char, Range>;
+}
+
+/**
+ * @brief An image is a header followed by flat vector blocks, each block is laid out exactly as a FlatVector allocation
+ *  Blocks are aligned relative to the image start, thus the image must be loaded at an address aligned to 'alignment'
+ *  (a mapped file always is). Offsets and sizes are stored in native endianness
+ */
+struct kF::Core::FlatImageHeader
+{
+    /** @brief Expected magic ('KFIM') */
+    static constexpr std::uint32_t Magic = 0x4D49464Bu;
+
+    /** @brief Current version of the format */
+    static constexpr std::uint32_t Version = 1u;
+
+    std::uint32_t magic { Magic };
+    std::uint32_t version { Version };
+    std::uint64_t bytes { sizeof(FlatImageHeader) };
+    std::uint64_t alignment { alignof(FlatImageHeader) };
+    std::uint64_t root {};
+};
+
+template<typename Type, std::integral Range, typename CustomHeaderType, std::size_t DataAlignment>
+struct kF::Core::FlatImageRef
+{
+    /** @brief Offset of the block header from the image start, a null offset refers to no block */
+    std::uint64_t offset {};
+
+    /** @brief Check if the reference points to a block */
+    [[nodiscard]] explicit operator bool(void) const noexcept { return offset; }
+
+    /** @brief Comparison operators */
+    [[nodiscard]] bool operator==(const FlatImageRef &other) const noexcept = default;
+    [[nodiscard]] bool operator!=(const FlatImageRef &other) const noexcept = default;
+};
+
+template<typename Type, std::integral Range, typename CustomHeaderType, std::size_t DataAlignment>
+class kF::Core::FlatImageView
+{
+public:
+    /** @brief Input iterator */
+    using ConstIterator = const Type *;
+
+    /** @brief Block header, identical to the one of a FlatVector whose allocation policy aligns data to 'DataAlignment' */
+    using Header = Internal::FlatVectorHeader<Type, Range, CustomHeaderType, sizeof(CustomHeaderType), DataAlignment>;
+
+
+    /** @brief Construct an empty view */
+    FlatImageView(void) noexcept = default;
+
+    /** @brief Construct a view over a block header */
+    explicit FlatImageView(const Header * const header) noexcept : _ptr(header) {}
+
+    /** @brief Copy constructor */
+    FlatImageView(const FlatImageView &other) noexcept = default;
+
+    /** @brief Copy assignment */
+    FlatImageView &operator=(const FlatImageView &other) noexcept = default;
+
+
+    /** @brief Fast non-empty check */
+    [[nodiscard]] operator bool(void) const noexcept { return !empty(); }
+
+    /** @brief Fast empty check */
+    [[nodiscard]] bool empty(void) const noexcept { return !_ptr || !_ptr->size; }
+
+
+    /** @brief Get internal data pointer */
+    [[nodiscard]] const Type *data(void) const noexcept
+        { return _ptr ? reinterpret_cast<const Type *>(_ptr + 1) : nullptr; }
+
+    /** @brief Get the size of the view */
+    [[nodiscard]] Range size(void) const noexcept { return _ptr ? _ptr->size : Range(); }
+
+
+    /** @brief Begin / end overloads */
+    [[nodiscard]] ConstIterator begin(void) const noexcept { return data(); }
+    [[nodiscard]] ConstIterator end(void) const noexcept { return data() + size(); }
+
+
+    /** @brief Access element at positon */
+    [[nodiscard]] const Type &at(const Range pos) const noexcept
+        { return data()[pos]; }
+    [[nodiscard]] const Type &operator[](const Range pos) const noexcept
+        { return at(pos); }
+
+    /** @brief Get first element */
+    [[nodiscard]] const Type &front(void) const noexcept { return at(0); }
+
+    /** @brief Get last element */
+    [[nodiscard]] const Type &back(void) const noexcept { return at(size() - 1); }
+
+
+    /** @brief Get the custom type in header (doesn't check if the view is valid) */
+    template<typename As = CustomHeaderType>
+    [[nodiscard]] std::enable_if_t<!std::is_same_v<As, Internal::NoCustomHeaderType>, const As &> headerCustomType(void) const noexcept
+        { return _ptr->customType; }
+
+
+    /** @brief Get a std::basic_string_view of a string view */
+    [[nodiscard]] std::basic_string_view<Type> toStdView(void) const noexcept
+        requires (std::is_same_v<Type, char> || std::is_same_v<Type, wchar_t> || std::is_same_v<Type, char8_t>
+            || std::is_same_v<Type, char16_t> || std::is_same_v<Type, char32_t>)
+        { return std::basic_string_view<Type>(data(), size()); }
+
+
+    /** @brief Comparison operator */
+    template<typename Container> requires requires(const Container &container) { std::begin(container); std::end(container); }
+    [[nodiscard]] bool operator==(const Container &other) const noexcept
+        { return std::equal(begin(), end(), std::begin(other), std::end(other)); }
+
+private:
+    const Header *_ptr { nullptr };
+};
+
+class kF::Core::FlatImage
+{
+public:
+    /** @brief Construct an empty image */
+    FlatImage(void) noexcept = default;
+
+    /** @brief Adopt a read-only image without copying it, the memory must outlive the instance */
+    FlatImage(const void * const data, const std::size_t bytes) noexcept
+        : _data(reinterpret_cast<const std::byte *>(data)), _bytes(bytes) {}
+
+    /** @brief Copy constructor */
+    FlatImage(const FlatImage &other) noexcept = default;
+
+    /** @brief Copy assignment */
+    FlatImage &operator=(const FlatImage &other) noexcept = default;
+
+
+    /** @brief Check the image header, its size and its alignment in memory */
+    [[nodiscard]] bool isValid(void) const noexcept;
+
+    /** @brief Check if a reference is either null or a block fully contained in the image */
+    template<typename Type, std::integral Range, typename CustomHeaderType, std::size_t DataAlignment>
+    [[nodiscard]] bool isValid(const FlatImageRef<Type, Range, CustomHeaderType, DataAlignment> ref) const noexcept;
+
+
+    /** @brief Get image data */
+    [[nodiscard]] const std::byte *data(void) const noexcept { return _data; }
+
+    /** @brief Get image size in bytes */
+    [[nodiscard]] std::size_t bytes(void) const noexcept { return _bytes; }
+
+    /** @brief Get image header (doesn't check if the image is valid) */
+    [[nodiscard]] const FlatImageHeader &header(void) const noexcept
+        { return *reinterpret_cast<const FlatImageHeader *>(_data); }
+
+
+    /** @brief Get a view over a referenced block, a null reference gives an empty view */
+    template<typename Type, std::integral Range, typename CustomHeaderType, std::size_t DataAlignment>
+    [[nodiscard]] FlatImageView<Type, Range, CustomHeaderType, DataAlignment> view(const FlatImageRef<Type, Range, CustomHeaderType, DataAlignment> ref) const noexcept_ndebug;
+
+    /** @brief Get a view over the root block */
+    template<typename Type, std::integral Range = std::size_t, typename CustomHeaderType = Internal::NoCustomHeaderType, std::size_t DataAlignment = alignof(Type)>
+    [[nodiscard]] FlatImageView<Type, Range, CustomHeaderType, DataAlignment> root(void) const noexcept_ndebug
+        { return view(FlatImageRef<Type, Range, CustomHeaderType, DataAlignment> { header().root }); }
+
+private:
+    const std::byte *_data { nullptr };
+    std::size_t _bytes {};
+};
+
+class kF::Core::FlatImageWriter
+{
+public:
+    /** @brief Construct an image holding only its header */
+    FlatImageWriter(void) noexcept;
+
+
+    /** @brief Write a block of trivially copyable elements, nested blocks must be written first
+     *  @return Reference of the new block */
+    template<std::integral Range = std::size_t, typename Type, typename CustomHeaderType = Internal::NoCustomHeaderType, std::size_t DataAlignment = alignof(Type)>
+        requires std::is_trivially_copyable_v<Type> && std::is_trivially_copyable_v<CustomHeaderType>
+    FlatImageRef<Type, Range, CustomHeaderType, DataAlignment> write(const Type * const from, const Type * const to,
+            const CustomHeaderType &customType = CustomHeaderType()) noexcept;
+
+    /** @brief Write a flat vector, including its custom header type
+     *  The block keeps the header of the vector's allocation policy, so the image alignment follows it */
+    template<typename Type, std::integral Range, typename CustomHeaderType, typename GrowthPolicy, typename AllocationPolicy>
+        requires std::is_trivially_copyable_v<Type> && std::is_trivially_copyable_v<CustomHeaderType>
+    FlatImageRef<Type, Range, CustomHeaderType, std::max(alignof(Type), AllocationPolicyAlignment<AllocationPolicy>)>
+        write(const FlatVector<Type, Range, CustomHeaderType, GrowthPolicy, AllocationPolicy> &vector) noexcept;
+
+    /** @brief Set the root block of the image */
+    template<typename Type, std::integral Range, typename CustomHeaderType, std::size_t DataAlignment>
+    void setRoot(const FlatImageRef<Type, Range, CustomHeaderType, DataAlignment> ref) noexcept { header().root = ref.offset; }
+
+
+    /** @brief Get the image data, to be dumped as is */
+    [[nodiscard]] const std::byte *data(void) const noexcept { return _buffer.data(); }
+
+    /** @brief Get the image size in bytes */
+    [[nodiscard]] std::size_t bytes(void) const noexcept { return _buffer.size(); }
+
+    /** @brief Get the alignment required to load the image */
+    [[nodiscard]] std::size_t alignment(void) const noexcept { return header().alignment; }
+
+private:
+    Vector<std::byte> _buffer {};
+
+    /** @brief Get image header */
+    [[nodiscard]] FlatImageHeader &header(void) noexcept
+        { return *reinterpret_cast<FlatImageHeader *>(_buffer.data()); }
+    [[nodiscard]] const FlatImageHeader &header(void) const noexcept
+        { return *reinterpret_cast<const FlatImageHeader *>(_buffer.data()); }
+};
+
+#include "FlatImage.ipp"
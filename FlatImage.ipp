@@ -0,0 +1,98 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Relocatable image of flat vectors, loadable without copy from any read-only memory
+ */
+
+#include <stdexcept>
+
+inline bool kF::Core::FlatImage::isValid(void) const noexcept
+{
+    if (!_data || _bytes < sizeof(FlatImageHeader)
+            || reinterpret_cast<std::uintptr_t>(_data) % alignof(FlatImageHeader)) [[unlikely]]
+        return false;
+    const auto &imageHeader = header();
+    return imageHeader.magic == FlatImageHeader::Magic
+        && imageHeader.version == FlatImageHeader::Version
+        && imageHeader.bytes <= _bytes
+        && std::has_single_bit(imageHeader.alignment)
+        && !(reinterpret_cast<std::uintptr_t>(_data) % imageHeader.alignment);
+}
+
+template<typename Type, std::integral Range, typename CustomHeaderType, std::size_t DataAlignment>
+inline bool kF::Core::FlatImage::isValid(const FlatImageRef<Type, Range, CustomHeaderType, DataAlignment> ref) const noexcept
+{
+    using Header = typename FlatImageView<Type, Range, CustomHeaderType, DataAlignment>::Header;
+
+    if (!ref)
+        return true;
+    const auto imageBytes = header().bytes;
+    if (ref.offset % alignof(Header) || ref.offset < sizeof(FlatImageHeader)
+            || ref.offset > imageBytes || imageBytes - ref.offset < sizeof(Header)) [[unlikely]]
+        return false;
+    const auto size = static_cast<std::uint64_t>(reinterpret_cast<const Header *>(_data + ref.offset)->size);
+    return size <= (imageBytes - ref.offset - sizeof(Header)) / sizeof(Type);
+}
+
+template<typename Type, std::integral Range, typename CustomHeaderType, std::size_t DataAlignment>
+inline kF::Core::FlatImageView<Type, Range, CustomHeaderType, DataAlignment> kF::Core::FlatImage::view(const FlatImageRef<Type, Range, CustomHeaderType, DataAlignment> ref) const noexcept_ndebug
+{
+    using View = FlatImageView<Type, Range, CustomHeaderType, DataAlignment>;
+
+    kFAssert(isValid(ref),
+        throw std::out_of_range("Core::FlatImage::view: Reference out of image"));
+    if (!ref) [[unlikely]]
+        return View();
+    return View(reinterpret_cast<const typename View::Header *>(_data + ref.offset));
+}
+
+inline kF::Core::FlatImageWriter::FlatImageWriter(void) noexcept
+{
+    const FlatImageHeader imageHeader {};
+
+    _buffer.insertCopy(_buffer.end(), sizeof(FlatImageHeader), std::byte {});
+    std::memcpy(_buffer.data(), &imageHeader, sizeof(FlatImageHeader));
+}
+
+template<std::integral Range, typename Type, typename CustomHeaderType, std::size_t DataAlignment>
+    requires std::is_trivially_copyable_v<Type> && std::is_trivially_copyable_v<CustomHeaderType>
+inline kF::Core::FlatImageRef<Type, Range, CustomHeaderType, DataAlignment> kF::Core::FlatImageWriter::write(
+        const Type * const from, const Type * const to, const CustomHeaderType &customType) noexcept
+{
+    using Header = typename FlatImageView<Type, Range, CustomHeaderType, DataAlignment>::Header;
+
+    const auto count = static_cast<Range>(std::distance(from, to));
+    const auto offset = (_buffer.size() + alignof(Header) - 1) & ~(alignof(Header) - 1);
+    const auto end = offset + sizeof(Header) + sizeof(Type) * count;
+    Header blockHeader {};
+
+    if constexpr (!std::is_same_v<CustomHeaderType, Internal::NoCustomHeaderType>)
+        blockHeader.customType = customType;
+    blockHeader.size = count;
+    blockHeader.capacity = count;
+    // Padding is zeroed so that an image is reproducible
+    _buffer.insertCopy(_buffer.end(), static_cast<std::size_t>(end - _buffer.size()), std::byte {});
+    std::memcpy(_buffer.data() + offset, &blockHeader, sizeof(Header));
+    if (count) [[likely]]
+        std::memcpy(_buffer.data() + offset + sizeof(Header), from, sizeof(Type) * count);
+    auto &imageHeader = header();
+    imageHeader.bytes = end;
+    imageHeader.alignment = std::max<std::uint64_t>(imageHeader.alignment, alignof(Header));
+    return FlatImageRef<Type, Range, CustomHeaderType, DataAlignment> { offset };
+}
+
+template<typename Type, std::integral Range, typename CustomHeaderType, typename GrowthPolicy, typename AllocationPolicy>
+    requires std::is_trivially_copyable_v<Type> && std::is_trivially_copyable_v<CustomHeaderType>
+inline kF::Core::FlatImageRef<Type, Range, CustomHeaderType, std::max(alignof(Type), kF::Core::AllocationPolicyAlignment<AllocationPolicy>)>
+    kF::Core::FlatImageWriter::write(const FlatVector<Type, Range, CustomHeaderType, GrowthPolicy, AllocationPolicy> &vector) noexcept
+{
+    constexpr auto DataAlignment = std::max(alignof(Type), AllocationPolicyAlignment<AllocationPolicy>);
+
+    static_assert(std::is_same_v<typename FlatImageView<Type, Range, CustomHeaderType, DataAlignment>::Header,
+        typename FlatVector<Type, Range, CustomHeaderType, GrowthPolicy, AllocationPolicy>::Header>,
+        "Core::FlatImageWriter::write: Block header must match the one of the vector");
+    if constexpr (!std::is_same_v<CustomHeaderType, Internal::NoCustomHeaderType>) {
+        if (vector.isSafe())
+            return write<Range, Type, CustomHeaderType, DataAlignment>(vector.begin(), vector.end(), vector.headerCustomType());
+    }
+    return write<Range, Type, CustomHeaderType, DataAlignment>(vector.begin(), vector.end(), CustomHeaderType());
+}
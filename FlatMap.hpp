@@ -0,0 +1,75 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: FlatMap
+ */
+
+#pragma once
+
+#include "FlatMapDetails.hpp"
+#include "SortedVector.hpp"
+#include "SortedSmallVector.hpp"
+#include "SortedFlatVector.hpp"
+#include "SortedAllocatedVector.hpp"
+#include "SortedAllocatedSmallVector.hpp"
+#include "Vector.hpp"
+#include "SmallVector.hpp"
+#include "FlatVector.hpp"
+#include "AllocatedVector.hpp"
+#include "AllocatedSmallVector.hpp"
+
+namespace kF::Core
+{
+    /**
+     * @brief Map of unique keys stored as a sorted vector of keys and a parallel vector of values
+     * Binary searches only touch the key column, values are read once their index is known
+     * The default comparator is transparent, so keys can be looked up by any type comparable with them
+     *
+     * @tparam Key Key type
+     * @tparam Value Value type
+     * @tparam Range Range of container
+     * @tparam Compare Compare operator
+     * @tparam GrowthPolicy Capacity growth policy
+     */
+    template<typename Key, typename Value, std::integral Range = std::size_t, typename Compare = std::less<>, typename GrowthPolicy = DefaultGrowthPolicy>
+    using FlatMap = Internal::FlatMapDetails<
+        SortedVector<Key, Range, Compare, GrowthPolicy>, Vector<Value, Range, GrowthPolicy>, Key, Value, Range, Compare>;
+
+    /** @brief Flat map with a reduced range */
+    template<typename Key, typename Value, typename Compare = std::less<>, typename GrowthPolicy = DefaultGrowthPolicy>
+    using TinyFlatMap = FlatMap<Key, Value, std::uint32_t, Compare, GrowthPolicy>;
+
+    /** @brief Flat map with a small cache of 'OptimizedCapacity' entries */
+    template<typename Key, typename Value, std::size_t OptimizedCapacity, std::integral Range = std::size_t,
+            typename Compare = std::less<>, typename GrowthPolicy = DefaultGrowthPolicy>
+    using SmallFlatMap = Internal::FlatMapDetails<
+        SortedSmallVector<Key, OptimizedCapacity, Range, Compare, GrowthPolicy>, SmallVector<Value, OptimizedCapacity, Range, GrowthPolicy>,
+        Key, Value, Range, Compare>;
+
+    /** @brief Small optimized flat map with a reduced range */
+    template<typename Key, typename Value, std::size_t OptimizedCapacity, typename Compare = std::less<>, typename GrowthPolicy = DefaultGrowthPolicy>
+    using TinySmallFlatMap = SmallFlatMap<Key, Value, OptimizedCapacity, std::uint32_t, Compare, GrowthPolicy>;
+
+    /** @brief 16 bytes flat map whose columns allocate their size and capacity on the heap */
+    template<typename Key, typename Value, std::integral Range = std::size_t, typename Compare = std::less<>, typename GrowthPolicy = DefaultGrowthPolicy>
+    using FlatVectorMap = Internal::FlatMapDetails<
+        SortedFlatVector<Key, Range, Compare, Internal::NoCustomHeaderType, GrowthPolicy>,
+        FlatVector<Value, Range, Internal::NoCustomHeaderType, GrowthPolicy>, Key, Value, Range, Compare>;
+
+    /** @brief 16 bytes flat map with a reduced range */
+    template<typename Key, typename Value, typename Compare = std::less<>, typename GrowthPolicy = DefaultGrowthPolicy>
+    using TinyFlatVectorMap = FlatVectorMap<Key, Value, std::uint32_t, Compare, GrowthPolicy>;
+
+    /** @brief Flat map that must take an allocator and a deallocator functor, shared by both columns */
+    template<typename Key, typename Value, auto AllocateFunc, auto DeallocateFunc, std::integral Range = std::size_t,
+            typename Compare = std::less<>, typename GrowthPolicy = DefaultGrowthPolicy>
+    using AllocatedFlatMap = Internal::FlatMapDetails<
+        SortedAllocatedVector<Key, AllocateFunc, DeallocateFunc, Range, Compare, GrowthPolicy>,
+        AllocatedVector<Value, AllocateFunc, DeallocateFunc, Range, nullptr, GrowthPolicy>, Key, Value, Range, Compare>;
+
+    /** @brief Small optimized flat map that must take an allocator and a deallocator functor, shared by both columns */
+    template<typename Key, typename Value, std::size_t OptimizedCapacity, auto AllocateFunc, auto DeallocateFunc, std::integral Range = std::size_t,
+            typename Compare = std::less<>, typename GrowthPolicy = DefaultGrowthPolicy>
+    using AllocatedSmallFlatMap = Internal::FlatMapDetails<
+        SortedAllocatedSmallVector<Key, OptimizedCapacity, AllocateFunc, DeallocateFunc, Range, Compare, GrowthPolicy>,
+        AllocatedSmallVector<Value, OptimizedCapacity, AllocateFunc, DeallocateFunc, Range, GrowthPolicy>, Key, Value, Range, Compare>;
+}
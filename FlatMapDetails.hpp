@@ -0,0 +1,185 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: FlatMapDetails
+ */
+
+#pragma once
+
+#include "FlatSetDetails.hpp"
+
+/** @brief Map of unique keys stored in two parallel vectors, one sorted vector of keys and one vector of values
+ *  Lookups are binary searches that only touch the key column, the value at index 'i' belongs to the key at index 'i'
+ *  Any insertion or removal invalidates references to values */
+template<typename KeyVector, typename ValueVector, typename Key, typename Value, std::integral Range, typename Compare>
+class kF::Core::Internal::FlatMapDetails
+{
+public:
+    /** @brief Set of keys */
+    using KeySet = FlatSetDetails<KeyVector, Key, Range, Compare>;
+
+
+    /** @brief Default constructor */
+    FlatMapDetails(void) noexcept = default;
+
+    /** @brief Copy constructor */
+    FlatMapDetails(const FlatMapDetails &other) noexcept(nothrow_copy_constructible(Key) && nothrow_copy_constructible(Value)) = default;
+
+    /** @brief Move constructor */
+    FlatMapDetails(FlatMapDetails &&other) noexcept = default;
+
+    /** @brief Initializer list constructor, the first occurrence of a duplicated key is kept */
+    FlatMapDetails(std::initializer_list<std::pair<Key, Value>> &&init);
+
+    /** @brief Release the map */
+    ~FlatMapDetails(void) noexcept(nothrow_destructible(Key) && nothrow_destructible(Value)) = default;
+
+    /** @brief Copy assignment */
+    FlatMapDetails &operator=(const FlatMapDetails &other) noexcept(nothrow_copy_constructible(Key) && nothrow_copy_constructible(Value)) = default;
+
+    /** @brief Move assignment */
+    FlatMapDetails &operator=(FlatMapDetails &&other) noexcept = default;
+
+    /** @brief Swap two instances */
+    void swap(FlatMapDetails &other) noexcept { _keys.swap(other._keys); _values.swap(other._values); }
+
+
+    /** @brief Get the count of entries */
+    [[nodiscard]] Range size(void) const noexcept { return _keys.size(); }
+
+    /** @brief Get the capacity of the key buffer */
+    [[nodiscard]] Range capacity(void) const noexcept { return _keys.capacity(); }
+
+    /** @brief Check if the map is empty */
+    [[nodiscard]] bool empty(void) const noexcept { return _keys.empty(); }
+
+    /** @brief Fast empty check */
+    [[nodiscard]] explicit operator bool(void) const noexcept { return !empty(); }
+
+    /** @brief Get the sorted set of keys */
+    [[nodiscard]] const KeySet &keys(void) const noexcept { return _keys; }
+
+    /** @brief Get the values, ordered as their keys */
+    [[nodiscard]] ValueVector &values(void) noexcept { return _values; }
+    [[nodiscard]] const ValueVector &values(void) const noexcept { return _values; }
+
+    /** @brief Get the key at position */
+    [[nodiscard]] const Key &keyAt(const Range pos) const noexcept { return _keys.at(pos); }
+
+    /** @brief Get the value at position */
+    [[nodiscard]] Value &valueAt(const Range pos) noexcept { return _values.at(pos); }
+    [[nodiscard]] const Value &valueAt(const Range pos) const noexcept { return _values.at(pos); }
+
+
+    /** @brief Get the index of the first key not ordered before 'key' */
+    template<typename LookupKey> requires FlatLookupKey<LookupKey, Key, Compare>
+    [[nodiscard]] Range lowerBound(const LookupKey &key) const noexcept_invocable(Compare, const Key &, const LookupKey &)
+        { return _keys.lowerBoundIndex(key); }
+
+    /** @brief Get the index of the first key ordered after 'key' */
+    template<typename LookupKey> requires FlatLookupKey<LookupKey, Key, Compare>
+    [[nodiscard]] Range upperBound(const LookupKey &key) const noexcept_invocable(Compare, const LookupKey &, const Key &)
+        { return _keys.upperBoundIndex(key); }
+
+    /** @brief Get the index of 'key', 'size()' if it is missing */
+    template<typename LookupKey> requires FlatLookupKey<LookupKey, Key, Compare>
+    [[nodiscard]] Range findIndex(const LookupKey &key) const
+        noexcept(nothrow_invocable(Compare, const Key &, const LookupKey &) && nothrow_invocable(Compare, const LookupKey &, const Key &))
+        { return _keys.findIndex(key); }
+
+    /** @brief Find the value of 'key', returns nullptr if it is missing */
+    template<typename LookupKey> requires FlatLookupKey<LookupKey, Key, Compare>
+    [[nodiscard]] Value *find(const LookupKey &key)
+        noexcept(nothrow_invocable(Compare, const Key &, const LookupKey &) && nothrow_invocable(Compare, const LookupKey &, const Key &));
+    template<typename LookupKey> requires FlatLookupKey<LookupKey, Key, Compare>
+    [[nodiscard]] const Value *find(const LookupKey &key) const
+        noexcept(nothrow_invocable(Compare, const Key &, const LookupKey &) && nothrow_invocable(Compare, const LookupKey &, const Key &))
+        { return const_cast<FlatMapDetails *>(this)->find(key); }
+
+    /** @brief Check if the map contains 'key' */
+    template<typename LookupKey> requires FlatLookupKey<LookupKey, Key, Compare>
+    [[nodiscard]] bool contains(const LookupKey &key) const
+        noexcept(nothrow_invocable(Compare, const Key &, const LookupKey &) && nothrow_invocable(Compare, const LookupKey &, const Key &))
+        { return _keys.contains(key); }
+
+    /** @brief Get the value of an existing key, throws in debug mode if the key is missing */
+    template<typename LookupKey> requires FlatLookupKey<LookupKey, Key, Compare>
+    [[nodiscard]] Value &at(const LookupKey &key) noexcept_ndebug;
+    template<typename LookupKey> requires FlatLookupKey<LookupKey, Key, Compare>
+    [[nodiscard]] const Value &at(const LookupKey &key) const noexcept_ndebug
+        { return const_cast<FlatMapDetails *>(this)->at(key); }
+
+    /** @brief Get the value of a key, inserting a default constructed value if it is missing */
+    template<typename LookupKey> requires FlatLookupKey<LookupKey, Key, Compare> && std::constructible_from<Key, LookupKey>
+    [[nodiscard]] Value &operator[](LookupKey &&key) requires std::constructible_from<Value>
+        { return tryEmplace(std::forward<LookupKey>(key)).first; }
+
+
+    /** @brief Insert a value constructed from 'args' if 'key' is missing
+     *  Neither the key nor the value are constructed if 'key' is already stored
+     *  @return The value of the key and true if it has been inserted */
+    template<typename LookupKey, typename ...Args>
+        requires FlatLookupKey<LookupKey, Key, Compare> && std::constructible_from<Key, LookupKey> && std::constructible_from<Value, Args...>
+    std::pair<Value &, bool> tryEmplace(LookupKey &&key, Args &&...args);
+
+    /** @brief Insert 'value' if 'key' is missing, else assign it to the stored value
+     *  @return The value of the key and true if it has been inserted */
+    template<typename LookupKey, typename ValueType>
+        requires FlatLookupKey<LookupKey, Key, Compare> && std::constructible_from<Key, LookupKey> && std::assignable_from<Value &, ValueType>
+    std::pair<Value &, bool> insertOrAssign(LookupKey &&key, ValueType &&value);
+
+
+    /** @brief Erase the entry of a key
+     *  @return True if the entry has been erased */
+    template<typename LookupKey> requires FlatLookupKey<LookupKey, Key, Compare>
+    bool erase(const LookupKey &key);
+
+    /** @brief Erase the entry at position */
+    void eraseAt(const Range pos)
+        noexcept(nothrow_forward_constructible(Key) && nothrow_destructible(Key) && nothrow_forward_constructible(Value) && nothrow_destructible(Value))
+        { _keys.eraseAt(pos); _values.erase(_values.begin() + pos); }
+
+
+    /** @brief Reserve memory for 'capacity' entries */
+    void reserve(const Range capacity)
+        noexcept(nothrow_forward_constructible(Key) && nothrow_destructible(Key) && nothrow_forward_constructible(Value) && nothrow_destructible(Value))
+        { _keys.reserve(capacity); _values.reserve(capacity); }
+
+    /** @brief Destroy all entries */
+    void clear(void) noexcept(nothrow_destructible(Key) && nothrow_destructible(Value))
+        { _keys.clear(); _values.clear(); }
+
+    /** @brief Destroy all entries and release both buffer instances */
+    void release(void) noexcept(nothrow_destructible(Key) && nothrow_destructible(Value))
+        { _keys.release(); _values.release(); }
+
+
+    /** @brief Call 'functor(key, value)' on each entry in key order */
+    template<typename Functor> requires std::invocable<Functor &, const Key &, Value &>
+    void forEach(Functor &&functor) noexcept_invocable(Functor &, const Key &, Value &)
+        { for (Range i = 0, count = size(); i < count; ++i) std::invoke(functor, keyAt(i), valueAt(i)); }
+    template<typename Functor> requires std::invocable<Functor &, const Key &, const Value &>
+    void forEach(Functor &&functor) const noexcept_invocable(Functor &, const Key &, const Value &)
+        { for (Range i = 0, count = size(); i < count; ++i) std::invoke(functor, keyAt(i), valueAt(i)); }
+
+
+    /** @brief Comparison operators */
+    [[nodiscard]] bool operator==(const FlatMapDetails &other) const noexcept
+        requires std::equality_comparable<Key> && std::equality_comparable<Value>
+        { return _keys == other._keys && _values == other._values; }
+    [[nodiscard]] bool operator!=(const FlatMapDetails &other) const noexcept
+        requires std::equality_comparable<Key> && std::equality_comparable<Value>
+        { return !operator==(other); }
+
+private:
+    KeySet _keys {};
+    ValueVector _values {};
+};
+
+/** @brief A flat map is trivially relocatable if both its vectors are */
+template<typename KeyVector, typename ValueVector, typename KeyType, typename ValueType, std::integral Range, typename Compare>
+struct kF::Core::IsTriviallyRelocatable<kF::Core::Internal::FlatMapDetails<KeyVector, ValueVector, KeyType, ValueType, Range, Compare>>
+{
+    static constexpr bool Value = kF::Core::IsTriviallyRelocatable<KeyVector>::Value && kF::Core::IsTriviallyRelocatable<ValueVector>::Value;
+};
+
+#include "FlatMapDetails.ipp"
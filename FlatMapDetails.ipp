@@ -0,0 +1,86 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: FlatMapDetails
+ */
+
+#include <stdexcept>
+
+template<typename KeyVector, typename ValueVector, typename Key, typename Value, std::integral Range, typename Compare>
+inline kF::Core::Internal::FlatMapDetails<KeyVector, ValueVector, Key, Value, Range, Compare>::FlatMapDetails(
+        std::initializer_list<std::pair<Key, Value>> &&init)
+{
+    reserve(static_cast<Range>(init.size()));
+    for (const auto &pair : init)
+        tryEmplace(pair.first, pair.second);
+}
+
+template<typename KeyVector, typename ValueVector, typename Key, typename Value, std::integral Range, typename Compare>
+template<typename LookupKey> requires kF::Core::Internal::FlatLookupKey<LookupKey, Key, Compare>
+inline Value *kF::Core::Internal::FlatMapDetails<KeyVector, ValueVector, Key, Value, Range, Compare>::find(const LookupKey &key)
+    noexcept(nothrow_invocable(Compare, const Key &, const LookupKey &) && nothrow_invocable(Compare, const LookupKey &, const Key &))
+{
+    const auto pos = _keys.lowerBoundIndex(key);
+
+    if (_keys.isMatch(pos, key)) [[likely]]
+        return &_values.at(pos);
+    return nullptr;
+}
+
+template<typename KeyVector, typename ValueVector, typename Key, typename Value, std::integral Range, typename Compare>
+template<typename LookupKey> requires kF::Core::Internal::FlatLookupKey<LookupKey, Key, Compare>
+inline Value &kF::Core::Internal::FlatMapDetails<KeyVector, ValueVector, Key, Value, Range, Compare>::at(const LookupKey &key) noexcept_ndebug
+{
+    const auto value = find(key);
+
+    kFAssert(value,
+        throw std::out_of_range("Core::FlatMap::at: Key not found"));
+    return *value;
+}
+
+template<typename KeyVector, typename ValueVector, typename Key, typename Value, std::integral Range, typename Compare>
+template<typename LookupKey, typename ...Args>
+    requires kF::Core::Internal::FlatLookupKey<LookupKey, Key, Compare> && std::constructible_from<Key, LookupKey> && std::constructible_from<Value, Args...>
+inline std::pair<Value &, bool> kF::Core::Internal::FlatMapDetails<KeyVector, ValueVector, Key, Value, Range, Compare>::tryEmplace(
+        LookupKey &&key, Args &&...args)
+{
+    const auto pos = _keys.lowerBoundIndex(key);
+
+    if (_keys.isMatch(pos, key))
+        return std::pair<Value &, bool>(_values.at(pos), false);
+    // Key and value are built before touching the columns so that a throwing construction leaves both untouched
+    Key stored(std::forward<LookupKey>(key));
+    _values.insert(_values.begin() + pos, Value(std::forward<Args>(args)...));
+    _keys.insertAt(pos, std::move(stored));
+    return std::pair<Value &, bool>(_values.at(pos), true);
+}
+
+template<typename KeyVector, typename ValueVector, typename Key, typename Value, std::integral Range, typename Compare>
+template<typename LookupKey, typename ValueType>
+    requires kF::Core::Internal::FlatLookupKey<LookupKey, Key, Compare> && std::constructible_from<Key, LookupKey> && std::assignable_from<Value &, ValueType>
+inline std::pair<Value &, bool> kF::Core::Internal::FlatMapDetails<KeyVector, ValueVector, Key, Value, Range, Compare>::insertOrAssign(
+        LookupKey &&key, ValueType &&value)
+{
+    const auto pos = _keys.lowerBoundIndex(key);
+
+    if (_keys.isMatch(pos, key)) {
+        auto &stored = _values.at(pos);
+        stored = std::forward<ValueType>(value);
+        return std::pair<Value &, bool>(stored, false);
+    }
+    Key stored(std::forward<LookupKey>(key));
+    _values.insert(_values.begin() + pos, Value(std::forward<ValueType>(value)));
+    _keys.insertAt(pos, std::move(stored));
+    return std::pair<Value &, bool>(_values.at(pos), true);
+}
+
+template<typename KeyVector, typename ValueVector, typename Key, typename Value, std::integral Range, typename Compare>
+template<typename LookupKey> requires kF::Core::Internal::FlatLookupKey<LookupKey, Key, Compare>
+inline bool kF::Core::Internal::FlatMapDetails<KeyVector, ValueVector, Key, Value, Range, Compare>::erase(const LookupKey &key)
+{
+    const auto pos = _keys.lowerBoundIndex(key);
+
+    if (!_keys.isMatch(pos, key))
+        return false;
+    eraseAt(pos);
+    return true;
+}
@@ -0,0 +1,58 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: FlatSet
+ */
+
+#pragma once
+
+#include "FlatSetDetails.hpp"
+#include "SortedVector.hpp"
+#include "SortedSmallVector.hpp"
+#include "SortedFlatVector.hpp"
+#include "SortedAllocatedVector.hpp"
+#include "SortedAllocatedSmallVector.hpp"
+
+namespace kF::Core
+{
+    /**
+     * @brief Set of unique keys stored in a sorted vector, lookups are binary searches
+     * The default comparator is transparent, so keys can be looked up by any type comparable with them
+     *
+     * @tparam Key Key type
+     * @tparam Range Range of container
+     * @tparam Compare Compare operator
+     * @tparam GrowthPolicy Capacity growth policy
+     */
+    template<typename Key, std::integral Range = std::size_t, typename Compare = std::less<>, typename GrowthPolicy = DefaultGrowthPolicy>
+    using FlatSet = Internal::FlatSetDetails<SortedVector<Key, Range, Compare, GrowthPolicy>, Key, Range, Compare>;
+
+    /** @brief Flat set with a reduced range */
+    template<typename Key, typename Compare = std::less<>, typename GrowthPolicy = DefaultGrowthPolicy>
+    using TinyFlatSet = FlatSet<Key, std::uint32_t, Compare, GrowthPolicy>;
+
+    /** @brief Flat set with a small cache of 'OptimizedCapacity' keys */
+    template<typename Key, std::size_t OptimizedCapacity, std::integral Range = std::size_t, typename Compare = std::less<>, typename GrowthPolicy = DefaultGrowthPolicy>
+    using SmallFlatSet = Internal::FlatSetDetails<SortedSmallVector<Key, OptimizedCapacity, Range, Compare, GrowthPolicy>, Key, Range, Compare>;
+
+    /** @brief Small optimized flat set with a reduced range */
+    template<typename Key, std::size_t OptimizedCapacity, typename Compare = std::less<>, typename GrowthPolicy = DefaultGrowthPolicy>
+    using TinySmallFlatSet = SmallFlatSet<Key, OptimizedCapacity, std::uint32_t, Compare, GrowthPolicy>;
+
+    /** @brief 8 bytes flat set that allocates its size and capacity on the heap */
+    template<typename Key, std::integral Range = std::size_t, typename Compare = std::less<>, typename GrowthPolicy = DefaultGrowthPolicy>
+    using FlatVectorSet = Internal::FlatSetDetails<SortedFlatVector<Key, Range, Compare, Internal::NoCustomHeaderType, GrowthPolicy>, Key, Range, Compare>;
+
+    /** @brief 8 bytes flat set with a reduced range */
+    template<typename Key, typename Compare = std::less<>, typename GrowthPolicy = DefaultGrowthPolicy>
+    using TinyFlatVectorSet = FlatVectorSet<Key, std::uint32_t, Compare, GrowthPolicy>;
+
+    /** @brief Flat set that must take an allocator and a deallocator functor */
+    template<typename Key, auto AllocateFunc, auto DeallocateFunc, std::integral Range = std::size_t, typename Compare = std::less<>, typename GrowthPolicy = DefaultGrowthPolicy>
+    using AllocatedFlatSet = Internal::FlatSetDetails<SortedAllocatedVector<Key, AllocateFunc, DeallocateFunc, Range, Compare, GrowthPolicy>, Key, Range, Compare>;
+
+    /** @brief Small optimized flat set that must take an allocator and a deallocator functor */
+    template<typename Key, std::size_t OptimizedCapacity, auto AllocateFunc, auto DeallocateFunc, std::integral Range = std::size_t,
+            typename Compare = std::less<>, typename GrowthPolicy = DefaultGrowthPolicy>
+    using AllocatedSmallFlatSet = Internal::FlatSetDetails<
+        SortedAllocatedSmallVector<Key, OptimizedCapacity, AllocateFunc, DeallocateFunc, Range, Compare, GrowthPolicy>, Key, Range, Compare>;
+}
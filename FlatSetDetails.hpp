@@ -0,0 +1,213 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: FlatSetDetails
+ */
+
+#pragma once
+
+#include <algorithm>
+
+#include "SortedVectorDetails.hpp"
+
+namespace kF::Core::Internal
+{
+    /** @brief Key type usable for lookups, any type is accepted if the comparator is transparent */
+    template<typename LookupKey, typename Key, typename Compare>
+    concept FlatLookupKey = std::is_same_v<std::remove_cvref_t<LookupKey>, Key>
+        || requires { typename Compare::is_transparent; };
+
+    template<typename KeyVector, typename Key, std::integral Range, typename Compare>
+    class FlatSetDetails;
+
+    template<typename KeyVector, typename ValueVector, typename Key, typename Value, std::integral Range, typename Compare>
+    class FlatMapDetails;
+}
+
+/** @brief Set of unique keys stored in a sorted vector, lookups are binary searches
+ *  Keys are read-only, an edit that would break their order must go through erase / insert */
+template<typename KeyVector, typename Key, std::integral Range, typename Compare>
+class kF::Core::Internal::FlatSetDetails
+{
+public:
+    /** @brief Input iterator */
+    using ConstIterator = const Key *;
+
+    /** @brief Reverse input iterator */
+    using ConstReverseIterator = std::reverse_iterator<ConstIterator>;
+
+
+    /** @brief Default constructor */
+    FlatSetDetails(void) noexcept = default;
+
+    /** @brief Copy constructor */
+    FlatSetDetails(const FlatSetDetails &other) noexcept_copy_constructible(Key) = default;
+
+    /** @brief Move constructor */
+    FlatSetDetails(FlatSetDetails &&other) noexcept = default;
+
+    /** @brief Initializer list constructor, duplicated keys are dropped */
+    FlatSetDetails(std::initializer_list<Key> &&init) { insert(init.begin(), init.end()); }
+
+    /** @brief Range constructor, duplicated keys are dropped */
+    template<std::input_iterator InputIterator>
+    FlatSetDetails(InputIterator from, InputIterator to) { insert(from, to); }
+
+    /** @brief Release the set */
+    ~FlatSetDetails(void) noexcept_destructible(Key) = default;
+
+    /** @brief Copy assignment */
+    FlatSetDetails &operator=(const FlatSetDetails &other) noexcept_copy_constructible(Key) = default;
+
+    /** @brief Move assignment */
+    FlatSetDetails &operator=(FlatSetDetails &&other) noexcept = default;
+
+    /** @brief Swap two instances */
+    void swap(FlatSetDetails &other) noexcept { _keys.swap(other._keys); }
+
+
+    /** @brief Get the count of keys */
+    [[nodiscard]] Range size(void) const noexcept { return _keys.size(); }
+
+    /** @brief Get the capacity of the key buffer */
+    [[nodiscard]] Range capacity(void) const noexcept { return _keys.capacity(); }
+
+    /** @brief Check if the set is empty */
+    [[nodiscard]] bool empty(void) const noexcept { return _keys.empty(); }
+
+    /** @brief Fast empty check */
+    [[nodiscard]] explicit operator bool(void) const noexcept { return !empty(); }
+
+    /** @brief Get the sorted key vector */
+    [[nodiscard]] const KeyVector &keys(void) const noexcept { return _keys; }
+
+    /** @brief Get internal data pointer */
+    [[nodiscard]] const Key *data(void) const noexcept { return _keys.data(); }
+
+    /** @brief Begin / end overloads */
+    [[nodiscard]] ConstIterator begin(void) const noexcept { return _keys.begin(); }
+    [[nodiscard]] ConstIterator end(void) const noexcept { return _keys.end(); }
+    [[nodiscard]] ConstIterator cbegin(void) const noexcept { return begin(); }
+    [[nodiscard]] ConstIterator cend(void) const noexcept { return end(); }
+
+    /** @brief Reverse begin / end overloads */
+    [[nodiscard]] ConstReverseIterator rbegin(void) const noexcept { return std::make_reverse_iterator(end()); }
+    [[nodiscard]] ConstReverseIterator rend(void) const noexcept { return std::make_reverse_iterator(begin()); }
+
+    /** @brief Access key at position */
+    [[nodiscard]] const Key &at(const Range pos) const noexcept { return _keys.at(pos); }
+    [[nodiscard]] const Key &operator[](const Range pos) const noexcept { return _keys.at(pos); }
+
+    /** @brief Get first key */
+    [[nodiscard]] const Key &front(void) const noexcept { return _keys.front(); }
+
+    /** @brief Get last key */
+    [[nodiscard]] const Key &back(void) const noexcept { return _keys.back(); }
+
+
+    /** @brief Get the index of the first key not ordered before 'key' */
+    template<typename LookupKey> requires FlatLookupKey<LookupKey, Key, Compare>
+    [[nodiscard]] Range lowerBoundIndex(const LookupKey &key) const noexcept_invocable(Compare, const Key &, const LookupKey &);
+
+    /** @brief Get the index of the first key ordered after 'key' */
+    template<typename LookupKey> requires FlatLookupKey<LookupKey, Key, Compare>
+    [[nodiscard]] Range upperBoundIndex(const LookupKey &key) const noexcept_invocable(Compare, const LookupKey &, const Key &);
+
+    /** @brief Get the index of 'key', 'size()' if it is missing */
+    template<typename LookupKey> requires FlatLookupKey<LookupKey, Key, Compare>
+    [[nodiscard]] Range findIndex(const LookupKey &key) const
+        noexcept(nothrow_invocable(Compare, const Key &, const LookupKey &) && nothrow_invocable(Compare, const LookupKey &, const Key &));
+
+    /** @brief Get an iterator to the first key not ordered before 'key' */
+    template<typename LookupKey> requires FlatLookupKey<LookupKey, Key, Compare>
+    [[nodiscard]] ConstIterator lowerBound(const LookupKey &key) const noexcept_invocable(Compare, const Key &, const LookupKey &)
+        { return begin() + lowerBoundIndex(key); }
+
+    /** @brief Get an iterator to the first key ordered after 'key' */
+    template<typename LookupKey> requires FlatLookupKey<LookupKey, Key, Compare>
+    [[nodiscard]] ConstIterator upperBound(const LookupKey &key) const noexcept_invocable(Compare, const LookupKey &, const Key &)
+        { return begin() + upperBoundIndex(key); }
+
+    /** @brief Find 'key', returns 'end()' if it is missing */
+    template<typename LookupKey> requires FlatLookupKey<LookupKey, Key, Compare>
+    [[nodiscard]] ConstIterator find(const LookupKey &key) const
+        noexcept(nothrow_invocable(Compare, const Key &, const LookupKey &) && nothrow_invocable(Compare, const LookupKey &, const Key &))
+        { return begin() + findIndex(key); }
+
+    /** @brief Check if the set contains 'key' */
+    template<typename LookupKey> requires FlatLookupKey<LookupKey, Key, Compare>
+    [[nodiscard]] bool contains(const LookupKey &key) const
+        noexcept(nothrow_invocable(Compare, const Key &, const LookupKey &) && nothrow_invocable(Compare, const LookupKey &, const Key &))
+        { return findIndex(key) != size(); }
+
+
+    /** @brief Insert a key if it is missing
+     *  @return The iterator of the key and true if it has been inserted */
+    std::pair<ConstIterator, bool> insert(const Key &key) { return tryEmplace(key); }
+    std::pair<ConstIterator, bool> insert(Key &&key) { return tryEmplace(std::move(key)); }
+
+    /** @brief Insert an initializer list, duplicated keys are dropped */
+    void insert(std::initializer_list<Key> &&init) { insert(init.begin(), init.end()); }
+
+    /** @brief Insert a range of keys, duplicated keys are dropped */
+    template<std::input_iterator InputIterator>
+    void insert(InputIterator from, InputIterator to);
+
+    /** @brief Insert a key constructed from 'key' if no equivalent key is stored
+     *  The key is only constructed if it is inserted
+     *  @return The iterator of the key and true if it has been inserted */
+    template<typename LookupKey> requires FlatLookupKey<LookupKey, Key, Compare> && std::constructible_from<Key, LookupKey>
+    std::pair<ConstIterator, bool> tryEmplace(LookupKey &&key);
+
+
+    /** @brief Erase a key
+     *  @return True if the key has been erased */
+    template<typename LookupKey> requires FlatLookupKey<LookupKey, Key, Compare>
+    bool erase(const LookupKey &key);
+
+    /** @brief Erase the key at position */
+    void eraseAt(const Range pos) noexcept(nothrow_forward_constructible(Key) && nothrow_destructible(Key))
+        { _keys.erase(_keys.begin() + pos); }
+
+
+    /** @brief Reserve memory for 'capacity' keys */
+    void reserve(const Range capacity) noexcept(nothrow_forward_constructible(Key) && nothrow_destructible(Key))
+        { _keys.reserve(capacity); }
+
+    /** @brief Destroy all keys */
+    void clear(void) noexcept_destructible(Key) { _keys.clear(); }
+
+    /** @brief Destroy all keys and release the buffer instance */
+    void release(void) noexcept_destructible(Key) { _keys.release(); }
+
+
+    /** @brief Comparison operators */
+    [[nodiscard]] bool operator==(const FlatSetDetails &other) const noexcept
+        requires std::equality_comparable<Key>
+        { return _keys == other._keys; }
+    [[nodiscard]] bool operator!=(const FlatSetDetails &other) const noexcept
+        requires std::equality_comparable<Key>
+        { return !operator==(other); }
+
+private:
+    KeyVector _keys {};
+
+    template<typename, typename, typename, typename, std::integral, typename>
+    friend class FlatMapDetails;
+
+    /** @brief Check if the key at 'pos' is equivalent to 'key', 'pos' must be a lower bound of 'key' */
+    template<typename LookupKey>
+    [[nodiscard]] bool isMatch(const Range pos, const LookupKey &key) const noexcept_invocable(Compare, const LookupKey &, const Key &)
+        { return pos != size() && !Compare{}(key, _keys.at(pos)); }
+
+    /** @brief Insert a key at a sorted position */
+    template<typename ...Args>
+    void insertAt(const Range pos, Args &&...args);
+};
+
+/** @brief A flat set is trivially relocatable if its key vector is */
+template<typename KeyVector, typename Key, std::integral Range, typename Compare>
+struct kF::Core::IsTriviallyRelocatable<kF::Core::Internal::FlatSetDetails<KeyVector, Key, Range, Compare>>
+    : public kF::Core::IsTriviallyRelocatable<KeyVector>
+{};
+
+#include "FlatSetDetails.ipp"
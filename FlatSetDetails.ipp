@@ -0,0 +1,88 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: FlatSetDetails
+ */
+
+template<typename KeyVector, typename Key, std::integral Range, typename Compare>
+template<typename LookupKey> requires kF::Core::Internal::FlatLookupKey<LookupKey, Key, Compare>
+inline Range kF::Core::Internal::FlatSetDetails<KeyVector, Key, Range, Compare>::lowerBoundIndex(const LookupKey &key) const
+    noexcept_invocable(Compare, const Key &, const LookupKey &)
+{
+    // Lookups by key go through the sorted vector, which compares arithmetic keys several at a time
+    if constexpr (std::is_same_v<LookupKey, Key>)
+        return static_cast<Range>(_keys.lowerBound(key) - begin());
+    else
+        return static_cast<Range>(std::lower_bound(begin(), end(), key, Compare{}) - begin());
+}
+
+template<typename KeyVector, typename Key, std::integral Range, typename Compare>
+template<typename LookupKey> requires kF::Core::Internal::FlatLookupKey<LookupKey, Key, Compare>
+inline Range kF::Core::Internal::FlatSetDetails<KeyVector, Key, Range, Compare>::upperBoundIndex(const LookupKey &key) const
+    noexcept_invocable(Compare, const LookupKey &, const Key &)
+{
+    if constexpr (std::is_same_v<LookupKey, Key>)
+        return static_cast<Range>(_keys.upperBound(key) - begin());
+    else
+        return static_cast<Range>(std::upper_bound(begin(), end(), key, Compare{}) - begin());
+}
+
+template<typename KeyVector, typename Key, std::integral Range, typename Compare>
+template<typename LookupKey> requires kF::Core::Internal::FlatLookupKey<LookupKey, Key, Compare>
+inline Range kF::Core::Internal::FlatSetDetails<KeyVector, Key, Range, Compare>::findIndex(const LookupKey &key) const
+    noexcept(nothrow_invocable(Compare, const Key &, const LookupKey &) && nothrow_invocable(Compare, const LookupKey &, const Key &))
+{
+    const auto pos = lowerBoundIndex(key);
+
+    if (isMatch(pos, key)) [[likely]]
+        return pos;
+    return size();
+}
+
+template<typename KeyVector, typename Key, std::integral Range, typename Compare>
+template<std::input_iterator InputIterator>
+inline void kF::Core::Internal::FlatSetDetails<KeyVector, Key, Range, Compare>::insert(InputIterator from, InputIterator to)
+{
+    if (from == to) [[unlikely]]
+        return;
+    // Merge the whole range at once then drop the duplicates, stored keys are merged first so they are the ones kept
+    _keys.emplaceRange(from, to);
+    const auto last = std::unique(_keys.begin(), _keys.end(), [](const Key &lhs, const Key &rhs) {
+        return !Compare{}(lhs, rhs);
+    });
+    _keys.erase(last, _keys.end());
+}
+
+template<typename KeyVector, typename Key, std::integral Range, typename Compare>
+template<typename LookupKey> requires kF::Core::Internal::FlatLookupKey<LookupKey, Key, Compare> && std::constructible_from<Key, LookupKey>
+inline std::pair<typename kF::Core::Internal::FlatSetDetails<KeyVector, Key, Range, Compare>::ConstIterator, bool>
+    kF::Core::Internal::FlatSetDetails<KeyVector, Key, Range, Compare>::tryEmplace(LookupKey &&key)
+{
+    const auto pos = lowerBoundIndex(key);
+
+    if (isMatch(pos, key))
+        return std::make_pair(begin() + pos, false);
+    insertAt(pos, std::forward<LookupKey>(key));
+    return std::make_pair(begin() + pos, true);
+}
+
+template<typename KeyVector, typename Key, std::integral Range, typename Compare>
+template<typename LookupKey> requires kF::Core::Internal::FlatLookupKey<LookupKey, Key, Compare>
+inline bool kF::Core::Internal::FlatSetDetails<KeyVector, Key, Range, Compare>::erase(const LookupKey &key)
+{
+    const auto pos = lowerBoundIndex(key);
+
+    if (!isMatch(pos, key))
+        return false;
+    eraseAt(pos);
+    return true;
+}
+
+template<typename KeyVector, typename Key, std::integral Range, typename Compare>
+template<typename ...Args>
+inline void kF::Core::Internal::FlatSetDetails<KeyVector, Key, Range, Compare>::insertAt(const Range pos, Args &&...args)
+{
+    if constexpr (sizeof...(Args) == 1 && (std::is_same_v<std::remove_cvref_t<Args>, Key> && ...))
+        _keys.insertAt(_keys.begin() + pos, std::forward<Args>(args)...);
+    else
+        _keys.insertAt(_keys.begin() + pos, Key(std::forward<Args>(args)...));
+}
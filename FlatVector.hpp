@@ -15,11 +15,20 @@ namespace kF::Core
      *
      * @tparam Type Internal type in container
      * @tparam Range Range of container
+     * @tparam CustomHeaderType Custom type stored in header
+     * @tparam GrowthPolicy Capacity growth policy
+     * @tparam AllocationPolicy Policy placing the buffer in memory
      */
-    template<typename Type, std::integral Range = std::size_t, typename CustomHeaderType = Internal::NoCustomHeaderType>
-    using FlatVector = Internal::VectorDetails<Internal::FlatVectorBase<Type, Range, CustomHeaderType>, Type, Range>;
+    template<typename Type, std::integral Range = std::size_t, typename CustomHeaderType = Internal::NoCustomHeaderType,
+            typename GrowthPolicy = DefaultGrowthPolicy, typename AllocationPolicy = DefaultAllocationPolicy>
+    using FlatVector = Internal::VectorDetails<Internal::FlatVectorBase<Type, Range, CustomHeaderType, AllocationPolicy>, Type, Range, false, GrowthPolicy>;
 
     /** @brief 8 bytes vector using signed char with a reduced range */
-    template<typename Type, typename CustomHeaderType = Internal::NoCustomHeaderType>
-    using TinyFlatVector = Internal::VectorDetails<Internal::FlatVectorBase<Type, std::uint32_t, CustomHeaderType>, Type, std::uint32_t>;
+    template<typename Type, typename CustomHeaderType = Internal::NoCustomHeaderType, typename GrowthPolicy = DefaultGrowthPolicy>
+    using TinyFlatVector = FlatVector<Type, std::uint32_t, CustomHeaderType, GrowthPolicy>;
+
+    /** @brief Flat vector whose data is aligned to 'Width' bytes and whose capacity fills a multiple of 'Width' bytes
+     *  The header is padded to 'Width' bytes, meant for SIMD loops using aligned full width loads */
+    template<typename Type, std::size_t Width = CacheLineSize, std::integral Range = std::size_t>
+    using AlignedFlatVector = FlatVector<Type, Range, Internal::NoCustomHeaderType, PageGrowthPolicy<Width>, SimdAllocationPolicy<Width>>;
 }
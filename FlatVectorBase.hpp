@@ -6,20 +6,21 @@
 #pragma once
 
 #include "Utils.hpp"
+#include "AllocationPolicy.hpp"
 
 namespace kF::Core::Internal
 {
-    template<typename Type, std::integral Range, typename CustomHeaderType>
+    template<typename Type, std::integral Range, typename CustomHeaderType, typename AllocationPolicy = DefaultAllocationPolicy>
     class FlatVectorBase;
 
     struct NoCustomHeaderType {};
 
-    /** @brief Deduce the alignment of FlatVectorHeader */
-    template<typename Type, typename Range, std::size_t CustomHeaderTypeSize>
+    /** @brief Deduce the alignment of FlatVectorHeader, its size is a multiple of it so that data is aligned to 'DataAlignment' */
+    template<typename Type, typename Range, std::size_t CustomHeaderTypeSize, std::size_t DataAlignment = alignof(Type)>
     [[nodiscard]] constexpr std::size_t GetFlatVectorHeaderAlignment(void)
     {
         constexpr std::size_t TotalHeaderSize = sizeof(Range) * 2 + CustomHeaderTypeSize;
-        constexpr std::size_t MinAlignment = alignof(Type);
+        constexpr std::size_t MinAlignment = std::max(alignof(Type), DataAlignment);
 
         if constexpr (TotalHeaderSize > MinAlignment)
             return kF::Core::Utils::NextPowerOf2(TotalHeaderSize);
@@ -28,8 +29,8 @@ namespace kF::Core::Internal
     }
 
     /** @brief Header of the FlatVector with custom type */
-    template<typename Type, typename Range, typename CustomHeaderType, std::size_t CustomHeaderTypeSize = sizeof(CustomHeaderType)>
-    struct alignas(GetFlatVectorHeaderAlignment<Type, Range, CustomHeaderTypeSize>()) FlatVectorHeader
+    template<typename Type, typename Range, typename CustomHeaderType, std::size_t CustomHeaderTypeSize = sizeof(CustomHeaderType), std::size_t DataAlignment = alignof(Type)>
+    struct alignas(GetFlatVectorHeaderAlignment<Type, Range, CustomHeaderTypeSize, DataAlignment>()) FlatVectorHeader
     {
         CustomHeaderType customType {};
         Range size {};
@@ -37,8 +38,8 @@ namespace kF::Core::Internal
     };
 
     /** @brief Header of the FlatVector without custom type */
-    template<typename Type, typename Range>
-    struct alignas(GetFlatVectorHeaderAlignment<Type, Range, 0>()) FlatVectorHeader<Type, Range, NoCustomHeaderType>
+    template<typename Type, typename Range, std::size_t DataAlignment>
+    struct alignas(GetFlatVectorHeaderAlignment<Type, Range, 0, DataAlignment>()) FlatVectorHeader<Type, Range, NoCustomHeaderType, sizeof(NoCustomHeaderType), DataAlignment>
     {
         Range size {};
         Range capacity {};
@@ -49,7 +50,7 @@ namespace kF::Core::Internal
 }
 
 /** @brief Base implementation of a vector with size and capacity allocated with data */
-template<typename Type, std::integral Range, typename CustomHeaderType>
+template<typename Type, std::integral Range, typename CustomHeaderType, typename AllocationPolicy>
 class kF::Core::Internal::FlatVectorBase
 {
 public:
@@ -60,7 +61,7 @@ public:
     using ConstIterator = const Type *;
 
     /** @brief FlatVector's header */
-    using Header = FlatVectorHeader<Type, Range, CustomHeaderType>;
+    using Header = FlatVectorHeader<Type, Range, CustomHeaderType, sizeof(CustomHeaderType), std::max(alignof(Type), AllocationPolicyAlignment<AllocationPolicy>)>;
 
 
     /** @brief Check if the instance is safe to access */
@@ -114,7 +115,7 @@ public:
 
 protected:
     /** @brief Protected data setter */
-    void setData(Type * const data) noexcept { _ptr = reinterpret_cast<Header *>(data) - 1; }
+    void setData(Type * const data) noexcept { _ptr = data ? reinterpret_cast<Header *>(data) - 1 : nullptr; }
 
     /** @brief Protected size setter */
     void setSize(const Range size) noexcept { _ptr->size = size; }
@@ -124,27 +125,26 @@ protected:
 
 
     /** @brief Allocates a new buffer */
-<<<<<<< HEAD
     [[nodiscard]] Type *allocate(const Range capacity) noexcept;
-=======
-    [[nodiscard]] Type *allocate(const Range capacity) noexcept
-    {
-        auto ptr = Utils::AlignedAlloc<alignof(Header), Header>(sizeof(Header) + sizeof(Type) * capacity);
-        if constexpr (!std::is_same_v<CustomHeaderType, NoCustomHeaderType>) {
-            if (_ptr)
-                new (&ptr->customType) CustomHeaderType(std::move(_ptr->customType));
-            else
-                new (&ptr->customType) CustomHeaderType {};
-        }
-        return reinterpret_cast<Type *>(ptr + 1);
-    }
->>>>>>> 0444dc71a5086948805173d8f483286b341f645b
 
     /** @brief Deallocates a buffer */
-    void deallocate(Type * const data, const Range) noexcept;
+    void deallocate(Type * const data, const Range capacity) noexcept;
+
+    /** @brief Resize a buffer with its header in place when possible, both are moved bytewise
+     *  @return nullptr if the buffer could not be resized, in which case it is left untouched */
+    [[nodiscard]] Type *reallocate(Type * const data, const Range, const Range capacity) noexcept
+        requires (alignof(Header) <= alignof(std::max_align_t) && IsTriviallyRelocatable<CustomHeaderType>::Value
+            && std::is_same_v<AllocationPolicy, DefaultAllocationPolicy>);
 
 private:
     Header *_ptr { nullptr };
 };
 
+/** @brief FlatVectorBase only owns a heap pointer */
+template<typename Type, std::integral Range, typename CustomHeaderType, typename AllocationPolicy>
+struct kF::Core::IsTriviallyRelocatable<kF::Core::Internal::FlatVectorBase<Type, Range, CustomHeaderType, AllocationPolicy>>
+{
+    static constexpr bool Value = true;
+};
+
 #include "FlatVectorBase.ipp"
\ No newline at end of file
@@ -3,8 +3,8 @@
  * @ Description: FlatVectorBase
  */
 
-template<typename Type, std::integral Range, typename CustomHeaderType>
-inline const Type *kF::Core::Internal::FlatVectorBase<Type, Range, CustomHeaderType>::data(void) const noexcept
+template<typename Type, std::integral Range, typename CustomHeaderType, typename AllocationPolicy>
+inline const Type *kF::Core::Internal::FlatVectorBase<Type, Range, CustomHeaderType, AllocationPolicy>::data(void) const noexcept
 {
     if (_ptr) [[likely]]
         return dataUnsafe();
@@ -12,16 +12,16 @@ inline const Type *kF::Core::Internal::FlatVectorBase<Type, Range, CustomHeaderT
         return nullptr;
 }
 
-template<typename Type, std::integral Range, typename CustomHeaderType>
-inline void kF::Core::Internal::FlatVectorBase<Type, Range, CustomHeaderType>::steal(FlatVectorBase &other) noexcept
+template<typename Type, std::integral Range, typename CustomHeaderType, typename AllocationPolicy>
+inline void kF::Core::Internal::FlatVectorBase<Type, Range, CustomHeaderType, AllocationPolicy>::steal(FlatVectorBase &other) noexcept
 {
     std::swap(_ptr, other._ptr);
 }
 
-template<typename Type, std::integral Range, typename CustomHeaderType>
-inline Type *kF::Core::Internal::FlatVectorBase<Type, Range, CustomHeaderType>::allocate(const Range capacity) noexcept
+template<typename Type, std::integral Range, typename CustomHeaderType, typename AllocationPolicy>
+inline Type *kF::Core::Internal::FlatVectorBase<Type, Range, CustomHeaderType, AllocationPolicy>::allocate(const Range capacity) noexcept
 {
-    auto ptr = Utils::AlignedAlloc<alignof(Header), Header>(sizeof(Header) + sizeof(Type) * capacity);
+    auto ptr = reinterpret_cast<Header *>(AllocationPolicy::Allocate(sizeof(Header) + sizeof(Type) * capacity, alignof(Header)));
     if constexpr (!std::is_same_v<CustomHeaderType, NoCustomHeaderType>) {
         if (_ptr)
             new (&ptr->customType) CustomHeaderType(std::move(_ptr->customType));
@@ -31,11 +31,23 @@ inline Type *kF::Core::Internal::FlatVectorBase<Type, Range, CustomHeaderType>::
     return reinterpret_cast<Type *>(ptr + 1);
 }
 
-template<typename Type, std::integral Range, typename CustomHeaderType>
-inline void kF::Core::Internal::FlatVectorBase<Type, Range, CustomHeaderType>::deallocate(Type * const data, const Range) noexcept
+template<typename Type, std::integral Range, typename CustomHeaderType, typename AllocationPolicy>
+inline Type *kF::Core::Internal::FlatVectorBase<Type, Range, CustomHeaderType, AllocationPolicy>::reallocate(Type * const data, const Range, const Range capacity) noexcept
+    requires (alignof(Header) <= alignof(std::max_align_t) && IsTriviallyRelocatable<CustomHeaderType>::Value
+        && std::is_same_v<AllocationPolicy, DefaultAllocationPolicy>)
+{
+    const auto ptr = Utils::AlignedRealloc<alignof(Header), Header>(reinterpret_cast<Header *>(data) - 1, sizeof(Header) + sizeof(Type) * capacity);
+
+    if (!ptr) [[unlikely]]
+        return nullptr;
+    return reinterpret_cast<Type *>(ptr + 1);
+}
+
+template<typename Type, std::integral Range, typename CustomHeaderType, typename AllocationPolicy>
+inline void kF::Core::Internal::FlatVectorBase<Type, Range, CustomHeaderType, AllocationPolicy>::deallocate(Type * const data, const Range capacity) noexcept
 {
     auto ptr = reinterpret_cast<Header *>(data) - 1;
     if constexpr (!std::is_same_v<CustomHeaderType, NoCustomHeaderType>)
         ptr->customType.~CustomHeaderType();
-    Utils::AlignedFree(ptr);
+    AllocationPolicy::Deallocate(ptr, sizeof(Header) + sizeof(Type) * capacity, alignof(Header));
 }
\ No newline at end of file
@@ -272,4 +272,11 @@ private:
     OpaqueInvoke _invoke { nullptr };
     OpaqueDestructor _destruct { nullptr };
     Cache _cache {};
+};
+
+/** @brief Functor never points into itself, its move constructor is already a raw copy */
+template<typename Return, typename ...Args, std::size_t CacheSize>
+struct kF::Core::IsTriviallyRelocatable<kF::Core::Functor<Return(Args...), CacheSize>>
+{
+    static constexpr bool Value = true;
 };
\ No newline at end of file
@@ -0,0 +1,104 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Growth policies of vectors
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+
+namespace kF::Core
+{
+    /**
+     * @brief Growth policies decide the capacity of a vector when it runs out of room
+     *  A policy exposes two static functions templated over the element type and the range of the container:
+     *   - 'InitialCapacity<Type, Range>()' the capacity of the first allocation made by a push
+     *   - 'NextCapacity<Type, Range>(currentCapacity, minimum)' the capacity to grow to, at least 'currentCapacity + max(minimum, 1)'
+     */
+
+    /** @brief Double the capacity on each growth, default policy */
+    struct DoublingGrowthPolicy;
+
+    /** @brief Grow by half of the capacity, trades more reallocations for less unused memory */
+    struct OneAndHalfGrowthPolicy;
+
+    /** @brief Round the allocation of another policy up to a power of 2 bytes, matching allocator size classes */
+    template<std::size_t InitialBytes = 64, typename Policy = DoublingGrowthPolicy>
+    struct SizeClassGrowthPolicy;
+
+    /** @brief Round the allocation of another policy up to a multiple of pages, starting from one page */
+    template<std::size_t PageSize = 4096, typename Policy = DoublingGrowthPolicy>
+    struct PageGrowthPolicy;
+
+    /** @brief Default growth policy of vectors */
+    using DefaultGrowthPolicy = DoublingGrowthPolicy;
+}
+
+struct kF::Core::DoublingGrowthPolicy
+{
+    /** @brief Initial capacity */
+    template<typename Type, std::integral Range>
+    [[nodiscard]] static constexpr Range InitialCapacity(void) noexcept
+        { return static_cast<Range>(2); }
+
+    /** @brief Next capacity */
+    template<typename Type, std::integral Range>
+    [[nodiscard]] static constexpr Range NextCapacity(const Range currentCapacity, const Range minimum) noexcept
+        { return static_cast<Range>(currentCapacity + std::max({ currentCapacity, minimum, static_cast<Range>(1) })); }
+};
+
+struct kF::Core::OneAndHalfGrowthPolicy
+{
+    /** @brief Initial capacity */
+    template<typename Type, std::integral Range>
+    [[nodiscard]] static constexpr Range InitialCapacity(void) noexcept
+        { return static_cast<Range>(2); }
+
+    /** @brief Next capacity */
+    template<typename Type, std::integral Range>
+    [[nodiscard]] static constexpr Range NextCapacity(const Range currentCapacity, const Range minimum) noexcept
+        { return static_cast<Range>(currentCapacity + std::max({ static_cast<Range>(currentCapacity / 2), minimum, static_cast<Range>(1) })); }
+};
+
+template<std::size_t InitialBytes, typename Policy>
+struct kF::Core::SizeClassGrowthPolicy
+{
+    /** @brief Round a capacity so that its allocation fills a power of 2 bytes */
+    template<typename Type, std::integral Range>
+    [[nodiscard]] static constexpr Range RoundCapacity(const Range capacity) noexcept
+        { return static_cast<Range>(std::bit_ceil(sizeof(Type) * static_cast<std::size_t>(capacity)) / sizeof(Type)); }
+
+    /** @brief Initial capacity */
+    template<typename Type, std::integral Range>
+    [[nodiscard]] static constexpr Range InitialCapacity(void) noexcept
+        { return RoundCapacity<Type, Range>(static_cast<Range>(std::max<std::size_t>(InitialBytes / sizeof(Type), 1))); }
+
+    /** @brief Next capacity */
+    template<typename Type, std::integral Range>
+    [[nodiscard]] static constexpr Range NextCapacity(const Range currentCapacity, const Range minimum) noexcept
+        { return RoundCapacity<Type, Range>(Policy::template NextCapacity<Type, Range>(currentCapacity, minimum)); }
+};
+
+template<std::size_t PageSize, typename Policy>
+struct kF::Core::PageGrowthPolicy
+{
+    static_assert(std::has_single_bit(PageSize), "PageGrowthPolicy: PageSize must be a power of 2");
+
+    /** @brief Round a capacity so that its allocation fills a multiple of pages */
+    template<typename Type, std::integral Range>
+    [[nodiscard]] static constexpr Range RoundCapacity(const Range capacity) noexcept
+        { return static_cast<Range>(((sizeof(Type) * static_cast<std::size_t>(capacity) + PageSize - 1) & ~(PageSize - 1)) / sizeof(Type)); }
+
+    /** @brief Initial capacity */
+    template<typename Type, std::integral Range>
+    [[nodiscard]] static constexpr Range InitialCapacity(void) noexcept
+        { return RoundCapacity<Type, Range>(static_cast<Range>(1)); }
+
+    /** @brief Next capacity */
+    template<typename Type, std::integral Range>
+    [[nodiscard]] static constexpr Range NextCapacity(const Range currentCapacity, const Range minimum) noexcept
+        { return RoundCapacity<Type, Range>(Policy::template NextCapacity<Type, Range>(currentCapacity, minimum)); }
+};
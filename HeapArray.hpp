@@ -9,14 +9,27 @@
 
 #include "Assert.hpp"
 #include "Utils.hpp"
+#include "AllocationPolicy.hpp"
+#include "Parallel.hpp"
 
 namespace kF::Core
 {
-    template<typename Type>
+    /**
+     * @brief Fixed size array allocated on the heap
+     *
+     * @tparam Type Internal type in container
+     * @tparam AllocationPolicy Policy placing the buffer in memory
+     */
+    template<typename Type, typename AllocationPolicy = DefaultAllocationPolicy>
     class HeapArray;
+
+    /** @brief Heap array whose data is aligned to 'Width' bytes, zero padded up to a multiple of 'Width' bytes
+     *  Meant for SIMD loops using aligned full width loads */
+    template<typename Type, std::size_t Width = CacheLineSize>
+    using AlignedHeapArray = HeapArray<Type, SimdAllocationPolicy<Width>>;
 }
 
-template<typename Type>
+template<typename Type, typename AllocationPolicy>
 class alignas_quarter_cacheline kF::Core::HeapArray
 {
 public:
@@ -53,9 +66,19 @@ public:
     void allocate(const std::size_t size, Args &&...args)
         noexcept(nothrow_ndebug && nothrow_constructible(Type, Args...) && nothrow_destructible(Type));
 
+    /** @brief Allocate a new array, elements are constructed by 'threadCount' threads over contiguous page aligned chunks
+     *  Each page is first touched by the thread constructing it, so the kernel places it on that thread's NUMA node
+     *  The array should then be processed with the same partitioning, the constructor of Type must not throw */
+    template<typename ...Args> requires std::constructible_from<Type, Args...>
+    void allocateParallel(const std::size_t size, const std::size_t threadCount, Args &&...args)
+        noexcept(nothrow_ndebug && nothrow_destructible(Type));
+
     /** @brief Clear the array and release memory */
     void release(void) noexcept_destructible(Type);
 
+    /** @brief Clear the array and release memory, elements are destroyed by 'threadCount' threads, the destructor of Type must not throw */
+    void releaseParallel(const std::size_t threadCount) noexcept_destructible(Type);
+
 
     /** @brief Get internal data */
     [[nodiscard]] Type *data(void) noexcept { return _data; }
@@ -80,6 +103,9 @@ public:
     [[nodiscard]] ConstIterator end(void) const noexcept { return data() + size(); }
 
 private:
+    /** @brief Destroy elements and (re)allocate the buffer if its size changes */
+    void reallocateBuffer(const std::size_t size) noexcept(nothrow_ndebug && nothrow_destructible(Type));
+
     Type *_data { nullptr };
     std::size_t _size { 0 };
 };
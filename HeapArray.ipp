@@ -3,29 +3,30 @@
  * @ Description: HeapArray
  */
 
-template<typename Type>
+template<typename Type, typename AllocationPolicy>
 template<typename ...Args> requires std::constructible_from<Type, Args...>
-inline void kF::Core::HeapArray<Type>::allocate(const std::size_t size, Args &&...args)
+inline void kF::Core::HeapArray<Type, AllocationPolicy>::allocate(const std::size_t size, Args &&...args)
     noexcept(nothrow_ndebug && nothrow_constructible(Type, Args...) && nothrow_destructible(Type))
 {
-    if constexpr (!std::is_trivially_destructible_v<Type>) {
-        for (auto &elem : *this)
-            elem.~Type();
-    }
-    if (size && _size != size) [[likely]] {
-        if (_size) [[unlikely]]
-            Utils::AlignedFree(_data);
-        _data = reinterpret_cast<Type *>(Utils::AlignedAlloc<alignof(Type)>(sizeof(Type) * size));
-        kFAssert(_data,
-            throw std::runtime_error("Core::HeapArray::allocate: Malloc failed"));
-    }
-    _size = size;
+    reallocateBuffer(size);
     for (auto i = 0ul; i < _size; ++i)
         new (&_data[i]) Type(args...);
 }
 
-template<typename Type>
-inline void kF::Core::HeapArray<Type>::release(void) noexcept_destructible(Type)
+template<typename Type, typename AllocationPolicy>
+template<typename ...Args> requires std::constructible_from<Type, Args...>
+inline void kF::Core::HeapArray<Type, AllocationPolicy>::allocateParallel(const std::size_t size, const std::size_t threadCount, Args &&...args)
+    noexcept(nothrow_ndebug && nothrow_destructible(Type))
+{
+    reallocateBuffer(size);
+    Utils::ParallelChunks(begin(), end(), threadCount, [&args...](Type * const from, Type * const to) noexcept {
+        for (auto it = from; it != to; ++it)
+            new (it) Type(args...);
+    });
+}
+
+template<typename Type, typename AllocationPolicy>
+inline void kF::Core::HeapArray<Type, AllocationPolicy>::release(void) noexcept_destructible(Type)
 {
     if (!_data) [[unlikely]]
         return;
@@ -33,7 +34,42 @@ inline void kF::Core::HeapArray<Type>::release(void) noexcept_destructible(Type)
         for (auto &elem : *this)
             elem.~Type();
     }
-    Utils::AlignedFree(_data);
+    AllocationPolicy::Deallocate(_data, sizeof(Type) * _size, alignof(Type));
+    _data = nullptr;
+    _size = 0;
+}
+
+template<typename Type, typename AllocationPolicy>
+inline void kF::Core::HeapArray<Type, AllocationPolicy>::releaseParallel(const std::size_t threadCount) noexcept_destructible(Type)
+{
+    if (!_data) [[unlikely]]
+        return;
+    if constexpr (!std::is_trivially_destructible_v<Type>) {
+        Utils::ParallelChunks(begin(), end(), threadCount, [](Type * const from, Type * const to) noexcept {
+            std::destroy(from, to);
+        });
+    }
+    AllocationPolicy::Deallocate(_data, sizeof(Type) * _size, alignof(Type));
     _data = nullptr;
     _size = 0;
 }
+
+template<typename Type, typename AllocationPolicy>
+inline void kF::Core::HeapArray<Type, AllocationPolicy>::reallocateBuffer(const std::size_t size)
+    noexcept(nothrow_ndebug && nothrow_destructible(Type))
+{
+    if (_size == size) [[unlikely]] {
+        if constexpr (!std::is_trivially_destructible_v<Type>) {
+            for (auto &elem : *this)
+                elem.~Type();
+        }
+        return;
+    }
+    release();
+    if (!size) [[unlikely]]
+        return;
+    _data = reinterpret_cast<Type *>(AllocationPolicy::Allocate(sizeof(Type) * size, alignof(Type)));
+    kFAssert(_data,
+        throw std::runtime_error("Core::HeapArray::allocate: Malloc failed"));
+    _size = size;
+}
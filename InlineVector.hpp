@@ -0,0 +1,28 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Inline Vector
+ */
+
+#pragma once
+
+#include "VectorDetails.hpp"
+#include "InlineVectorBase.hpp"
+
+namespace kF::Core
+{
+    /**
+     * @brief Vector storing at most 'Capacity' elements inside itself, without any heap fallback
+     *  Exceeding the capacity asserts in debug and is undefined in release
+     *  The vector is trivially copyable when Type is
+     *
+     * @tparam Type Internal type in container
+     * @tparam Capacity Maximum count of elements
+     * @tparam Range Range of container
+     */
+    template<typename Type, std::size_t Capacity, std::integral Range = std::size_t>
+    using InlineVector = Internal::VectorDetails<Internal::InlineVectorBase<Type, Capacity, Range>, Type, Range, true>;
+
+    /** @brief Inline vector with a reduced range */
+    template<typename Type, std::size_t Capacity>
+    using TinyInlineVector = InlineVector<Type, Capacity, std::uint32_t>;
+}
@@ -0,0 +1,105 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: InlineVectorBase
+ */
+
+#pragma once
+
+#include "Assert.hpp"
+#include "Utils.hpp"
+
+namespace kF::Core::Internal
+{
+    template<typename Type, std::size_t Capacity, std::integral Range>
+    class InlineVectorBase;
+}
+
+/** @brief Base implementation of a vector storing at most 'Capacity' elements inline, without any heap fallback */
+template<typename Type, std::size_t Capacity, std::integral Range>
+class kF::Core::Internal::InlineVectorBase
+{
+public:
+    static_assert(Capacity > 0, "InlineVectorBase: Capacity must not be null");
+
+    /** @brief Output iterator */
+    using Iterator = Type *;
+
+    /** @brief Input iterator */
+    using ConstIterator = const Type *;
+
+    /** @brief Storage of trivially copyable types is copied bytewise, keeping the vector trivially copyable */
+    static constexpr bool IsTriviallyCopyable = std::is_trivially_copyable_v<Type>;
+
+
+    /** @brief Always safe ! */
+    [[nodiscard]] constexpr bool isSafe(void) const noexcept { return true; }
+
+    /** @brief Fast empty check */
+    [[nodiscard]] bool empty(void) const noexcept { return !_size; }
+
+
+    /** @brief Get internal data pointer */
+    [[nodiscard]] Type *data(void) noexcept { return dataUnsafe(); }
+    [[nodiscard]] const Type *data(void) const noexcept { return dataUnsafe(); }
+    [[nodiscard]] Type *dataUnsafe(void) noexcept { return reinterpret_cast<Type *>(&_storage); }
+    [[nodiscard]] const Type *dataUnsafe(void) const noexcept { return reinterpret_cast<const Type *>(&_storage); }
+
+
+    /** @brief Get the size of the vector */
+    [[nodiscard]] Range size(void) const noexcept { return sizeUnsafe(); }
+    [[nodiscard]] Range sizeUnsafe(void) const noexcept { return _size; }
+
+
+    /** @brief Get the capacity of the vector, always 'Capacity' */
+    [[nodiscard]] constexpr Range capacity(void) const noexcept { return capacityUnsafe(); }
+    [[nodiscard]] constexpr Range capacityUnsafe(void) const noexcept { return static_cast<Range>(Capacity); }
+
+
+    /** @brief Unsafe begin / end overloads */
+    [[nodiscard]] Iterator beginUnsafe(void) noexcept { return data(); }
+    [[nodiscard]] Iterator endUnsafe(void) noexcept { return data() + sizeUnsafe(); }
+    [[nodiscard]] ConstIterator beginUnsafe(void) const noexcept { return data(); }
+    [[nodiscard]] ConstIterator endUnsafe(void) const noexcept { return data() + sizeUnsafe(); }
+
+    /** @brief Begin / end overloads */
+    [[nodiscard]] Iterator begin(void) noexcept { return beginUnsafe(); }
+    [[nodiscard]] Iterator end(void) noexcept { return endUnsafe(); }
+    [[nodiscard]] ConstIterator begin(void) const noexcept { return beginUnsafe(); }
+    [[nodiscard]] ConstIterator end(void) const noexcept { return endUnsafe(); }
+
+
+    /** @brief Steal another instance, its elements are relocated */
+    void steal(InlineVectorBase &other) noexcept(nothrow_forward_constructible(Type) && nothrow_destructible(Type));
+
+    /** @brief Swap two instances, trivially relocatable storages are exchanged at once */
+    void swap(InlineVectorBase &other) noexcept(nothrow_forward_constructible(Type) && nothrow_destructible(Type) && std::is_nothrow_swappable_v<Type>);
+
+protected:
+    /** @brief Protected data setter, the storage never changes */
+    void setData(Type * const) noexcept {}
+
+    /** @brief Protected size setter */
+    void setSize(const Range size) noexcept { _size = size; }
+
+    /** @brief Protected capacity setter, the capacity never changes */
+    void setCapacity(const Range) noexcept {}
+
+
+    /** @brief Get the storage, asserts in debug that 'capacity' fits into it */
+    [[nodiscard]] Type *allocate(const Range capacity) noexcept_ndebug;
+
+    /** @brief Nothing to deallocate */
+    void deallocate(Type * const, const Range) noexcept {}
+
+private:
+    alignas(alignof(Type)) std::byte _storage[sizeof(Type) * Capacity];
+    Range _size {};
+};
+
+/** @brief InlineVectorBase never points into itself */
+template<typename Type, std::size_t Capacity, std::integral Range>
+struct kF::Core::IsTriviallyRelocatable<kF::Core::Internal::InlineVectorBase<Type, Capacity, Range>>
+    : public kF::Core::IsTriviallyRelocatable<Type>
+{};
+
+#include "InlineVectorBase.ipp"
@@ -0,0 +1,48 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: InlineVectorBase
+ */
+
+template<typename Type, std::size_t Capacity, std::integral Range>
+inline void kF::Core::Internal::InlineVectorBase<Type, Capacity, Range>::steal(InlineVectorBase &other)
+    noexcept(nothrow_forward_constructible(Type) && nothrow_destructible(Type))
+{
+    std::destroy(beginUnsafe(), endUnsafe());
+    if constexpr (IsTriviallyRelocatable<Type>::Value)
+        std::memcpy(&_storage, &other._storage, sizeof(Type) * other._size);
+    else
+        Utils::RelocateForward(other.beginUnsafe(), other.endUnsafe(), beginUnsafe());
+    _size = other._size;
+    other._size = Range {};
+}
+
+template<typename Type, std::size_t Capacity, std::integral Range>
+inline void kF::Core::Internal::InlineVectorBase<Type, Capacity, Range>::swap(InlineVectorBase &other)
+    noexcept(nothrow_forward_constructible(Type) && nothrow_destructible(Type) && std::is_nothrow_swappable_v<Type>)
+{
+    if constexpr (IsTriviallyRelocatable<Type>::Value) {
+        const auto bytes = sizeof(Type) * std::max(_size, other._size);
+        alignas(alignof(Type)) std::byte tmp[sizeof(_storage)];
+        std::memcpy(&tmp, &_storage, bytes);
+        std::memcpy(&_storage, &other._storage, bytes);
+        std::memcpy(&other._storage, &tmp, bytes);
+    } else {
+        const auto size = sizeUnsafe();
+        const auto otherSize = other.sizeUnsafe();
+        const auto common = std::min(size, otherSize);
+        std::swap_ranges(beginUnsafe(), beginUnsafe() + common, other.beginUnsafe());
+        if (size < otherSize)
+            Utils::RelocateForward(other.beginUnsafe() + common, other.endUnsafe(), beginUnsafe() + common);
+        else
+            Utils::RelocateForward(beginUnsafe() + common, endUnsafe(), other.beginUnsafe() + common);
+    }
+    std::swap(_size, other._size);
+}
+
+template<typename Type, std::size_t Capacity, std::integral Range>
+inline Type *kF::Core::Internal::InlineVectorBase<Type, Capacity, Range>::allocate(const Range capacity) noexcept_ndebug
+{
+    kFAssert(static_cast<std::size_t>(capacity) <= Capacity,
+        throw std::length_error("Core::InlineVector::allocate: Capacity exceeded"));
+    return dataUnsafe();
+}
@@ -0,0 +1,194 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Vector of bit-packed small integers
+ */
+
+#pragma once
+
+#include <bit>
+
+#include "Vector.hpp"
+
+namespace kF::Core
+{
+    /**
+     * @brief Vector packing elements of 'Bits' bits into 64 bits words, elements never straddle two words
+     *  Bits past the last element are always zero, so bulk operations work a whole word at a time
+     *
+     * @tparam Bits Count of bits of each element
+     * @tparam Range Range of container
+     * @tparam GrowthPolicy Capacity growth policy of the words
+     */
+    template<std::size_t Bits, std::integral Range = std::size_t, typename GrowthPolicy = DefaultGrowthPolicy>
+    class PackedVector;
+}
+
+template<std::size_t Bits, std::integral Range, typename GrowthPolicy>
+class kF::Core::PackedVector
+{
+public:
+    static_assert(Bits > 0 && Bits <= 32, "PackedVector: Bits must be in range [1, 32]");
+
+    /** @brief Storage unit */
+    using Word = std::uint64_t;
+
+    /** @brief Smallest unsigned integer holding an element */
+    using Value = std::conditional_t<Bits == 1, bool,
+        std::conditional_t<Bits <= 8, std::uint8_t,
+        std::conditional_t<Bits <= 16, std::uint16_t, std::uint32_t>>>;
+
+    /** @brief Count of bits of a word */
+    static constexpr std::size_t WordBits = sizeof(Word) * 8;
+
+    /** @brief Count of elements stored in a word */
+    static constexpr std::size_t ElementsPerWord = WordBits / Bits;
+
+    /** @brief Mask of a single element */
+    static constexpr Word ElementMask = (Word(1) << Bits) - 1;
+
+
+    /** @brief Default constructor */
+    PackedVector(void) noexcept = default;
+
+    /** @brief Copy constructor */
+    PackedVector(const PackedVector &other) noexcept = default;
+
+    /** @brief Move constructor */
+    PackedVector(PackedVector &&other) noexcept { swap(other); }
+
+    /** @brief Resize constructor */
+    PackedVector(const Range count, const Value value = Value()) noexcept { resize(count, value); }
+
+    /** @brief Initializer list constructor */
+    PackedVector(std::initializer_list<Value> init) noexcept;
+
+    /** @brief Copy assignment */
+    PackedVector &operator=(const PackedVector &other) noexcept = default;
+
+    /** @brief Move assignment */
+    PackedVector &operator=(PackedVector &&other) noexcept { _words = std::move(other._words); _size = other._size; other._size = Range(); return *this; }
+
+    /** @brief Swap two instances */
+    void swap(PackedVector &other) noexcept { _words.swap(other._words); std::swap(_size, other._size); }
+
+
+    /** @brief Fast check if vector contains elements */
+    [[nodiscard]] operator bool(void) const noexcept { return !empty(); }
+    [[nodiscard]] bool empty(void) const noexcept { return !_size; }
+
+    /** @brief Get the count of elements */
+    [[nodiscard]] Range size(void) const noexcept { return _size; }
+
+    /** @brief Get the count of elements the words can hold */
+    [[nodiscard]] Range capacity(void) const noexcept { return static_cast<Range>(_words.capacity() * ElementsPerWord); }
+
+
+    /** @brief Get the words holding the elements */
+    [[nodiscard]] Word *wordData(void) noexcept { return _words.data(); }
+    [[nodiscard]] const Word *wordData(void) const noexcept { return _words.data(); }
+
+    /** @brief Get the count of words holding the elements */
+    [[nodiscard]] Range wordCount(void) const noexcept { return _words.size(); }
+
+
+    /** @brief Get an element */
+    [[nodiscard]] Value at(const Range pos) const noexcept
+        { return static_cast<Value>((_words[WordIndex(pos)] >> BitShift(pos)) & ElementMask); }
+    [[nodiscard]] Value operator[](const Range pos) const noexcept { return at(pos); }
+
+    /** @brief Get the first element */
+    [[nodiscard]] Value front(void) const noexcept { return at(0); }
+
+    /** @brief Get the last element */
+    [[nodiscard]] Value back(void) const noexcept { return at(_size - 1); }
+
+    /** @brief Set an element, extra bits of 'value' are discarded */
+    void set(const Range pos, const Value value) noexcept;
+
+
+    /** @brief Push an element */
+    void push(const Value value) noexcept;
+
+    /** @brief Pop the last element */
+    void pop(void) noexcept;
+
+    /** @brief Resize the vector, filling new elements with 'value' while existing ones are preserved */
+    void resize(const Range count, const Value value = Value()) noexcept;
+
+    /** @brief Reserve memory for at least 'capacity' elements */
+    bool reserve(const Range capacity) noexcept
+        { return _words.reserve(WordCount(capacity)); }
+
+    /** @brief Remove all elements */
+    void clear(void) noexcept { _words.clear(); _size = Range(); }
+
+    /** @brief Remove all elements and release memory */
+    void release(void) noexcept { _words.release(); _size = Range(); }
+
+
+    /** @brief Bitwise operations with another vector, a word at a time
+     *  Both vectors should have the same size, otherwise elements past the smallest one are left untouched */
+    PackedVector &operator&=(const PackedVector &other) noexcept;
+    PackedVector &operator|=(const PackedVector &other) noexcept;
+    PackedVector &operator^=(const PackedVector &other) noexcept;
+
+
+    /** @brief Count set bits */
+    [[nodiscard]] Range count(void) const noexcept requires (Bits == 1);
+
+    /** @brief Find the first set bit at or after 'from'
+     *  @return Index of the bit or 'size()' if there is none */
+    [[nodiscard]] Range findFirstSet(const Range from = Range()) const noexcept requires (Bits == 1);
+
+    /** @brief Find the first unset bit at or after 'from'
+     *  @return Index of the bit or 'size()' if there is none */
+    [[nodiscard]] Range findFirstUnset(const Range from = Range()) const noexcept requires (Bits == 1);
+
+    /** @brief Call 'functor(index)' on each set bit, in order */
+    template<typename Functor>
+        requires std::invocable<Functor &, Range>
+    void forEachSet(Functor &&functor) const noexcept_invocable(Functor &, Range) requires (Bits == 1);
+
+    /** @brief Set or clear every bit of range [from, to[ */
+    void setRange(const Range from, const Range to) noexcept requires (Bits == 1);
+    void clearRange(const Range from, const Range to) noexcept requires (Bits == 1);
+
+    /** @brief Check if any / all / none of the bits are set */
+    [[nodiscard]] bool any(void) const noexcept requires (Bits == 1) { return findFirstSet() != _size; }
+    [[nodiscard]] bool all(void) const noexcept requires (Bits == 1) { return findFirstUnset() == _size; }
+    [[nodiscard]] bool none(void) const noexcept requires (Bits == 1) { return !any(); }
+
+
+    /** @brief Comparison operators */
+    [[nodiscard]] bool operator==(const PackedVector &other) const noexcept
+        { return _size == other._size && std::equal(_words.begin(), _words.end(), other._words.begin()); }
+    [[nodiscard]] bool operator!=(const PackedVector &other) const noexcept { return !operator==(other); }
+
+private:
+    Vector<Word, Range, GrowthPolicy> _words {};
+    Range _size {};
+
+    /** @brief Get the word holding an element */
+    [[nodiscard]] static constexpr Range WordIndex(const Range pos) noexcept
+        { return static_cast<Range>(pos / ElementsPerWord); }
+
+    /** @brief Get the position of an element inside its word */
+    [[nodiscard]] static constexpr std::size_t BitShift(const Range pos) noexcept
+        { return (pos % ElementsPerWord) * Bits; }
+
+    /** @brief Get the count of words holding 'count' elements */
+    [[nodiscard]] static constexpr Range WordCount(const Range count) noexcept
+        { return static_cast<Range>((count + ElementsPerWord - 1) / ElementsPerWord); }
+
+    /** @brief Get a word with every element set to 'value' */
+    [[nodiscard]] static constexpr Word Splat(const Value value) noexcept;
+
+    /** @brief Get the mask of the elements of the last word */
+    [[nodiscard]] static constexpr Word TailMask(const Range count) noexcept;
+
+    /** @brief Set or clear every bit of range [from, to[ */
+    template<bool Set>
+    void fillRange(const Range from, const Range to) noexcept;
+};
+
+#include "PackedVector.ipp"
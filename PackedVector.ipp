@@ -0,0 +1,215 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: PackedVector
+ */
+
+template<std::size_t Bits, std::integral Range, typename GrowthPolicy>
+inline kF::Core::PackedVector<Bits, Range, GrowthPolicy>::PackedVector(std::initializer_list<Value> init) noexcept
+{
+    reserve(static_cast<Range>(init.size()));
+    for (const auto value : init)
+        push(value);
+}
+
+template<std::size_t Bits, std::integral Range, typename GrowthPolicy>
+inline void kF::Core::PackedVector<Bits, Range, GrowthPolicy>::set(const Range pos, const Value value) noexcept
+{
+    const auto shift = BitShift(pos);
+    auto &word = _words[WordIndex(pos)];
+
+    word = (word & ~(ElementMask << shift)) | ((static_cast<Word>(value) & ElementMask) << shift);
+}
+
+template<std::size_t Bits, std::integral Range, typename GrowthPolicy>
+inline void kF::Core::PackedVector<Bits, Range, GrowthPolicy>::push(const Value value) noexcept
+{
+    const auto shift = BitShift(_size);
+
+    if (!shift) [[unlikely]]
+        _words.push(Word());
+    _words.back() |= (static_cast<Word>(value) & ElementMask) << shift;
+    ++_size;
+}
+
+template<std::size_t Bits, std::integral Range, typename GrowthPolicy>
+inline void kF::Core::PackedVector<Bits, Range, GrowthPolicy>::pop(void) noexcept
+{
+    --_size;
+    if (const auto shift = BitShift(_size); !shift) [[unlikely]]
+        _words.pop();
+    else
+        _words.back() &= ~(ElementMask << shift);
+}
+
+template<std::size_t Bits, std::integral Range, typename GrowthPolicy>
+inline void kF::Core::PackedVector<Bits, Range, GrowthPolicy>::resize(const Range count, const Value value) noexcept
+{
+    const auto words = WordCount(count);
+
+    if (count <= _size) {
+        _words.erase(_words.begin() + words, _words.end());
+    } else {
+        _words.reserve(words);
+        // Complete the last word element by element, then fill whole words
+        for (auto pos = _size; pos < count && BitShift(pos); ++pos)
+            _words.back() |= (static_cast<Word>(value) & ElementMask) << BitShift(pos);
+        const auto splat = Splat(value);
+        while (_words.size() < words)
+            _words.push(splat);
+    }
+    _size = count;
+    if (words) [[likely]]
+        _words.back() &= TailMask(count);
+}
+
+template<std::size_t Bits, std::integral Range, typename GrowthPolicy>
+inline kF::Core::PackedVector<Bits, Range, GrowthPolicy> &kF::Core::PackedVector<Bits, Range, GrowthPolicy>::operator&=(const PackedVector &other) noexcept
+{
+    const auto words = std::min(_words.size(), other._words.size());
+
+    for (Range i = 0; i < words; ++i)
+        _words[i] &= other._words[i];
+    return *this;
+}
+
+template<std::size_t Bits, std::integral Range, typename GrowthPolicy>
+inline kF::Core::PackedVector<Bits, Range, GrowthPolicy> &kF::Core::PackedVector<Bits, Range, GrowthPolicy>::operator|=(const PackedVector &other) noexcept
+{
+    const auto words = std::min(_words.size(), other._words.size());
+
+    for (Range i = 0; i < words; ++i)
+        _words[i] |= other._words[i];
+    if (words) [[likely]]
+        _words.back() &= TailMask(_size);
+    return *this;
+}
+
+template<std::size_t Bits, std::integral Range, typename GrowthPolicy>
+inline kF::Core::PackedVector<Bits, Range, GrowthPolicy> &kF::Core::PackedVector<Bits, Range, GrowthPolicy>::operator^=(const PackedVector &other) noexcept
+{
+    const auto words = std::min(_words.size(), other._words.size());
+
+    for (Range i = 0; i < words; ++i)
+        _words[i] ^= other._words[i];
+    if (words) [[likely]]
+        _words.back() &= TailMask(_size);
+    return *this;
+}
+
+template<std::size_t Bits, std::integral Range, typename GrowthPolicy>
+inline Range kF::Core::PackedVector<Bits, Range, GrowthPolicy>::count(void) const noexcept requires (Bits == 1)
+{
+    Range count {};
+
+    for (const auto word : _words)
+        count += static_cast<Range>(std::popcount(word));
+    return count;
+}
+
+template<std::size_t Bits, std::integral Range, typename GrowthPolicy>
+inline Range kF::Core::PackedVector<Bits, Range, GrowthPolicy>::findFirstSet(const Range from) const noexcept requires (Bits == 1)
+{
+    if (from >= _size) [[unlikely]]
+        return _size;
+    auto index = WordIndex(from);
+    auto word = _words[index] & (~Word() << BitShift(from));
+    const auto words = _words.size();
+
+    while (!word) {
+        if (++index == words)
+            return _size;
+        word = _words[index];
+    }
+    return static_cast<Range>(index * WordBits + std::countr_zero(word));
+}
+
+template<std::size_t Bits, std::integral Range, typename GrowthPolicy>
+inline Range kF::Core::PackedVector<Bits, Range, GrowthPolicy>::findFirstUnset(const Range from) const noexcept requires (Bits == 1)
+{
+    if (from >= _size) [[unlikely]]
+        return _size;
+    auto index = WordIndex(from);
+    auto word = ~_words[index] & (~Word() << BitShift(from));
+    const auto words = _words.size();
+
+    while (!word) {
+        if (++index == words)
+            return _size;
+        word = ~_words[index];
+    }
+    // Bits past the last element are zero, so their complement may be found in the last word
+    return std::min(static_cast<Range>(index * WordBits + std::countr_zero(word)), _size);
+}
+
+template<std::size_t Bits, std::integral Range, typename GrowthPolicy>
+template<typename Functor>
+    requires std::invocable<Functor &, Range>
+inline void kF::Core::PackedVector<Bits, Range, GrowthPolicy>::forEachSet(Functor &&functor) const noexcept_invocable(Functor &, Range) requires (Bits == 1)
+{
+    const auto words = _words.size();
+
+    for (Range index = 0; index < words; ++index) {
+        for (auto word = _words[index]; word; word &= word - 1)
+            functor(static_cast<Range>(index * WordBits + std::countr_zero(word)));
+    }
+}
+
+template<std::size_t Bits, std::integral Range, typename GrowthPolicy>
+inline void kF::Core::PackedVector<Bits, Range, GrowthPolicy>::setRange(const Range from, const Range to) noexcept requires (Bits == 1)
+{
+    fillRange<true>(from, to);
+}
+
+template<std::size_t Bits, std::integral Range, typename GrowthPolicy>
+inline void kF::Core::PackedVector<Bits, Range, GrowthPolicy>::clearRange(const Range from, const Range to) noexcept requires (Bits == 1)
+{
+    fillRange<false>(from, to);
+}
+
+template<std::size_t Bits, std::integral Range, typename GrowthPolicy>
+template<bool Set>
+inline void kF::Core::PackedVector<Bits, Range, GrowthPolicy>::fillRange(const Range from, const Range to) noexcept
+{
+    if (from >= to) [[unlikely]]
+        return;
+    const auto apply = [this](const Range index, const Word mask) noexcept {
+        if constexpr (Set)
+            _words[index] |= mask;
+        else
+            _words[index] &= ~mask;
+    };
+    const auto first = WordIndex(from);
+    const auto last = WordIndex(to - 1);
+    const auto firstMask = ~Word() << BitShift(from);
+    const auto lastMask = TailMask(to);
+
+    if (first == last) {
+        apply(first, firstMask & lastMask);
+        return;
+    }
+    apply(first, firstMask);
+    for (auto index = first + 1; index < last; ++index)
+        apply(index, ~Word());
+    apply(last, lastMask);
+}
+
+template<std::size_t Bits, std::integral Range, typename GrowthPolicy>
+inline constexpr typename kF::Core::PackedVector<Bits, Range, GrowthPolicy>::Word
+    kF::Core::PackedVector<Bits, Range, GrowthPolicy>::Splat(const Value value) noexcept
+{
+    Word word {};
+
+    for (auto i = 0ul; i < ElementsPerWord; ++i)
+        word |= (static_cast<Word>(value) & ElementMask) << (i * Bits);
+    return word;
+}
+
+template<std::size_t Bits, std::integral Range, typename GrowthPolicy>
+inline constexpr typename kF::Core::PackedVector<Bits, Range, GrowthPolicy>::Word
+    kF::Core::PackedVector<Bits, Range, GrowthPolicy>::TailMask(const Range count) noexcept
+{
+    const auto used = count % ElementsPerWord ? count % ElementsPerWord : ElementsPerWord;
+    const auto bits = used * Bits;
+
+    return bits == WordBits ? ~Word() : (Word(1) << bits) - 1;
+}
@@ -0,0 +1,34 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Parallel processing helpers of large arrays
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <system_error>
+#include <thread>
+
+#include "Utils.hpp"
+
+namespace kF::Core::Utils
+{
+    /** @brief Size of the pages used to split parallel work */
+    constexpr std::size_t ParallelPageSize = 4096ul;
+
+    /** @brief Minimum count of bytes processed by each thread, smaller ranges use less threads */
+    constexpr std::size_t ParallelMinimumBytes = 16ul * ParallelPageSize;
+
+    /** @brief Split [begin, end[ into at most 'threadCount' contiguous chunks and call 'functor(from, to)' on each of them in parallel
+     *  Chunk boundaries are moved to the next page so that no page is shared between two threads, which also makes
+     *  the kernel place each page on the NUMA node of the thread that first touches it
+     *  The first chunk is processed by the calling thread, as are the chunks that could not be dispatched if thread creation fails
+     *  'functor' must not throw */
+    template<typename Type, typename Functor>
+        requires std::invocable<Functor &, Type *, Type *>
+    void ParallelChunks(Type * const begin, Type * const end, const std::size_t threadCount, Functor &&functor) noexcept;
+}
+
+#include "Parallel.ipp"
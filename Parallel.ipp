@@ -0,0 +1,38 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Parallel processing helpers of large arrays
+ */
+
+template<typename Type, typename Functor>
+    requires std::invocable<Functor &, Type *, Type *>
+inline void kF::Core::Utils::ParallelChunks(Type * const begin, Type * const end, const std::size_t threadCount, Functor &&functor) noexcept
+{
+    const std::size_t size = end - begin;
+    const auto count = std::min(std::max<std::size_t>(threadCount, 1), std::max<std::size_t>(size * sizeof(Type) / ParallelMinimumBytes, 1));
+
+    if (count == 1) [[unlikely]] {
+        if (size) [[likely]]
+            functor(begin, end);
+        return;
+    }
+
+    const auto chunkSize = (size + count - 1) / count;
+    const auto base = reinterpret_cast<std::uintptr_t>(begin);
+    const auto boundary = [size, base, begin](const std::size_t index) noexcept {
+        const auto address = (base + index * sizeof(Type) + ParallelPageSize - 1) & ~(ParallelPageSize - 1);
+        return begin + std::min((address - base + sizeof(Type) - 1) / sizeof(Type), size);
+    };
+    const auto threads = std::make_unique<std::thread[]>(count - 1);
+    std::size_t dispatched = 1;
+
+    // Chunks that could not get a thread (out of system resources) are processed by the calling thread
+    try {
+        for (; dispatched < count; ++dispatched)
+            threads[dispatched - 1] = std::thread(std::ref(functor), boundary(dispatched * chunkSize), boundary((dispatched + 1) * chunkSize));
+    } catch (const std::system_error &) {}
+    functor(begin, boundary(chunkSize));
+    for (auto i = dispatched; i < count; ++i)
+        functor(boundary(i * chunkSize), boundary((i + 1) * chunkSize));
+    for (std::size_t i = 1; i < dispatched; ++i)
+        threads[i - 1].join();
+}
@@ -0,0 +1,142 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Size-class pool allocator
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <new>
+
+#include "Utils.hpp"
+
+namespace kF::Core
+{
+    class PoolAllocator;
+}
+
+/**
+ * @brief Segregated-fit allocator with power of 2 size classes and per-thread caches
+ *  Each thread carves blocks from its own chunks and recycles them through a local free list.
+ *  A block released by another thread is pushed lock-free to the owner's remote list, which the owner drains when its local list is empty.
+ *  Requests larger than MaxBlockSize fall back to Utils::AlignedAlloc.
+ *  Static 'Allocate' / 'Deallocate' entry points match the AllocateFunc / DeallocateFunc signature of Allocated containers
+ */
+class kF::Core::PoolAllocator
+{
+public:
+    /** @brief Size of a chunk, chunks are aligned to their size so a block can find its chunk by masking its address */
+    static constexpr std::size_t ChunkSize = 64 * 1024;
+
+    /** @brief Smallest block size */
+    static constexpr std::size_t MinBlockSize = sizeof(void *);
+
+    /** @brief Largest block size served by the pool */
+    static constexpr std::size_t MaxBlockSize = 4096;
+
+    /** @brief Number of size classes */
+    static constexpr std::size_t SizeClassCount = [] {
+        std::size_t count = 1;
+        for (auto size = MinBlockSize; size < MaxBlockSize; size <<= 1)
+            ++count;
+        return count;
+    }();
+
+    /** @brief Sentinel returned by SizeClassOf when the request is not pooled */
+    static constexpr std::size_t NoSizeClass = ~static_cast<std::size_t>(0);
+
+
+    /** @brief Allocate a block from the current thread cache */
+    [[nodiscard]] static void *Allocate(const std::size_t bytes, const std::size_t alignment) noexcept;
+
+    /** @brief Deallocate a block, 'bytes' and 'alignment' must be the ones used for allocation */
+    static void Deallocate(void * const data, const std::size_t bytes, const std::size_t alignment) noexcept;
+
+
+    /** @brief Get the size class index of a request or NoSizeClass if not pooled */
+    [[nodiscard]] static constexpr std::size_t SizeClassOf(const std::size_t bytes, const std::size_t alignment) noexcept;
+
+    /** @brief Get the block size of a size class */
+    [[nodiscard]] static constexpr std::size_t BlockSizeOf(const std::size_t sizeClass) noexcept
+        { return MinBlockSize << sizeClass; }
+
+private:
+    struct ThreadCache;
+
+    /** @brief Free block node */
+    struct Node
+    {
+        Node *next { nullptr };
+    };
+
+    /** @brief Header at the beginning of each chunk */
+    struct alignas_cacheline Chunk
+    {
+        ThreadCache *owner { nullptr };
+        Chunk *next { nullptr };
+        std::size_t sizeClass { 0 };
+    };
+
+    /** @brief Cache of a thread, cross-thread returns are kept on their own cachelines */
+    struct alignas_cacheline ThreadCache
+    {
+        /** @brief Bump state of a size class */
+        struct Carver
+        {
+            Chunk *chunk { nullptr };
+            std::size_t head { ChunkSize };
+        };
+
+        /** @brief Remote list of a size class */
+        struct alignas_cacheline RemoteList
+        {
+            std::atomic<Node *> head { nullptr };
+        };
+
+        Node *freeLists[SizeClassCount] {};
+        Carver carvers[SizeClassCount] {};
+        Chunk *chunks { nullptr };
+        ThreadCache *next { nullptr };
+        std::atomic<bool> used { true };
+        RemoteList remoteLists[SizeClassCount] {};
+    };
+
+    /** @brief Mark the cache of a thread as available when the thread exits */
+    struct ThreadCacheHandle
+    {
+        ThreadCache *cache { AcquireThreadCache() };
+
+        ~ThreadCacheHandle(void) noexcept
+        {
+            LocalThreadCachePointer() = &TornDownThreadCache();
+            cache->used.store(false, std::memory_order_release);
+        }
+    };
+
+
+    /** @brief Get the cache of the current thread, TornDownThreadCache once the thread cache is destroyed */
+    [[nodiscard]] static ThreadCache &LocalThreadCache(void) noexcept;
+
+    /** @brief Get the cache pointer of the current thread, null until first use */
+    [[nodiscard]] static ThreadCache *&LocalThreadCachePointer(void) noexcept;
+
+    /** @brief Get the cache used by a thread after its own cache has been destroyed
+     *  It never owns chunks nor free blocks, so deallocations go through remote lists and allocations reach the slow path */
+    [[nodiscard]] static ThreadCache &TornDownThreadCache(void) noexcept;
+
+    /** @brief Adopt a cache left by a terminated thread or create a new one */
+    [[nodiscard]] static ThreadCache *AcquireThreadCache(void) noexcept;
+
+    /** @brief List of every thread cache ever created */
+    [[nodiscard]] static std::atomic<ThreadCache *> &ThreadCaches(void) noexcept;
+
+    /** @brief Allocate a block of a size class from a cache */
+    [[nodiscard]] static void *AllocateFrom(ThreadCache &cache, const std::size_t sizeClass) noexcept;
+
+    /** @brief Allocation slow path, drains remote list or carves a new block */
+    [[nodiscard]] static void *AllocateSlow(ThreadCache &cache, const std::size_t sizeClass) noexcept;
+};
+
+#include "PoolAllocator.ipp"
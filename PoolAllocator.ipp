@@ -0,0 +1,134 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Size-class pool allocator
+ */
+
+inline constexpr std::size_t kF::Core::PoolAllocator::SizeClassOf(const std::size_t bytes, const std::size_t alignment) noexcept
+{
+    const auto size = std::max({ bytes, alignment, MinBlockSize });
+
+    if (size > MaxBlockSize) [[unlikely]]
+        return NoSizeClass;
+    return static_cast<std::size_t>(std::bit_width(size - 1) - std::bit_width(MinBlockSize - 1));
+}
+
+inline void *kF::Core::PoolAllocator::Allocate(const std::size_t bytes, const std::size_t alignment) noexcept
+{
+    const auto sizeClass = SizeClassOf(bytes, alignment);
+
+    if (sizeClass == NoSizeClass) [[unlikely]]
+        return Utils::AlignedAlloc(bytes, alignment);
+    return AllocateFrom(LocalThreadCache(), sizeClass);
+}
+
+inline void kF::Core::PoolAllocator::Deallocate(void * const data, const std::size_t bytes, const std::size_t alignment) noexcept
+{
+    const auto sizeClass = SizeClassOf(bytes, alignment);
+
+    if (!data) [[unlikely]]
+        return;
+    else if (sizeClass == NoSizeClass) [[unlikely]]
+        return Utils::AlignedFree(data);
+    const auto chunk = reinterpret_cast<Chunk *>(reinterpret_cast<std::uintptr_t>(data) & ~(ChunkSize - 1));
+    const auto node = reinterpret_cast<Node *>(data);
+    auto &cache = LocalThreadCache();
+    if (chunk->owner == &cache) [[likely]] {
+        node->next = cache.freeLists[sizeClass];
+        cache.freeLists[sizeClass] = node;
+    } else {
+        auto &remote = chunk->owner->remoteLists[sizeClass].head;
+        node->next = remote.load(std::memory_order_relaxed);
+        while (!remote.compare_exchange_weak(node->next, node, std::memory_order_release, std::memory_order_relaxed));
+    }
+}
+
+inline void *kF::Core::PoolAllocator::AllocateFrom(ThreadCache &cache, const std::size_t sizeClass) noexcept
+{
+    if (const auto node = cache.freeLists[sizeClass]; node) [[likely]] {
+        cache.freeLists[sizeClass] = node->next;
+        return node;
+    }
+    return AllocateSlow(cache, sizeClass);
+}
+
+inline void *kF::Core::PoolAllocator::AllocateSlow(ThreadCache &cache, const std::size_t sizeClass) noexcept
+{
+    // The thread cache is destroyed (thread_local teardown), borrow an unused cache for this allocation only
+    if (&cache == &TornDownThreadCache()) [[unlikely]] {
+        const auto borrowed = AcquireThreadCache();
+        const auto data = AllocateFrom(*borrowed, sizeClass);
+        borrowed->used.store(false, std::memory_order_release);
+        return data;
+    }
+
+    // Drain every block released by other threads at once, pushers never pop so there is no ABA
+    if (auto node = cache.remoteLists[sizeClass].head.exchange(nullptr, std::memory_order_acquire); node) {
+        cache.freeLists[sizeClass] = node->next;
+        return node;
+    }
+
+    // Carve a new block from the current chunk of the size class
+    const auto blockSize = BlockSizeOf(sizeClass);
+    auto &carver = cache.carvers[sizeClass];
+    if (carver.head + blockSize > ChunkSize) [[unlikely]] {
+        const auto chunk = Utils::AlignedAlloc<ChunkSize, Chunk>(ChunkSize);
+        if (!chunk) [[unlikely]]
+            return nullptr;
+        new (chunk) Chunk { &cache, cache.chunks, sizeClass };
+        cache.chunks = chunk;
+        carver.chunk = chunk;
+        carver.head = (sizeof(Chunk) + blockSize - 1) & ~(blockSize - 1);
+    }
+    const auto data = reinterpret_cast<std::byte *>(carver.chunk) + carver.head;
+    carver.head += blockSize;
+    return data;
+}
+
+inline kF::Core::PoolAllocator::ThreadCache &kF::Core::PoolAllocator::LocalThreadCache(void) noexcept
+{
+    // Trivial thread_local pointer avoids the initialization guard of the handle on the fast path
+    auto &cache = LocalThreadCachePointer();
+
+    if (!cache) [[unlikely]] {
+        static thread_local ThreadCacheHandle handle;
+        cache = handle.cache;
+    }
+    return *cache;
+}
+
+inline kF::Core::PoolAllocator::ThreadCache *&kF::Core::PoolAllocator::LocalThreadCachePointer(void) noexcept
+{
+    static thread_local ThreadCache *cache { nullptr };
+
+    return cache;
+}
+
+inline kF::Core::PoolAllocator::ThreadCache &kF::Core::PoolAllocator::TornDownThreadCache(void) noexcept
+{
+    static constinit ThreadCache cache {};
+
+    return cache;
+}
+
+inline std::atomic<kF::Core::PoolAllocator::ThreadCache *> &kF::Core::PoolAllocator::ThreadCaches(void) noexcept
+{
+    static std::atomic<ThreadCache *> caches { nullptr };
+
+    return caches;
+}
+
+inline kF::Core::PoolAllocator::ThreadCache *kF::Core::PoolAllocator::AcquireThreadCache(void) noexcept
+{
+    auto &caches = ThreadCaches();
+
+    // Caches are never released because their chunks may still be referenced by other threads
+    for (auto cache = caches.load(std::memory_order_acquire); cache; cache = cache->next) {
+        bool expected = false;
+        if (cache->used.compare_exchange_strong(expected, true, std::memory_order_acquire))
+            return cache;
+    }
+    const auto cache = new (Utils::AlignedAlloc<alignof(ThreadCache), ThreadCache>(sizeof(ThreadCache))) ThreadCache {};
+    cache->next = caches.load(std::memory_order_relaxed);
+    while (!caches.compare_exchange_weak(cache->next, cache, std::memory_order_release, std::memory_order_relaxed));
+    return cache;
+}
@@ -0,0 +1,163 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Shared copy-on-write flat container
+ */
+
+#pragma once
+
+#include <atomic>
+#include <string_view>
+
+#include "Utils.hpp"
+
+namespace kF::Core::Internal
+{
+    /** @brief Custom header of shared flat containers, counting the instances sharing a buffer */
+    struct SharedFlatHeader
+    {
+        /** @brief Count of instances sharing the buffer */
+        mutable std::atomic<std::uint32_t> refCount { 1u };
+
+        /** @brief Default constructor */
+        SharedFlatHeader(void) noexcept = default;
+
+        /** @brief Move constructor, only used when a unique buffer is reallocated */
+        SharedFlatHeader(SharedFlatHeader &&other) noexcept
+            : refCount(other.refCount.load(std::memory_order_relaxed)) {}
+    };
+
+    template<typename Container, typename Type, std::integral Range>
+    class SharedFlatDetails;
+}
+
+/** @brief Read-only flat container whose copies share the same buffer until one of them is edited
+ *  The buffer is cloned by 'edit' only if it is shared, copies and destructions are thread safe */
+template<typename Container, typename Type, std::integral Range>
+class kF::Core::Internal::SharedFlatDetails : private Container
+{
+public:
+    /** @brief Container returned by 'edit' */
+    using EditableContainer = Container;
+
+    /** @brief Input iterator */
+    using ConstIterator = const Type *;
+
+    /** @brief Reverse input iterator */
+    using ConstReverseIterator = std::reverse_iterator<ConstIterator>;
+
+    /** @brief Read-only base functions */
+    using Container::size;
+    using Container::capacity;
+    using Container::empty;
+    using Container::isSafe;
+    using Container::operator bool;
+
+
+    /** @brief Default constructor */
+    SharedFlatDetails(void) noexcept = default;
+
+    /** @brief Copy constructor, shares the buffer of other */
+    SharedFlatDetails(const SharedFlatDetails &other) noexcept : Container() { share(other); }
+
+    /** @brief Move constructor */
+    SharedFlatDetails(SharedFlatDetails &&other) noexcept = default;
+
+    /** @brief Adopt a container */
+    SharedFlatDetails(Container &&container) noexcept : Container(std::move(container)) {}
+
+    /** @brief Initializer list constructor */
+    SharedFlatDetails(std::initializer_list<Type> &&init) noexcept_forward_constructible(Type) : Container(std::move(init)) {}
+
+    /** @brief Forward any other arguments to the container constructor */
+    template<typename ...Args>
+        requires (std::constructible_from<Container, Args...>
+            && !(sizeof...(Args) == 1 && (std::is_same_v<std::remove_cvref_t<Args>, SharedFlatDetails> && ...)))
+    SharedFlatDetails(Args &&...args) noexcept(nothrow_constructible(Container, Args...))
+        : Container(std::forward<Args>(args)...) {}
+
+    /** @brief Release the buffer if the instance is the last to share it */
+    ~SharedFlatDetails(void) noexcept_destructible(Type) { release(); }
+
+    /** @brief Copy assignment, shares the buffer of other */
+    SharedFlatDetails &operator=(const SharedFlatDetails &other) noexcept_destructible(Type);
+
+    /** @brief Move assignment */
+    SharedFlatDetails &operator=(SharedFlatDetails &&other) noexcept_destructible(Type)
+        { release(); Container::steal(other); return *this; }
+
+    /** @brief Swap two instances */
+    void swap(SharedFlatDetails &other) noexcept { Container::swap(other); }
+
+
+    /** @brief Get internal data pointer */
+    [[nodiscard]] const Type *data(void) const noexcept { return Container::data(); }
+
+    /** @brief Begin / end overloads */
+    [[nodiscard]] ConstIterator begin(void) const noexcept { return Container::begin(); }
+    [[nodiscard]] ConstIterator end(void) const noexcept { return Container::end(); }
+    [[nodiscard]] ConstIterator cbegin(void) const noexcept { return begin(); }
+    [[nodiscard]] ConstIterator cend(void) const noexcept { return end(); }
+
+    /** @brief Reverse begin / end overloads */
+    [[nodiscard]] ConstReverseIterator rbegin(void) const noexcept { return std::make_reverse_iterator(end()); }
+    [[nodiscard]] ConstReverseIterator rend(void) const noexcept { return std::make_reverse_iterator(begin()); }
+
+    /** @brief Access element at positon */
+    [[nodiscard]] const Type &at(const Range pos) const noexcept { return data()[pos]; }
+    [[nodiscard]] const Type &operator[](const Range pos) const noexcept { return data()[pos]; }
+
+    /** @brief Get first element */
+    [[nodiscard]] const Type &front(void) const noexcept { return at(0); }
+
+    /** @brief Get last element */
+    [[nodiscard]] const Type &back(void) const noexcept { return at(size() - 1); }
+
+    /** @brief Get a std::basic_string_view of the string */
+    [[nodiscard]] std::basic_string_view<Type> toStdView(void) const noexcept
+        requires requires(const Container &container) { container.toStdView(); }
+        { return Container::toStdView(); }
+
+
+    /** @brief Get the count of instances sharing the buffer, 0 if there is no buffer */
+    [[nodiscard]] std::uint32_t useCount(void) const noexcept
+        { return isSafe() ? Container::headerCustomType().refCount.load(std::memory_order_acquire) : 0u; }
+
+    /** @brief Check if the instance is the only one to use its buffer */
+    [[nodiscard]] bool isUnique(void) const noexcept { return useCount() == 1u; }
+
+
+    /** @brief Clone the buffer if it is shared, then get the editable container
+     *  The reference must not be used once another instance shares the buffer */
+    [[nodiscard]] Container &edit(void) noexcept(nothrow_copy_constructible(Type) && nothrow_destructible(Type));
+
+    /** @brief Clone the buffer if it is shared */
+    void detach(void) noexcept(nothrow_copy_constructible(Type) && nothrow_destructible(Type));
+
+    /** @brief Drop the buffer, which is released if the instance was the last to share it */
+    void release(void) noexcept_destructible(Type);
+
+
+    /** @brief Comparison operators, instances sharing a buffer are equal without comparing elements */
+    [[nodiscard]] bool operator==(const SharedFlatDetails &other) const noexcept
+        { return data() == other.data() || std::equal(begin(), end(), other.begin(), other.end()); }
+    [[nodiscard]] bool operator!=(const SharedFlatDetails &other) const noexcept { return !operator==(other); }
+
+    /** @brief Comparison operators with any other range */
+    template<typename Other> requires requires(const Other &other) { std::begin(other); std::end(other); }
+    [[nodiscard]] bool operator==(const Other &other) const noexcept
+        { return std::equal(begin(), end(), std::begin(other), std::end(other)); }
+    template<typename Other> requires requires(const Other &other) { std::begin(other); std::end(other); }
+    [[nodiscard]] bool operator!=(const Other &other) const noexcept { return !operator==(other); }
+
+private:
+    /** @brief Share the buffer of another instance, the current one must be released */
+    void share(const SharedFlatDetails &other) noexcept;
+};
+
+/** @brief A shared flat container only holds a pointer */
+template<typename Container, typename Type, std::integral Range>
+struct kF::Core::IsTriviallyRelocatable<kF::Core::Internal::SharedFlatDetails<Container, Type, Range>>
+    : public kF::Core::IsTriviallyRelocatable<Container>
+{};
+
+#include "SharedFlatDetails.ipp"
@@ -0,0 +1,55 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Shared copy-on-write flat container
+ */
+
+template<typename Container, typename Type, std::integral Range>
+inline kF::Core::Internal::SharedFlatDetails<Container, Type, Range> &
+    kF::Core::Internal::SharedFlatDetails<Container, Type, Range>::operator=(const SharedFlatDetails &other) noexcept_destructible(Type)
+{
+    if (data() != other.data()) [[likely]] {
+        release();
+        share(other);
+    }
+    return *this;
+}
+
+template<typename Container, typename Type, std::integral Range>
+inline Container &kF::Core::Internal::SharedFlatDetails<Container, Type, Range>::edit(void)
+    noexcept(nothrow_copy_constructible(Type) && nothrow_destructible(Type))
+{
+    detach();
+    return *this;
+}
+
+template<typename Container, typename Type, std::integral Range>
+inline void kF::Core::Internal::SharedFlatDetails<Container, Type, Range>::detach(void)
+    noexcept(nothrow_copy_constructible(Type) && nothrow_destructible(Type))
+{
+    if (!isSafe() || Container::headerCustomType().refCount.load(std::memory_order_acquire) == 1u)
+        return;
+    Container copy(static_cast<const Container &>(*this));
+    release();
+    Container::steal(copy);
+}
+
+template<typename Container, typename Type, std::integral Range>
+inline void kF::Core::Internal::SharedFlatDetails<Container, Type, Range>::release(void) noexcept_destructible(Type)
+{
+    if (!isSafe())
+        return;
+    // The last instance to drop the buffer must observe every write made by the other ones
+    if (Container::headerCustomType().refCount.fetch_sub(1u, std::memory_order_acq_rel) == 1u)
+        Container::release();
+    else
+        Container::setData(nullptr);
+}
+
+template<typename Container, typename Type, std::integral Range>
+inline void kF::Core::Internal::SharedFlatDetails<Container, Type, Range>::share(const SharedFlatDetails &other) noexcept
+{
+    if (!other.isSafe())
+        return;
+    other.headerCustomType().refCount.fetch_add(1u, std::memory_order_relaxed);
+    Container::setData(const_cast<Type *>(other.data()));
+}
@@ -0,0 +1,34 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Shared copy-on-write flat string
+ */
+
+#pragma once
+
+#include "StringDetails.hpp"
+#include "SharedFlatVector.hpp"
+
+namespace kF::Core
+{
+    /**
+     * @brief 8 bytes read-only string whose copies share the same buffer, with a reference counter in its header
+     * The string is non-null terminated
+     *
+     * @tparam Type Type of character
+     * @tparam Range Range of container
+     */
+    template<typename Type, std::integral Range = std::size_t>
+    using SharedFlatStringBase = Internal::SharedFlatDetails<
+        Internal::StringDetails<FlatVector<Type, Range, Internal::SharedFlatHeader>, Type, Range>, Type, Range>;
+
+    /** @brief 8 bytes shared string using signed char and size_t range
+     *  The string is non-null terminated */
+    using SharedFlatString = SharedFlatStringBase<char, std::size_t>;
+
+    /** @brief 8 bytes shared string using signed char with a reduced range
+     *  The string is non-null terminated */
+    using TinySharedFlatString = SharedFlatStringBase<char, std::uint32_t>;
+}
+
+static_assert_sizeof(kF::Core::SharedFlatString, kF::Core::CacheLineEighthSize);
+static_assert_sizeof(kF::Core::TinySharedFlatString, kF::Core::CacheLineEighthSize);
@@ -0,0 +1,27 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Shared copy-on-write flat vector
+ */
+
+#pragma once
+
+#include "FlatVector.hpp"
+#include "SharedFlatDetails.hpp"
+
+namespace kF::Core
+{
+    /**
+     * @brief 8 bytes read-only vector whose copies share the same buffer, with a reference counter in its header
+     *  Copies are O(1) and the buffer is only cloned when a shared instance is edited
+     *
+     * @tparam Type Internal type in container
+     * @tparam Range Range of container
+     * @tparam GrowthPolicy Capacity growth policy
+     */
+    template<typename Type, std::integral Range = std::size_t, typename GrowthPolicy = DefaultGrowthPolicy>
+    using SharedFlatVector = Internal::SharedFlatDetails<FlatVector<Type, Range, Internal::SharedFlatHeader, GrowthPolicy>, Type, Range>;
+
+    /** @brief 8 bytes shared vector with a reduced range */
+    template<typename Type, typename GrowthPolicy = DefaultGrowthPolicy>
+    using TinySharedFlatVector = SharedFlatVector<Type, std::uint32_t, GrowthPolicy>;
+}
@@ -0,0 +1,50 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: SIMD search helpers of sorted arrays
+ */
+
+#pragma once
+
+#include <bit>
+#include <functional>
+#include <limits>
+
+#include "Utils.hpp"
+
+#if (defined(__GNUC__) || defined(__clang__)) && defined(__x86_64__)
+# define KUBE_SIMD_SEARCH_X86 true
+# include <immintrin.h>
+#else
+# define KUBE_SIMD_SEARCH_X86 false
+#endif
+
+namespace kF::Core::Utils
+{
+    /** @brief Element types searched with SIMD comparisons, 4 and 8 bytes integers and floating points */
+    template<typename Type>
+    concept SimdSearchable = std::is_arithmetic_v<Type> && !std::is_same_v<Type, bool> && (sizeof(Type) == 4 || sizeof(Type) == 8);
+
+    /** @brief Element types and comparators searched with SIMD comparisons, only ascending orders are supported */
+    template<typename Type, typename Compare>
+    concept SimdSearchableCompare = SimdSearchable<Type> && (std::is_same_v<Compare, std::less<Type>> || std::is_same_v<Compare, std::less<>>);
+
+    /** @brief Count of elements the binary search narrows down to before comparing them all at once */
+    template<typename Type>
+    constexpr std::size_t SimdSearchWindow = 4ul * CacheLineSize / sizeof(Type);
+
+    /** @brief Count the elements of [begin, begin + count[ lower than 'value', or lower or equal if 'Inclusive'
+     *  Uses AVX2 when the running processor supports it, SSE2 or a scalar loop otherwise */
+    template<bool Inclusive, typename Type> requires SimdSearchable<Type>
+    [[nodiscard]] std::size_t SimdCountBefore(const Type * const begin, const std::size_t count, const Type value) noexcept;
+
+    /** @brief Equivalent of std::lower_bound over an ascending range
+     *  The binary search stops once 'SimdSearchWindow' elements remain, their position is found with SIMD comparisons */
+    template<typename Type> requires SimdSearchable<std::remove_const_t<Type>>
+    [[nodiscard]] Type *SimdLowerBound(Type * const begin, Type * const end, const std::remove_const_t<Type> value) noexcept;
+
+    /** @brief Equivalent of std::upper_bound over an ascending range */
+    template<typename Type> requires SimdSearchable<std::remove_const_t<Type>>
+    [[nodiscard]] Type *SimdUpperBound(Type * const begin, Type * const end, const std::remove_const_t<Type> value) noexcept;
+}
+
+#include "SimdSearch.ipp"
@@ -0,0 +1,157 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: SIMD search helpers of sorted arrays
+ */
+
+namespace kF::Core::Internal
+{
+    /** @brief Count the elements before 'value' one at a time */
+    template<bool Inclusive, typename Type>
+    [[nodiscard]] inline std::size_t SimdCountBeforeScalar(const Type * const begin, const std::size_t count, const Type value) noexcept
+    {
+        std::size_t total = 0;
+
+        for (auto i = 0ul; i < count; ++i) {
+            if constexpr (Inclusive)
+                total += static_cast<std::size_t>(!(value < begin[i]));
+            else
+                total += static_cast<std::size_t>(begin[i] < value);
+        }
+        return total;
+    }
+
+#if KUBE_SIMD_SEARCH_X86
+    /** @brief Count the elements before 'value' 4 (32 bits) or 2 (64 bits) at a time, 64 bits integers fall back to scalar */
+    template<bool Inclusive, typename Type>
+    [[nodiscard]] inline std::size_t SimdCountBeforeSse2(const Type * const begin, const std::size_t count, const Type value) noexcept
+    {
+        constexpr auto Lanes = 16ul / sizeof(Type);
+        std::size_t total = 0, i = 0;
+
+        if constexpr (std::is_same_v<Type, float>) {
+            const auto pivot = _mm_set1_ps(value);
+            for (; i + Lanes <= count; i += Lanes) {
+                const auto data = _mm_loadu_ps(begin + i);
+                const auto mask = Inclusive ? _mm_cmple_ps(data, pivot) : _mm_cmplt_ps(data, pivot);
+                total += static_cast<std::size_t>(std::popcount(static_cast<unsigned int>(_mm_movemask_ps(mask))));
+            }
+        } else if constexpr (std::is_same_v<Type, double>) {
+            const auto pivot = _mm_set1_pd(value);
+            for (; i + Lanes <= count; i += Lanes) {
+                const auto data = _mm_loadu_pd(begin + i);
+                const auto mask = Inclusive ? _mm_cmple_pd(data, pivot) : _mm_cmplt_pd(data, pivot);
+                total += static_cast<std::size_t>(std::popcount(static_cast<unsigned int>(_mm_movemask_pd(mask))));
+            }
+        } else if constexpr (sizeof(Type) == 4) {
+            // Unsigned integers are compared as signed ones once their sign bit is flipped
+            const auto bias = _mm_set1_epi32(std::is_signed_v<Type> ? 0 : std::numeric_limits<std::int32_t>::min());
+            const auto pivot = _mm_xor_si128(_mm_set1_epi32(static_cast<std::int32_t>(value)), bias);
+            for (; i + Lanes <= count; i += Lanes) {
+                const auto data = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i *>(begin + i)), bias);
+                const auto mask = Inclusive ? _mm_cmpgt_epi32(data, pivot) : _mm_cmpgt_epi32(pivot, data);
+                const auto bits = static_cast<std::size_t>(std::popcount(static_cast<unsigned int>(_mm_movemask_ps(_mm_castsi128_ps(mask)))));
+                total += Inclusive ? Lanes - bits : bits;
+            }
+        }
+        return total + SimdCountBeforeScalar<Inclusive>(begin + i, count - i, value);
+    }
+
+    /** @brief Count the elements before 'value' 8 (32 bits) or 4 (64 bits) at a time */
+    template<bool Inclusive, typename Type>
+    [[nodiscard]] __attribute__((target("avx2")))
+    inline std::size_t SimdCountBeforeAvx2(const Type * const begin, const std::size_t count, const Type value) noexcept
+    {
+        constexpr auto Lanes = 32ul / sizeof(Type);
+        std::size_t total = 0, i = 0;
+
+        if constexpr (std::is_same_v<Type, float>) {
+            const auto pivot = _mm256_set1_ps(value);
+            for (; i + Lanes <= count; i += Lanes) {
+                const auto mask = _mm256_cmp_ps(_mm256_loadu_ps(begin + i), pivot, Inclusive ? _CMP_LE_OQ : _CMP_LT_OQ);
+                total += static_cast<std::size_t>(std::popcount(static_cast<unsigned int>(_mm256_movemask_ps(mask))));
+            }
+        } else if constexpr (std::is_same_v<Type, double>) {
+            const auto pivot = _mm256_set1_pd(value);
+            for (; i + Lanes <= count; i += Lanes) {
+                const auto mask = _mm256_cmp_pd(_mm256_loadu_pd(begin + i), pivot, Inclusive ? _CMP_LE_OQ : _CMP_LT_OQ);
+                total += static_cast<std::size_t>(std::popcount(static_cast<unsigned int>(_mm256_movemask_pd(mask))));
+            }
+        } else if constexpr (sizeof(Type) == 4) {
+            const auto bias = _mm256_set1_epi32(std::is_signed_v<Type> ? 0 : std::numeric_limits<std::int32_t>::min());
+            const auto pivot = _mm256_xor_si256(_mm256_set1_epi32(static_cast<std::int32_t>(value)), bias);
+            for (; i + Lanes <= count; i += Lanes) {
+                const auto data = _mm256_xor_si256(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(begin + i)), bias);
+                const auto mask = Inclusive ? _mm256_cmpgt_epi32(data, pivot) : _mm256_cmpgt_epi32(pivot, data);
+                const auto bits = static_cast<std::size_t>(std::popcount(static_cast<unsigned int>(_mm256_movemask_ps(_mm256_castsi256_ps(mask)))));
+                total += Inclusive ? Lanes - bits : bits;
+            }
+        } else {
+            const auto bias = _mm256_set1_epi64x(std::is_signed_v<Type> ? 0 : std::numeric_limits<std::int64_t>::min());
+            const auto pivot = _mm256_xor_si256(_mm256_set1_epi64x(static_cast<std::int64_t>(value)), bias);
+            for (; i + Lanes <= count; i += Lanes) {
+                const auto data = _mm256_xor_si256(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(begin + i)), bias);
+                const auto mask = Inclusive ? _mm256_cmpgt_epi64(data, pivot) : _mm256_cmpgt_epi64(pivot, data);
+                const auto bits = static_cast<std::size_t>(std::popcount(static_cast<unsigned int>(_mm256_movemask_pd(_mm256_castsi256_pd(mask)))));
+                total += Inclusive ? Lanes - bits : bits;
+            }
+        }
+        return total + SimdCountBeforeScalar<Inclusive>(begin + i, count - i, value);
+    }
+
+    /** @brief Check once if the running processor supports AVX2 */
+    [[nodiscard]] inline bool SimdSearchHasAvx2(void) noexcept
+    {
+        static const bool HasAvx2 = [] {
+            __builtin_cpu_init();
+            return __builtin_cpu_supports("avx2") != 0;
+        }();
+        return HasAvx2;
+    }
+#endif
+
+    /** @brief Narrow [begin, end[ with a branchless binary search, then count the remaining elements before 'value' */
+    template<bool Inclusive, typename Type>
+    [[nodiscard]] inline Type *SimdBound(Type *begin, Type * const end, const std::remove_const_t<Type> value) noexcept
+    {
+        auto count = static_cast<std::size_t>(end - begin);
+
+        while (count > Utils::SimdSearchWindow<std::remove_const_t<Type>>) {
+            const auto half = count / 2;
+#if defined(__GNUC__) || defined(__clang__)
+            // Both candidates of the next probe are fetched while the current comparison resolves
+            __builtin_prefetch(begin + half / 2);
+            __builtin_prefetch(begin + half + half / 2);
+#endif
+            if constexpr (Inclusive)
+                begin = !(value < begin[half]) ? begin + half : begin;
+            else
+                begin = begin[half] < value ? begin + half : begin;
+            count -= half;
+        }
+        return begin + Utils::SimdCountBefore<Inclusive>(static_cast<const std::remove_const_t<Type> *>(begin), count, value);
+    }
+}
+
+template<bool Inclusive, typename Type> requires kF::Core::Utils::SimdSearchable<Type>
+inline std::size_t kF::Core::Utils::SimdCountBefore(const Type * const begin, const std::size_t count, const Type value) noexcept
+{
+#if KUBE_SIMD_SEARCH_X86
+    if (Internal::SimdSearchHasAvx2()) [[likely]]
+        return Internal::SimdCountBeforeAvx2<Inclusive>(begin, count, value);
+    return Internal::SimdCountBeforeSse2<Inclusive>(begin, count, value);
+#else
+    return Internal::SimdCountBeforeScalar<Inclusive>(begin, count, value);
+#endif
+}
+
+template<typename Type> requires kF::Core::Utils::SimdSearchable<std::remove_const_t<Type>>
+inline Type *kF::Core::Utils::SimdLowerBound(Type * const begin, Type * const end, const std::remove_const_t<Type> value) noexcept
+{
+    return Internal::SimdBound<false>(begin, end, value);
+}
+
+template<typename Type> requires kF::Core::Utils::SimdSearchable<std::remove_const_t<Type>>
+inline Type *kF::Core::Utils::SimdUpperBound(Type * const begin, Type * const end, const std::remove_const_t<Type> value) noexcept
+{
+    return Internal::SimdBound<true>(begin, end, value);
+}
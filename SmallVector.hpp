@@ -7,6 +7,7 @@
 
 #include "VectorDetails.hpp"
 #include "SmallVectorBase.hpp"
+#include "CompactSmallVectorBase.hpp"
 
 namespace kF::Core
 {
@@ -16,11 +17,28 @@ namespace kF::Core
      * @tparam Type Internal type in container
      * @tparam OptimizedCapacity Count of element in the optimized cache
      * @tparam Range Range of container
+     * @tparam GrowthPolicy Capacity growth policy
      */
-    template<typename Type, std::size_t OptimizedCapacity, std::integral Range = std::size_t>
-    using SmallVector = Internal::VectorDetails<Internal::SmallVectorBase<Type, OptimizedCapacity, Range>, Type, Range, true>;
+    template<typename Type, std::size_t OptimizedCapacity, std::integral Range = std::size_t, typename GrowthPolicy = DefaultGrowthPolicy>
+    using SmallVector = Internal::VectorDetails<Internal::SmallVectorBase<Type, OptimizedCapacity, Range>, Type, Range, true, GrowthPolicy>;
 
     /** @brief Small optimized vector with a reduced range */
-    template<typename Type, std::size_t OptimizedCapacity>
-    using TinySmallVector = SmallVector<Type, OptimizedCapacity, std::uint32_t>;
+    template<typename Type, std::size_t OptimizedCapacity, typename GrowthPolicy = DefaultGrowthPolicy>
+    using TinySmallVector = SmallVector<Type, OptimizedCapacity, std::uint32_t, GrowthPolicy>;
+
+    /**
+     * @brief Small vector whose cache overlaps its heap pointer and capacity, the cache state is tagged in the size
+     *  Only the cache (or the heap state when larger) and the size are stored, at the cost of halving the maximum size
+     *
+     * @tparam Type Internal type in container
+     * @tparam OptimizedCapacity Count of element in the optimized cache
+     * @tparam Range Range of container, must be unsigned
+     * @tparam GrowthPolicy Capacity growth policy
+     */
+    template<typename Type, std::size_t OptimizedCapacity, std::integral Range = std::size_t, typename GrowthPolicy = DefaultGrowthPolicy>
+    using CompactSmallVector = Internal::VectorDetails<Internal::CompactSmallVectorBase<Type, OptimizedCapacity, Range>, Type, Range, true, GrowthPolicy>;
+
+    /** @brief Compact small optimized vector with a reduced range */
+    template<typename Type, std::size_t OptimizedCapacity, typename GrowthPolicy = DefaultGrowthPolicy>
+    using TinyCompactSmallVector = CompactSmallVector<Type, OptimizedCapacity, std::uint32_t, GrowthPolicy>;
 }
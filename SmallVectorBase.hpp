@@ -62,11 +62,11 @@ public:
     [[nodiscard]] ConstIterator end(void) const noexcept { return endUnsafe(); }
 
 
-    /** @brief Steal another instance */
-    void steal(SmallVectorBase &other) noexcept_forward_constructible(Type);
+    /** @brief Steal another instance, a trivially relocatable cache is copied at once */
+    void steal(SmallVectorBase &other) noexcept(nothrow_forward_constructible(Type) && nothrow_destructible(Type));
 
-    /** @brief Swap two instances */
-    void swap(SmallVectorBase &other) noexcept_forward_assignable(Type);
+    /** @brief Swap two instances, trivially relocatable caches are exchanged at once */
+    void swap(SmallVectorBase &other) noexcept(nothrow_forward_constructible(Type) && nothrow_destructible(Type) && std::is_nothrow_swappable_v<Type>);
 
 
     /** @brief Tell if the vector currently use its cache or a heap allocation*/
@@ -103,4 +103,11 @@ private:
     Type *_data { nullptr };
 };
 
+/** @brief SmallVectorBase may point to its own cache */
+template<typename Type, std::size_t OptimizedCapacity, std::integral Range>
+struct kF::Core::IsTriviallyRelocatable<kF::Core::Internal::SmallVectorBase<Type, OptimizedCapacity, Range>>
+{
+    static constexpr bool Value = false;
+};
+
 #include "SmallVectorBase.ipp"
\ No newline at end of file
@@ -5,14 +5,17 @@
 
 template<typename Type, std::size_t OptimizedCapacity, std::integral Range>
 inline void kF::Core::Internal::SmallVectorBase<Type, OptimizedCapacity, Range>::steal(SmallVectorBase &other)
-    noexcept_forward_constructible(Type)
+    noexcept(nothrow_forward_constructible(Type) && nothrow_destructible(Type))
 {
     if (_data) {
         std::destroy(beginUnsafe(), endUnsafe());
         deallocate(_data, _capacity);
     }
     if (other.isCacheUsed()) {
-        std::uninitialized_move(other.beginUnsafe(), other.endUnsafe(), optimizedData());
+        if constexpr (IsTriviallyRelocatable<Type>::Value)
+            std::memcpy(&_optimizedData, &other._optimizedData, sizeof(_optimizedData));
+        else
+            Utils::RelocateForward(other.beginUnsafe(), other.endUnsafe(), optimizedData());
         _data = optimizedData();
     } else {
         _data = other._data;
@@ -26,38 +29,46 @@ inline void kF::Core::Internal::SmallVectorBase<Type, OptimizedCapacity, Range>:
 
 template<typename Type, std::size_t OptimizedCapacity, std::integral Range>
 inline void kF::Core::Internal::SmallVectorBase<Type, OptimizedCapacity, Range>::swap(SmallVectorBase &other)
-    noexcept_forward_assignable(Type)
+    noexcept(nothrow_forward_constructible(Type) && nothrow_destructible(Type) && std::is_nothrow_swappable_v<Type>)
 {
-    const auto begin = beginUnsafe();
-    const auto otherBegin = other.beginUnsafe();
+    const bool cacheUsed = isCacheUsed();
+    const bool otherCacheUsed = other.isCacheUsed();
 
-    if (other.isCacheUsed()) {
-        if (isCacheUsed()) {
+    if constexpr (IsTriviallyRelocatable<Type>::Value) {
+        // Whole caches are exchanged regardless of their sizes, a fixed size copy is cheaper than a per element one
+        if (cacheUsed && otherCacheUsed) {
+            alignas(alignof(Type)) std::byte tmp[sizeof(_optimizedData)];
+            std::memcpy(&tmp, &_optimizedData, sizeof(_optimizedData));
+            std::memcpy(&_optimizedData, &other._optimizedData, sizeof(_optimizedData));
+            std::memcpy(&other._optimizedData, &tmp, sizeof(_optimizedData));
+        } else if (cacheUsed) {
+            std::memcpy(&other._optimizedData, &_optimizedData, sizeof(_optimizedData));
+        } else if (otherCacheUsed) {
+            std::memcpy(&_optimizedData, &other._optimizedData, sizeof(_optimizedData));
+        }
+    } else {
+        if (cacheUsed && otherCacheUsed) {
             const auto size = sizeUnsafe();
             const auto otherSize = other.sizeUnsafe();
-            if (size < otherSize) {
-                std::swap_ranges(begin, endUnsafe(), otherBegin);
-                std::uninitialized_move(begin + (otherSize - size), endUnsafe(), otherBegin + size);
-            } else if (size > otherSize) {
-                std::swap_ranges(otherBegin, other.endUnsafe(), otherBegin);
-                std::uninitialized_move(otherBegin + (otherSize - size), other.endUnsafe(), begin + otherSize);
-            } else {
-                std::swap_ranges(begin, endUnsafe(), otherBegin);
-            }
-        } else {
-            std::uninitialized_move(other.begin(), other.end(), optimizedData());
-            other._data = _data;
-            _data = optimizedData();
+            const auto common = std::min(size, otherSize);
+            std::swap_ranges(beginUnsafe(), beginUnsafe() + common, other.beginUnsafe());
+            if (size < otherSize)
+                Utils::RelocateForward(other.beginUnsafe() + common, other.endUnsafe(), beginUnsafe() + common);
+            else
+                Utils::RelocateForward(beginUnsafe() + common, endUnsafe(), other.beginUnsafe() + common);
+        } else if (cacheUsed) {
+            Utils::RelocateForward(beginUnsafe(), endUnsafe(), other.optimizedData());
+        } else if (otherCacheUsed) {
+            Utils::RelocateForward(other.beginUnsafe(), other.endUnsafe(), optimizedData());
         }
-    } else if (isCacheUsed()) {
-        std::uninitialized_move(begin, endUnsafe(), other.optimizedData());
-        _data = other._data;
-        other._data = other.optimizedData();
-    } else {
-        std::swap(_data, other._data);
     }
+    std::swap(_data, other._data);
     std::swap(_size, other._size);
     std::swap(_capacity, other._capacity);
+    if (otherCacheUsed)
+        _data = optimizedData();
+    if (cacheUsed)
+        other._data = other.optimizedData();
 }
 
 template<typename Type, std::size_t OptimizedCapacity, std::integral Range>
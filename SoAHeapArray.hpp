@@ -0,0 +1,112 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Structure-of-arrays fixed size array
+ */
+
+#pragma once
+
+#include "Assert.hpp"
+#include "SoALayout.hpp"
+
+namespace kF::Core
+{
+    /**
+     * @brief Fixed size array allocated on the heap, storing each field of its elements in a separate cacheline aligned column
+     *
+     * @tparam Fields Types of each column
+     */
+    template<typename ...Fields>
+    class SoAHeapArray;
+}
+
+template<typename ...Fields>
+class kF::Core::SoAHeapArray
+{
+public:
+    /** @brief Memory layout */
+    using Layout = Internal::SoALayout<Fields...>;
+
+    /** @brief Type of a field */
+    template<std::size_t Index>
+    using Field = typename Layout::template Field<Index>;
+
+    /** @brief References to every field of an element */
+    using Row = std::tuple<Fields &...>;
+    using ConstRow = std::tuple<const Fields &...>;
+
+
+    /** @brief Default construct an empty array */
+    SoAHeapArray(void) noexcept = default;
+
+    /** @brief Construct an array of a given size, each field is default constructed */
+    explicit SoAHeapArray(const std::size_t size) noexcept(nothrow_ndebug && (nothrow_default_constructible(Fields) && ...))
+        { allocate(size); }
+
+    /** @brief Move constructor */
+    SoAHeapArray(SoAHeapArray &&other) noexcept { swap(other); }
+
+    /** @brief Destruct the array and all elements */
+    ~SoAHeapArray(void) noexcept((nothrow_destructible(Fields) && ...)) { release(); }
+
+    /** @brief Move assignment */
+    SoAHeapArray &operator=(SoAHeapArray &&other) noexcept { swap(other); return *this; }
+
+    /** @brief Swap two instances */
+    void swap(SoAHeapArray &other) noexcept { std::swap(_columns, other._columns); std::swap(_size, other._size); }
+
+
+    /** @brief Fast check if array contains data */
+    [[nodiscard]] operator bool(void) const noexcept { return !empty(); }
+    [[nodiscard]] bool empty(void) const noexcept { return !_size; }
+
+    /** @brief Get array length */
+    [[nodiscard]] std::size_t size(void) const noexcept { return _size; }
+
+
+    /** @brief Allocate a new array, each field is default constructed */
+    void allocate(const std::size_t size)
+        noexcept(nothrow_ndebug && (nothrow_default_constructible(Fields) && ...) && (nothrow_destructible(Fields) && ...));
+
+    /** @brief Clear the array and release memory */
+    void release(void) noexcept((nothrow_destructible(Fields) && ...));
+
+
+    /** @brief Get the data of a column */
+    template<std::size_t Index>
+    [[nodiscard]] Field<Index> *data(void) noexcept { return std::get<Index>(_columns); }
+    template<std::size_t Index>
+    [[nodiscard]] const Field<Index> *data(void) const noexcept { return std::get<Index>(_columns); }
+
+    /** @brief Get a column */
+    template<std::size_t Index>
+    [[nodiscard]] std::span<Field<Index>> column(void) noexcept { return { data<Index>(), _size }; }
+    template<std::size_t Index>
+    [[nodiscard]] std::span<const Field<Index>> column(void) const noexcept { return { data<Index>(), _size }; }
+
+    /** @brief Get a set of columns, meant to be used with structured bindings */
+    template<std::size_t ...Indexes>
+    [[nodiscard]] std::tuple<std::span<Field<Indexes>>...> columns(void) noexcept { return { column<Indexes>()... }; }
+    template<std::size_t ...Indexes>
+    [[nodiscard]] std::tuple<std::span<const Field<Indexes>>...> columns(void) const noexcept { return { column<Indexes>()... }; }
+
+
+    /** @brief Access every field of an element */
+    [[nodiscard]] Row at(const std::size_t pos) noexcept
+        { return std::apply([pos](Fields * const ...column) { return Row(column[pos]...); }, _columns); }
+    [[nodiscard]] ConstRow at(const std::size_t pos) const noexcept
+        { return std::apply([pos](Fields * const ...column) { return ConstRow(column[pos]...); }, _columns); }
+    [[nodiscard]] Row operator[](const std::size_t pos) noexcept { return at(pos); }
+    [[nodiscard]] ConstRow operator[](const std::size_t pos) const noexcept { return at(pos); }
+
+    /** @brief Access a single field of an element */
+    template<std::size_t Index>
+    [[nodiscard]] Field<Index> &get(const std::size_t pos) noexcept { return data<Index>()[pos]; }
+    template<std::size_t Index>
+    [[nodiscard]] const Field<Index> &get(const std::size_t pos) const noexcept { return data<Index>()[pos]; }
+
+private:
+    typename Layout::Columns _columns {};
+    std::size_t _size { 0 };
+};
+
+#include "SoAHeapArray.ipp"
@@ -0,0 +1,33 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: SoAHeapArray
+ */
+
+template<typename ...Fields>
+inline void kF::Core::SoAHeapArray<Fields...>::allocate(const std::size_t size)
+    noexcept(nothrow_ndebug && (nothrow_default_constructible(Fields) && ...) && (nothrow_destructible(Fields) && ...))
+{
+    if (_size == size) [[unlikely]] {
+        Layout::Apply(_columns, [size](auto * const column) { std::destroy_n(column, size); });
+    } else {
+        release();
+        if (!size) [[unlikely]]
+            return;
+        _columns = Layout::Allocate(size);
+        kFAssert(std::get<0>(_columns),
+            throw std::runtime_error("Core::SoAHeapArray::allocate: Malloc failed"));
+        _size = size;
+    }
+    Layout::Apply(_columns, [size](auto * const column) { std::uninitialized_value_construct_n(column, size); });
+}
+
+template<typename ...Fields>
+inline void kF::Core::SoAHeapArray<Fields...>::release(void) noexcept((nothrow_destructible(Fields) && ...))
+{
+    if (!_size) [[unlikely]]
+        return;
+    Layout::Apply(_columns, [size = _size](auto * const column) { std::destroy_n(column, size); });
+    Layout::Deallocate(_columns);
+    _columns = {};
+    _size = 0;
+}
@@ -0,0 +1,86 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Memory layout of structure-of-arrays containers
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <memory>
+#include <span>
+#include <tuple>
+
+#include "Utils.hpp"
+
+namespace kF::Core::Internal
+{
+    template<typename ...Fields>
+    struct SoALayout;
+}
+
+/** @brief Single allocation holding one column per field, each column starts on its own cacheline */
+template<typename ...Fields>
+struct kF::Core::Internal::SoALayout
+{
+    static_assert(sizeof...(Fields) > 0, "SoALayout: At least one field is required");
+
+    /** @brief Pointers to the first element of each column, the first one is the allocation */
+    using Columns = std::tuple<Fields *...>;
+
+    /** @brief Type of a field */
+    template<std::size_t Index>
+    using Field = std::tuple_element_t<Index, std::tuple<Fields...>>;
+
+    /** @brief Sequence of every field index */
+    using Indexes = std::index_sequence_for<Fields...>;
+
+    /** @brief Alignment of each column */
+    static constexpr std::size_t Alignment = std::max({ CacheLineSize, alignof(Fields)... });
+
+
+    /** @brief Get the size in bytes of a column */
+    template<typename Type>
+    [[nodiscard]] static constexpr std::size_t ColumnBytes(const std::size_t capacity) noexcept
+        { return (sizeof(Type) * capacity + Alignment - 1) & ~(Alignment - 1); }
+
+    /** @brief Get the size in bytes of an allocation holding 'capacity' elements */
+    [[nodiscard]] static constexpr std::size_t Bytes(const std::size_t capacity) noexcept
+        { return (ColumnBytes<Fields>(capacity) + ...); }
+
+    /** @brief Allocate columns of 'capacity' elements */
+    [[nodiscard]] static Columns Allocate(const std::size_t capacity) noexcept;
+
+    /** @brief Deallocate columns */
+    static void Deallocate(const Columns &columns) noexcept
+        { Utils::AlignedFree(std::get<0>(columns)); }
+
+
+    /** @brief Call 'functor(column)' on each column */
+    template<typename Functor>
+    static void Apply(const Columns &columns, Functor &&functor)
+        { std::apply([&functor](Fields * const ...column) { (functor(column), ...); }, columns); }
+
+    /** @brief Call 'functor(from, to)' on each pair of columns */
+    template<typename Functor>
+    static void Apply(const Columns &from, const Columns &to, Functor &&functor)
+        { ApplyPairs(from, to, functor, Indexes {}); }
+
+private:
+    template<typename Functor, std::size_t ...Index>
+    static void ApplyPairs(const Columns &from, const Columns &to, Functor &functor, std::index_sequence<Index...>)
+        { (functor(std::get<Index>(from), std::get<Index>(to)), ...); }
+};
+
+template<typename ...Fields>
+inline typename kF::Core::Internal::SoALayout<Fields...>::Columns kF::Core::Internal::SoALayout<Fields...>::Allocate(const std::size_t capacity) noexcept
+{
+    Columns columns {};
+    auto data = Utils::AlignedAlloc<Alignment, std::byte>(Bytes(capacity));
+
+    if (!data) [[unlikely]]
+        return columns;
+    std::apply([&data, capacity](Fields *&...column) {
+        ((column = reinterpret_cast<Fields *>(data), data += ColumnBytes<Fields>(capacity)), ...);
+    }, columns);
+    return columns;
+}
@@ -0,0 +1,175 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Structure-of-arrays vector
+ */
+
+#pragma once
+
+#include "Assert.hpp"
+#include "SoALayout.hpp"
+#include "GrowthPolicy.hpp"
+
+namespace kF::Core
+{
+    /**
+     * @brief Vector storing each field of its elements in a separate cacheline aligned column
+     *  Iterating a few fields only loads their columns, each column can be processed with SIMD loops
+     *
+     * @tparam Fields Types of each column
+     */
+    template<typename ...Fields>
+    class SoAVector;
+}
+
+template<typename ...Fields>
+class kF::Core::SoAVector
+{
+public:
+    /** @brief Memory layout */
+    using Layout = Internal::SoALayout<Fields...>;
+
+    /** @brief Type of a field */
+    template<std::size_t Index>
+    using Field = typename Layout::template Field<Index>;
+
+    /** @brief References to every field of an element */
+    using Row = std::tuple<Fields &...>;
+    using ConstRow = std::tuple<const Fields &...>;
+
+
+    /** @brief Default constructor */
+    SoAVector(void) noexcept = default;
+
+    /** @brief Construct 'count' default elements */
+    explicit SoAVector(const std::size_t count) noexcept(nothrow_ndebug && (nothrow_default_constructible(Fields) && ...))
+        { resize(count); }
+
+    /** @brief Copy constructor */
+    SoAVector(const SoAVector &other) noexcept(nothrow_ndebug && (nothrow_copy_constructible(Fields) && ...));
+
+    /** @brief Move constructor */
+    SoAVector(SoAVector &&other) noexcept { swap(other); }
+
+    /** @brief Destructor */
+    ~SoAVector(void) noexcept((nothrow_destructible(Fields) && ...)) { release(); }
+
+    /** @brief Copy assignment */
+    SoAVector &operator=(const SoAVector &other) noexcept(nothrow_ndebug && (nothrow_copy_constructible(Fields) && ...) && (nothrow_destructible(Fields) && ...));
+
+    /** @brief Move assignment */
+    SoAVector &operator=(SoAVector &&other) noexcept((nothrow_destructible(Fields) && ...))
+        { release(); swap(other); return *this; }
+
+    /** @brief Swap two instances */
+    void swap(SoAVector &other) noexcept
+        { std::swap(_columns, other._columns); std::swap(_size, other._size); std::swap(_capacity, other._capacity); }
+
+
+    /** @brief Fast check if vector contains elements */
+    [[nodiscard]] operator bool(void) const noexcept { return !empty(); }
+    [[nodiscard]] bool empty(void) const noexcept { return !_size; }
+
+    /** @brief Get the count of elements */
+    [[nodiscard]] std::size_t size(void) const noexcept { return _size; }
+
+    /** @brief Get the count of elements the columns can hold */
+    [[nodiscard]] std::size_t capacity(void) const noexcept { return _capacity; }
+
+
+    /** @brief Get the data of a column */
+    template<std::size_t Index>
+    [[nodiscard]] Field<Index> *data(void) noexcept { return std::get<Index>(_columns); }
+    template<std::size_t Index>
+    [[nodiscard]] const Field<Index> *data(void) const noexcept { return std::get<Index>(_columns); }
+
+    /** @brief Get a column */
+    template<std::size_t Index>
+    [[nodiscard]] std::span<Field<Index>> column(void) noexcept { return { data<Index>(), _size }; }
+    template<std::size_t Index>
+    [[nodiscard]] std::span<const Field<Index>> column(void) const noexcept { return { data<Index>(), _size }; }
+
+    /** @brief Get a set of columns, meant to be used with structured bindings */
+    template<std::size_t ...Indexes>
+    [[nodiscard]] std::tuple<std::span<Field<Indexes>>...> columns(void) noexcept { return { column<Indexes>()... }; }
+    template<std::size_t ...Indexes>
+    [[nodiscard]] std::tuple<std::span<const Field<Indexes>>...> columns(void) const noexcept { return { column<Indexes>()... }; }
+
+
+    /** @brief Access every field of an element */
+    [[nodiscard]] Row at(const std::size_t pos) noexcept
+        { return std::apply([pos](Fields * const ...column) { return Row(column[pos]...); }, _columns); }
+    [[nodiscard]] ConstRow at(const std::size_t pos) const noexcept
+        { return std::apply([pos](Fields * const ...column) { return ConstRow(column[pos]...); }, _columns); }
+    [[nodiscard]] Row operator[](const std::size_t pos) noexcept { return at(pos); }
+    [[nodiscard]] ConstRow operator[](const std::size_t pos) const noexcept { return at(pos); }
+
+    /** @brief Access a single field of an element */
+    template<std::size_t Index>
+    [[nodiscard]] Field<Index> &get(const std::size_t pos) noexcept { return data<Index>()[pos]; }
+    template<std::size_t Index>
+    [[nodiscard]] const Field<Index> &get(const std::size_t pos) const noexcept { return data<Index>()[pos]; }
+
+    /** @brief Get first element */
+    [[nodiscard]] Row front(void) noexcept { return at(0); }
+    [[nodiscard]] ConstRow front(void) const noexcept { return at(0); }
+
+    /** @brief Get last element */
+    [[nodiscard]] Row back(void) noexcept { return at(_size - 1); }
+    [[nodiscard]] ConstRow back(void) const noexcept { return at(_size - 1); }
+
+
+    /** @brief Push an element, constructing each field from its argument */
+    template<typename ...Args>
+        requires (sizeof...(Args) == sizeof...(Fields) && (std::constructible_from<Fields, Args> && ...))
+    Row push(Args &&...args)
+        noexcept(nothrow_ndebug && (nothrow_constructible(Fields, Args) && ...) && (nothrow_move_constructible(Fields) && ...) && (nothrow_destructible(Fields) && ...));
+
+    /** @brief Pop the last element */
+    void pop(void) noexcept((nothrow_destructible(Fields) && ...));
+
+    /** @brief Remove an element, preserving the order of the next ones */
+    void erase(const std::size_t pos) noexcept((nothrow_move_constructible(Fields) && ...) && (nothrow_destructible(Fields) && ...))
+        { erase(pos, pos + 1); }
+
+    /** @brief Remove a range of elements [from, to[, preserving the order of the next ones */
+    void erase(const std::size_t from, const std::size_t to)
+        noexcept((nothrow_move_constructible(Fields) && ...) && (nothrow_destructible(Fields) && ...));
+
+    /** @brief Remove an element in O(1) by relocating the last element in its place, order is not preserved */
+    void eraseUnordered(const std::size_t pos)
+        noexcept((nothrow_move_constructible(Fields) && ...) && (nothrow_destructible(Fields) && ...));
+
+
+    /** @brief Resize the vector using default constructor to initialize each element */
+    void resize(const std::size_t count)
+        noexcept(nothrow_ndebug && (nothrow_default_constructible(Fields) && ...) && (nothrow_destructible(Fields) && ...));
+
+    /** @brief Reserve memory only if asked capacity is higher than current capacity
+     *  @return True if the reserve happened and the data has been moved */
+    bool reserve(const std::size_t capacity)
+        noexcept(nothrow_ndebug && (nothrow_move_constructible(Fields) && ...) && (nothrow_destructible(Fields) && ...));
+
+    /** @brief Destroy all elements */
+    void clear(void) noexcept((nothrow_destructible(Fields) && ...));
+
+    /** @brief Destroy all elements and release the columns */
+    void release(void) noexcept((nothrow_destructible(Fields) && ...));
+
+private:
+    /** @brief Relocate the elements into new columns of 'capacity' elements */
+    void relocate(const std::size_t capacity)
+        noexcept(nothrow_ndebug && (nothrow_move_constructible(Fields) && ...) && (nothrow_destructible(Fields) && ...));
+
+    typename Layout::Columns _columns {};
+    std::size_t _size {};
+    std::size_t _capacity {};
+};
+
+/** @brief A structure-of-arrays vector only holds pointers to its columns */
+template<typename ...Fields>
+struct kF::Core::IsTriviallyRelocatable<kF::Core::SoAVector<Fields...>>
+{
+    static constexpr bool Value = true;
+};
+
+#include "SoAVector.ipp"
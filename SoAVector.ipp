@@ -0,0 +1,144 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Structure-of-arrays vector
+ */
+
+template<typename ...Fields>
+inline kF::Core::SoAVector<Fields...>::SoAVector(const SoAVector &other) noexcept(nothrow_ndebug && (nothrow_copy_constructible(Fields) && ...))
+{
+    if (!other._size) [[unlikely]]
+        return;
+    _columns = Layout::Allocate(other._size);
+    kFAssert(std::get<0>(_columns),
+        throw std::runtime_error("Core::SoAVector: Malloc failed"));
+    _capacity = other._size;
+    Layout::Apply(other._columns, _columns, [size = other._size](const auto * const from, auto * const to) {
+        std::uninitialized_copy_n(from, size, to);
+    });
+    _size = other._size;
+}
+
+template<typename ...Fields>
+inline kF::Core::SoAVector<Fields...> &kF::Core::SoAVector<Fields...>::operator=(const SoAVector &other)
+    noexcept(nothrow_ndebug && (nothrow_copy_constructible(Fields) && ...) && (nothrow_destructible(Fields) && ...))
+{
+    if (this == &other) [[unlikely]]
+        return *this;
+    clear();
+    if (_capacity < other._size)
+        relocate(other._size);
+    Layout::Apply(other._columns, _columns, [size = other._size](const auto * const from, auto * const to) {
+        std::uninitialized_copy_n(from, size, to);
+    });
+    _size = other._size;
+    return *this;
+}
+
+template<typename ...Fields>
+template<typename ...Args>
+    requires (sizeof...(Args) == sizeof...(Fields) && (std::constructible_from<Fields, Args> && ...))
+inline typename kF::Core::SoAVector<Fields...>::Row kF::Core::SoAVector<Fields...>::push(Args &&...args)
+    noexcept(nothrow_ndebug && (nothrow_constructible(Fields, Args) && ...) && (nothrow_move_constructible(Fields) && ...) && (nothrow_destructible(Fields) && ...))
+{
+    if (_size == _capacity) [[unlikely]] {
+        relocate(_capacity
+            ? DefaultGrowthPolicy::NextCapacity<Layout, std::size_t>(_capacity, 1)
+            : DefaultGrowthPolicy::InitialCapacity<Layout, std::size_t>());
+    }
+    const auto pos = _size;
+    std::apply([pos, &args...](Fields * const ...column) {
+        (new (column + pos) Fields(std::forward<Args>(args)), ...);
+    }, _columns);
+    ++_size;
+    return at(pos);
+}
+
+template<typename ...Fields>
+inline void kF::Core::SoAVector<Fields...>::pop(void) noexcept((nothrow_destructible(Fields) && ...))
+{
+    --_size;
+    Layout::Apply(_columns, [pos = _size](auto * const column) { std::destroy_at(column + pos); });
+}
+
+template<typename ...Fields>
+inline void kF::Core::SoAVector<Fields...>::erase(const std::size_t from, const std::size_t to)
+    noexcept((nothrow_move_constructible(Fields) && ...) && (nothrow_destructible(Fields) && ...))
+{
+    if (from == to) [[unlikely]]
+        return;
+    Layout::Apply(_columns, [from, to, size = _size](auto * const column) {
+        std::destroy(column + from, column + to);
+        Utils::RelocateForward(column + to, column + size, column + from);
+    });
+    _size -= to - from;
+}
+
+template<typename ...Fields>
+inline void kF::Core::SoAVector<Fields...>::eraseUnordered(const std::size_t pos)
+    noexcept((nothrow_move_constructible(Fields) && ...) && (nothrow_destructible(Fields) && ...))
+{
+    const auto last = --_size;
+
+    Layout::Apply(_columns, [pos, last](auto * const column) {
+        std::destroy_at(column + pos);
+        if (pos != last) [[likely]]
+            Utils::RelocateForward(column + last, column + last + 1, column + pos);
+    });
+}
+
+template<typename ...Fields>
+inline void kF::Core::SoAVector<Fields...>::resize(const std::size_t count)
+    noexcept(nothrow_ndebug && (nothrow_default_constructible(Fields) && ...) && (nothrow_destructible(Fields) && ...))
+{
+    clear();
+    if (_capacity < count)
+        relocate(count);
+    Layout::Apply(_columns, [count](auto * const column) { std::uninitialized_value_construct_n(column, count); });
+    _size = count;
+}
+
+template<typename ...Fields>
+inline bool kF::Core::SoAVector<Fields...>::reserve(const std::size_t capacity)
+    noexcept(nothrow_ndebug && (nothrow_move_constructible(Fields) && ...) && (nothrow_destructible(Fields) && ...))
+{
+    if (_capacity >= capacity)
+        return false;
+    relocate(capacity);
+    return true;
+}
+
+template<typename ...Fields>
+inline void kF::Core::SoAVector<Fields...>::clear(void) noexcept((nothrow_destructible(Fields) && ...))
+{
+    Layout::Apply(_columns, [size = _size](auto * const column) { std::destroy_n(column, size); });
+    _size = 0;
+}
+
+template<typename ...Fields>
+inline void kF::Core::SoAVector<Fields...>::release(void) noexcept((nothrow_destructible(Fields) && ...))
+{
+    if (!_capacity) [[unlikely]]
+        return;
+    clear();
+    Layout::Deallocate(_columns);
+    _columns = {};
+    _capacity = 0;
+}
+
+template<typename ...Fields>
+inline void kF::Core::SoAVector<Fields...>::relocate(const std::size_t capacity)
+    noexcept(nothrow_ndebug && (nothrow_move_constructible(Fields) && ...) && (nothrow_destructible(Fields) && ...))
+{
+    const auto columns = Layout::Allocate(capacity);
+
+    kFAssert(std::get<0>(columns),
+        throw std::runtime_error("Core::SoAVector::relocate: Malloc failed"));
+    if (_capacity) [[likely]] {
+        Layout::Apply(_columns, columns, [size = _size](auto * const from, auto * const to) {
+            Utils::RelocateForward(from, from + size, to);
+        });
+        Layout::Deallocate(_columns);
+    }
+    _columns = columns;
+    _capacity = capacity;
+}
@@ -20,13 +20,14 @@ namespace kF::Core
      * @tparam DeallocateFunc Deallocator
      * @tparam Range Range of container
      * @tparam Compare Compare operator
+     * @tparam GrowthPolicy Capacity growth policy
      */
-    template<typename Type, auto AllocateFunc, auto DeallocateFunc, std::integral Range = std::size_t, typename Compare = std::less<Type>, typename CustomHeaderType = Internal::NoCustomHeaderType>
-    using SortedAllocatedFlatVector = Internal::SortedVectorDetails<Internal::AllocatedFlatVectorBase<Type, Range, AllocateFunc, DeallocateFunc, CustomHeaderType>, Type, Range, Compare>;
+    template<typename Type, auto AllocateFunc, auto DeallocateFunc, std::integral Range = std::size_t, typename Compare = std::less<Type>, typename CustomHeaderType = Internal::NoCustomHeaderType, typename GrowthPolicy = DefaultGrowthPolicy>
+    using SortedAllocatedFlatVector = Internal::SortedVectorDetails<Internal::AllocatedFlatVectorBase<Type, Range, AllocateFunc, DeallocateFunc, CustomHeaderType>, Type, Range, Compare, false, GrowthPolicy>;
 
     /** @brief 8 bytes vector using signed char with a reduced range
      * The vector guarantee that it will be sorted at any given time
      * The vector must take an allocator and a deallocator functor */
-    template<typename Type, auto AllocateFunc, auto DeallocateFunc, typename Compare = std::less<Type>, typename CustomHeaderType = Internal::NoCustomHeaderType>
-    using SortedAllocatedTinyFlatVector = SortedAllocatedFlatVector<Type, AllocateFunc, DeallocateFunc, std::uint32_t, Compare, CustomHeaderType>;
+    template<typename Type, auto AllocateFunc, auto DeallocateFunc, typename Compare = std::less<Type>, typename CustomHeaderType = Internal::NoCustomHeaderType, typename GrowthPolicy = DefaultGrowthPolicy>
+    using SortedAllocatedTinyFlatVector = SortedAllocatedFlatVector<Type, AllocateFunc, DeallocateFunc, std::uint32_t, Compare, CustomHeaderType, GrowthPolicy>;
 }
\ No newline at end of file
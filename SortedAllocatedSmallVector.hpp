@@ -21,13 +21,14 @@ namespace kF::Core
      * @tparam DeallocateFunc Deallocator
      * @tparam Range Range of container
      * @tparam Compare Compare operator
+     * @tparam GrowthPolicy Capacity growth policy
      */
-    template<typename Type, std::size_t OptimizedCapacity, auto AllocateFunc, auto DeallocateFunc, std::integral Range = std::size_t, typename Compare = std::less<Type>>
-    using SortedAllocatedSmallVector = Internal::SortedVectorDetails<Internal::AllocatedSmallVectorBase<Type, OptimizedCapacity, AllocateFunc, DeallocateFunc, Range>, Type, Range, Compare, true>;
+    template<typename Type, std::size_t OptimizedCapacity, auto AllocateFunc, auto DeallocateFunc, std::integral Range = std::size_t, typename Compare = std::less<Type>, typename GrowthPolicy = DefaultGrowthPolicy>
+    using SortedAllocatedSmallVector = Internal::SortedVectorDetails<Internal::AllocatedSmallVectorBase<Type, OptimizedCapacity, AllocateFunc, DeallocateFunc, Range>, Type, Range, Compare, true, GrowthPolicy>;
 
     /** @brief Small optimized vector with a reduced range
      * The vector guarantee that it will be sorted at any given time
      * The vector must take an allocator and a deallocator functor */
-    template<typename Type, std::size_t OptimizedCapacity, auto AllocateFunc, auto DeallocateFunc, typename Compare = std::less<Type>>
-    using SortedAllocatedTinySmallVector = SortedAllocatedSmallVector<Type, OptimizedCapacity, AllocateFunc, DeallocateFunc, std::uint32_t, Compare>;
+    template<typename Type, std::size_t OptimizedCapacity, auto AllocateFunc, auto DeallocateFunc, typename Compare = std::less<Type>, typename GrowthPolicy = DefaultGrowthPolicy>
+    using SortedAllocatedTinySmallVector = SortedAllocatedSmallVector<Type, OptimizedCapacity, AllocateFunc, DeallocateFunc, std::uint32_t, Compare, GrowthPolicy>;
 }
\ No newline at end of file
@@ -21,13 +21,14 @@ namespace kF::Core
      * @tparam DeallocateFunc Deallocator
      * @tparam Range Range of container
      * @tparam Compare Compare operator
+     * @tparam GrowthPolicy Capacity growth policy
      */
-    template<typename Type, auto AllocateFunc, auto DeallocateFunc, std::integral Range = std::size_t, typename Compare = std::less<Type>>
-    using SortedAllocatedVector = Internal::SortedVectorDetails<Internal::AllocatedVectorBase<Type, Range, AllocateFunc, DeallocateFunc>, Type, Range, Compare>;
+    template<typename Type, auto AllocateFunc, auto DeallocateFunc, std::integral Range = std::size_t, typename Compare = std::less<Type>, typename GrowthPolicy = DefaultGrowthPolicy>
+    using SortedAllocatedVector = Internal::SortedVectorDetails<Internal::AllocatedVectorBase<Type, Range, AllocateFunc, DeallocateFunc>, Type, Range, Compare, false, GrowthPolicy>;
 
     /** @brief 16 bytes vector with a reduced range
      * The vector guarantee that it will be sorted at any given time
      * The vector must take an allocator and a deallocator functor */
-    template<typename Type, auto AllocateFunc, auto DeallocateFunc, typename Compare = std::less<Type>>
-    using SortedAllocatedTinyVector = SortedAllocatedVector<Type, AllocateFunc, DeallocateFunc, std::uint32_t, Compare>;
+    template<typename Type, auto AllocateFunc, auto DeallocateFunc, typename Compare = std::less<Type>, typename GrowthPolicy = DefaultGrowthPolicy>
+    using SortedAllocatedTinyVector = SortedAllocatedVector<Type, AllocateFunc, DeallocateFunc, std::uint32_t, Compare, GrowthPolicy>;
 }
\ No newline at end of file
@@ -17,12 +17,13 @@ namespace kF::Core
      * @tparam Type Internal type in container
      * @tparam Range Range of container
      * @tparam Compare Compare operator
+     * @tparam GrowthPolicy Capacity growth policy
      */
-    template<typename Type, std::integral Range = std::size_t, typename Compare = std::less<Type>, typename CustomHeaderType = Internal::NoCustomHeaderType>
-    using SortedFlatVector = Internal::SortedVectorDetails<Internal::FlatVectorBase<Type, Range, CustomHeaderType>, Type, Range, Compare>;
+    template<typename Type, std::integral Range = std::size_t, typename Compare = std::less<Type>, typename CustomHeaderType = Internal::NoCustomHeaderType, typename GrowthPolicy = DefaultGrowthPolicy>
+    using SortedFlatVector = Internal::SortedVectorDetails<Internal::FlatVectorBase<Type, Range, CustomHeaderType>, Type, Range, Compare, false, GrowthPolicy>;
 
     /** @brief 8 bytes vector using signed char with a reduced range
      * The vector guarantee that it will be sorted at any given time */
-    template<typename Type, typename Compare = std::less<Type>, typename CustomHeaderType = Internal::NoCustomHeaderType>
-    using SortedTinyFlatVector = SortedFlatVector<Type, std::uint32_t, Compare, CustomHeaderType>;
+    template<typename Type, typename Compare = std::less<Type>, typename CustomHeaderType = Internal::NoCustomHeaderType, typename GrowthPolicy = DefaultGrowthPolicy>
+    using SortedTinyFlatVector = SortedFlatVector<Type, std::uint32_t, Compare, CustomHeaderType, GrowthPolicy>;
 }
\ No newline at end of file
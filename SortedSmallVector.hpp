@@ -18,12 +18,13 @@ namespace kF::Core
      * @tparam OptimizedCapacity Count of element in the optimized cache
      * @tparam Range Range of container
      * @tparam Compare Compare operator
+     * @tparam GrowthPolicy Capacity growth policy
      */
-    template<typename Type, std::size_t OptimizedCapacity, std::integral Range = std::size_t, typename Compare = std::less<Type>>
-    using SortedSmallVector = Internal::SortedVectorDetails<Internal::SmallVectorBase<Type, OptimizedCapacity, Range>, Type, Range, Compare, true>;
+    template<typename Type, std::size_t OptimizedCapacity, std::integral Range = std::size_t, typename Compare = std::less<Type>, typename GrowthPolicy = DefaultGrowthPolicy>
+    using SortedSmallVector = Internal::SortedVectorDetails<Internal::SmallVectorBase<Type, OptimizedCapacity, Range>, Type, Range, Compare, true, GrowthPolicy>;
 
     /** @brief Small optimized vector with a reduced range
      * The vector guarantee that it will be sorted at any given time */
-    template<typename Type, std::size_t OptimizedCapacity, typename Compare = std::less<Type>>
-    using SortedTinySmallVector = SortedSmallVector<Type, OptimizedCapacity, std::uint32_t, Compare>;
+    template<typename Type, std::size_t OptimizedCapacity, typename Compare = std::less<Type>, typename GrowthPolicy = DefaultGrowthPolicy>
+    using SortedTinySmallVector = SortedSmallVector<Type, OptimizedCapacity, std::uint32_t, Compare, GrowthPolicy>;
 }
\ No newline at end of file
@@ -18,12 +18,13 @@ namespace kF::Core
      * @tparam Type Internal type in container
      * @tparam Range Range of container
      * @tparam Compare Compare operator
+     * @tparam GrowthPolicy Capacity growth policy
      */
-    template<typename Type, std::integral Range = std::size_t, typename Compare = std::less<Type>>
-    using SortedVector = Internal::SortedVectorDetails<Internal::VectorBase<Type, Range>, Type, Range, Compare>;
+    template<typename Type, std::integral Range = std::size_t, typename Compare = std::less<Type>, typename GrowthPolicy = DefaultGrowthPolicy>
+    using SortedVector = Internal::SortedVectorDetails<Internal::VectorBase<Type, Range>, Type, Range, Compare, false, GrowthPolicy>;
 
     /** @brief 16 bytes vector with a reduced range
      * The vector guarantee that it will be sorted at any given time */
-    template<typename Type, typename Compare = std::less<Type>>
-    using SortedTinyVector = SortedVector<Type, std::uint32_t, Compare>;
+    template<typename Type, typename Compare = std::less<Type>, typename GrowthPolicy = DefaultGrowthPolicy>
+    using SortedTinyVector = SortedVector<Type, std::uint32_t, Compare, GrowthPolicy>;
 }
\ No newline at end of file
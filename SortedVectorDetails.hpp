@@ -7,19 +7,21 @@
 
 
 #include "VectorDetails.hpp"
+#include "EytzingerIndex.hpp"
+#include "SimdSearch.hpp"
 
 namespace kF::Core::Internal
 {
-    template<typename Base, typename Type, std::integral Range, typename Compare, bool IsSmallOptimized = false>
+    template<typename Base, typename Type, std::integral Range, typename Compare, bool IsSmallOptimized = false, typename GrowthPolicy = DefaultGrowthPolicy>
     class SortedVectorDetails;
 }
 
-template<typename Base, typename Type, std::integral Range, typename Compare, bool IsSmallOptimized>
-class kF::Core::Internal::SortedVectorDetails : public VectorDetails<Base, Type, Range, IsSmallOptimized>
+template<typename Base, typename Type, std::integral Range, typename Compare, bool IsSmallOptimized, typename GrowthPolicy>
+class kF::Core::Internal::SortedVectorDetails : public VectorDetails<Base, Type, Range, IsSmallOptimized, GrowthPolicy>
 {
 public:
     /** @brief Type alias to VectorDetails */
-    using DetailsBase = VectorDetails<Base, Type, Range, IsSmallOptimized>;
+    using DetailsBase = VectorDetails<Base, Type, Range, IsSmallOptimized, GrowthPolicy>;
 
     /** @brief Iterator detectors */
     using Iterator = typename DetailsBase::Iterator;
@@ -77,6 +79,17 @@ public:
     Type &push(Args &&...args);
 
 
+    /** @brief Push 'count' elements constructed from 'generator(index)', the buffer grows at most once and is merged once */
+    template<typename Generator>
+        requires std::invocable<Generator &, Range> && std::constructible_from<Type, std::invoke_result_t<Generator &, Range>>
+    void pushN(const Range count, Generator &&generator);
+
+    /** @brief Push a range of elements constructed from each dereferenced iterator, the buffer grows at most once and is merged once */
+    template<std::input_iterator InputIterator>
+        requires std::constructible_from<Type, std::iter_reference_t<InputIterator>>
+    void emplaceRange(InputIterator from, InputIterator to);
+
+
     /** @brief Insert a range of default initialized values */
     void insertDefault(const Range count)
         noexcept(nothrow_default_constructible(Type) && nothrow_destructible(Type));
@@ -104,6 +117,11 @@ public:
     template<std::input_iterator InputIterator, typename Map>
     void insert(InputIterator from, InputIterator to, Map &&map);
 
+    /** @brief Insert a range of element already sorted with 'Compare', the range is merged without being sorted
+     *  Throws in debug mode if the range is not sorted */
+    template<std::input_iterator InputIterator>
+    void insertSorted(InputIterator from, InputIterator to);
+
 
     /** @brief Insert an value by copy at a specific location (no sort involved), returning its iterator */
     Iterator insertAt(const Iterator at, const Type &value)
@@ -143,19 +161,58 @@ public:
     Range assign(const Range index, AssignType &&value);
 
 
-    /** @brief Finds where to insert an element */
+    /** @brief Finds where to insert an element, after its equivalent elements */
     [[nodiscard]] Iterator findSortedPlacement(const Type &value)
         noexcept_invocable(Compare, const Type &, const Type &)
-        { return DetailsBase::find([&value](const Type &other) { return Compare{}(value, other); }); }
+        { return upperBound(value); }
     [[nodiscard]] ConstIterator findSortedPlacement(const Type &value) const
         noexcept_invocable(Compare, const Type &, const Type &)
-        { return DetailsBase::find([&value](const Type &other) { return Compare{}(value, other); }); }
+        { return upperBound(value); }
+
+    /** @brief Get the first element not ordered before 'value'
+     *  Arithmetic elements in ascending order are compared several at a time once the search is narrowed down */
+    [[nodiscard]] Iterator lowerBound(const Type &value)
+        noexcept_invocable(Compare, const Type &, const Type &)
+        { return const_cast<Iterator>(std::as_const(*this).lowerBound(value)); }
+    [[nodiscard]] ConstIterator lowerBound(const Type &value) const
+        noexcept_invocable(Compare, const Type &, const Type &);
+
+    /** @brief Get the first element ordered after 'value' */
+    [[nodiscard]] Iterator upperBound(const Type &value)
+        noexcept_invocable(Compare, const Type &, const Type &)
+        { return const_cast<Iterator>(std::as_const(*this).upperBound(value)); }
+    [[nodiscard]] ConstIterator upperBound(const Type &value) const
+        noexcept_invocable(Compare, const Type &, const Type &);
+
+
+    /** @brief Build a read-optimized search index over the current elements
+     *  Its lookups return indexes into this vector, it must be rebuilt once the vector is modified */
+    [[nodiscard]] EytzingerIndex<Type, Range, Compare> freeze(void) const requires std::copyable<Type>
+        { return EytzingerIndex<Type, Range, Compare>(DetailsBase::begin(), DetailsBase::end()); }
 
 private:
+    /** @brief Sort the elements from 'offset' to the end then merge them with the sorted front */
+    void mergeTail(const Range offset);
+
+    /** @brief Merge the sorted elements from 'offset' to the end with the sorted front
+     *  Only the front elements ordered after the first tail element take part in the merge */
+    void mergeSortedTail(const Range offset);
+
     /** @brief Reimplemented functions */
     using DetailsBase::push;
     using DetailsBase::insert;
     using DetailsBase::resize;
+    using DetailsBase::resizeUninitialized;
+    using DetailsBase::appendUninitialized;
+    using DetailsBase::resizeAndOverwrite;
+    using DetailsBase::eraseUnordered;
+    using DetailsBase::eraseUnorderedIf;
 };
 
+/** @brief A sorted vector is trivially relocatable if its base is */
+template<typename Base, typename Type, std::integral Range, typename Compare, bool IsSmallOptimized, typename GrowthPolicy>
+struct kF::Core::IsTriviallyRelocatable<kF::Core::Internal::SortedVectorDetails<Base, Type, Range, Compare, IsSmallOptimized, GrowthPolicy>>
+    : public kF::Core::IsTriviallyRelocatable<Base>
+{};
+
 #include "SortedVectorDetails.ipp"
\ No newline at end of file
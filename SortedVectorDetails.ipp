@@ -3,9 +3,11 @@
  * @ Description: SortedVectorDetails
  */
 
-template<typename Base, typename Type, std::integral Range, typename Compare, bool IsSmallOptimized>
+#include <stdexcept>
+
+template<typename Base, typename Type, std::integral Range, typename Compare, bool IsSmallOptimized, typename GrowthPolicy>
 template<typename ...Args> requires std::constructible_from<Type, Args...>
-inline Type &kF::Core::Internal::SortedVectorDetails<Base, Type, Range, Compare, IsSmallOptimized>::push(Args &&...args)
+inline Type &kF::Core::Internal::SortedVectorDetails<Base, Type, Range, Compare, IsSmallOptimized, GrowthPolicy>::push(Args &&...args)
 {
     if (!DetailsBase::data()) [[unlikely]]
         return DetailsBase::push(std::forward<Args>(args)...);
@@ -14,47 +16,111 @@ inline Type &kF::Core::Internal::SortedVectorDetails<Base, Type, Range, Compare,
     return *DetailsBase::insert(it, { std::move(value) });
 }
 
-template<typename Base, typename Type, std::integral Range, typename Compare, bool IsSmallOptimized>
-inline void kF::Core::Internal::SortedVectorDetails<Base, Type, Range, Compare, IsSmallOptimized>::insertDefault(const Range count)
+template<typename Base, typename Type, std::integral Range, typename Compare, bool IsSmallOptimized, typename GrowthPolicy>
+template<typename Generator>
+    requires std::invocable<Generator &, Range> && std::constructible_from<Type, std::invoke_result_t<Generator &, Range>>
+inline void kF::Core::Internal::SortedVectorDetails<Base, Type, Range, Compare, IsSmallOptimized, GrowthPolicy>::pushN(
+        const Range count, Generator &&generator)
+{
+    if (count) [[likely]] {
+        const auto offset = DetailsBase::size();
+        DetailsBase::pushN(count, std::forward<Generator>(generator));
+        mergeTail(offset);
+    }
+}
+
+template<typename Base, typename Type, std::integral Range, typename Compare, bool IsSmallOptimized, typename GrowthPolicy>
+template<std::input_iterator InputIterator>
+    requires std::constructible_from<Type, std::iter_reference_t<InputIterator>>
+inline void kF::Core::Internal::SortedVectorDetails<Base, Type, Range, Compare, IsSmallOptimized, GrowthPolicy>::emplaceRange(
+        InputIterator from, InputIterator to)
+{
+    if (from != to) [[likely]] {
+        const auto offset = DetailsBase::size();
+        DetailsBase::emplaceRange(from, to);
+        mergeTail(offset);
+    }
+}
+
+template<typename Base, typename Type, std::integral Range, typename Compare, bool IsSmallOptimized, typename GrowthPolicy>
+inline void kF::Core::Internal::SortedVectorDetails<Base, Type, Range, Compare, IsSmallOptimized, GrowthPolicy>::mergeTail(const Range offset)
+{
+    std::sort(DetailsBase::beginUnsafe() + offset, DetailsBase::endUnsafe(), Compare{});
+    mergeSortedTail(offset);
+}
+
+template<typename Base, typename Type, std::integral Range, typename Compare, bool IsSmallOptimized, typename GrowthPolicy>
+inline void kF::Core::Internal::SortedVectorDetails<Base, Type, Range, Compare, IsSmallOptimized, GrowthPolicy>::mergeSortedTail(const Range offset)
+{
+    const auto begin = DetailsBase::beginUnsafe();
+    const auto middle = begin + offset;
+    const auto end = DetailsBase::endUnsafe();
+
+    if (!offset || middle == end) [[unlikely]]
+        return;
+    // Elements of the front not ordered after the tail are already at their final position
+    const auto first = std::upper_bound(begin, middle, *middle, Compare{});
+    if (first != middle)
+        std::inplace_merge(first, middle, end, Compare{});
+}
+
+template<typename Base, typename Type, std::integral Range, typename Compare, bool IsSmallOptimized, typename GrowthPolicy>
+inline void kF::Core::Internal::SortedVectorDetails<Base, Type, Range, Compare, IsSmallOptimized, GrowthPolicy>::insertDefault(const Range count)
     noexcept(nothrow_default_constructible(Type) && nothrow_destructible(Type))
 {
     if (count) [[likely]]
         DetailsBase::insertDefault(findSortedPlacement(Type{}), count);
 }
 
-template<typename Base, typename Type, std::integral Range, typename Compare, bool IsSmallOptimized>
-inline void kF::Core::Internal::SortedVectorDetails<Base, Type, Range, Compare, IsSmallOptimized>::insertCopy(
+template<typename Base, typename Type, std::integral Range, typename Compare, bool IsSmallOptimized, typename GrowthPolicy>
+inline void kF::Core::Internal::SortedVectorDetails<Base, Type, Range, Compare, IsSmallOptimized, GrowthPolicy>::insertCopy(
         const Range count, const Type &value)
 {
     if (count) [[likely]]
         DetailsBase::insertCopy(findSortedPlacement(value), count, value);
 }
 
-template<typename Base, typename Type, std::integral Range, typename Compare, bool IsSmallOptimized>
+template<typename Base, typename Type, std::integral Range, typename Compare, bool IsSmallOptimized, typename GrowthPolicy>
 template<std::input_iterator InputIterator>
-inline void kF::Core::Internal::SortedVectorDetails<Base, Type, Range, Compare, IsSmallOptimized>::insert(
+inline void kF::Core::Internal::SortedVectorDetails<Base, Type, Range, Compare, IsSmallOptimized, GrowthPolicy>::insert(
         InputIterator from, InputIterator to)
 {
     if (from != to) [[likely]] {
+        const auto offset = DetailsBase::size();
         DetailsBase::insert(DetailsBase::end(), from, to);
-        sort();
+        mergeTail(offset);
     }
 }
 
-template<typename Base, typename Type, std::integral Range, typename Compare, bool IsSmallOptimized>
+template<typename Base, typename Type, std::integral Range, typename Compare, bool IsSmallOptimized, typename GrowthPolicy>
 template<std::input_iterator InputIterator, typename Map>
-inline void kF::Core::Internal::SortedVectorDetails<Base, Type, Range, Compare, IsSmallOptimized>::insert(
+inline void kF::Core::Internal::SortedVectorDetails<Base, Type, Range, Compare, IsSmallOptimized, GrowthPolicy>::insert(
         InputIterator from, InputIterator to, Map &&map)
 {
     if (from != to) [[likely]] {
+        const auto offset = DetailsBase::size();
         DetailsBase::insert(DetailsBase::end(), from, to, std::forward<Map>(map));
-        sort();
+        mergeTail(offset);
     }
 }
 
-template<typename Base, typename Type, std::integral Range, typename Compare, bool IsSmallOptimized>
+template<typename Base, typename Type, std::integral Range, typename Compare, bool IsSmallOptimized, typename GrowthPolicy>
 template<std::input_iterator InputIterator>
-inline void kF::Core::Internal::SortedVectorDetails<Base, Type, Range, Compare, IsSmallOptimized>::resize(
+inline void kF::Core::Internal::SortedVectorDetails<Base, Type, Range, Compare, IsSmallOptimized, GrowthPolicy>::insertSorted(
+        InputIterator from, InputIterator to)
+{
+    if (from != to) [[likely]] {
+        const auto offset = DetailsBase::size();
+        DetailsBase::insert(DetailsBase::end(), from, to);
+        kFAssert(std::is_sorted(DetailsBase::beginUnsafe() + offset, DetailsBase::endUnsafe(), Compare{}),
+            throw std::logic_error("Core::SortedVector::insertSorted: Input range is not sorted"));
+        mergeSortedTail(offset);
+    }
+}
+
+template<typename Base, typename Type, std::integral Range, typename Compare, bool IsSmallOptimized, typename GrowthPolicy>
+template<std::input_iterator InputIterator>
+inline void kF::Core::Internal::SortedVectorDetails<Base, Type, Range, Compare, IsSmallOptimized, GrowthPolicy>::resize(
         InputIterator from, InputIterator to)
 {
     if (from != to) [[likely]] {
@@ -63,9 +129,9 @@ inline void kF::Core::Internal::SortedVectorDetails<Base, Type, Range, Compare,
     }
 }
 
-template<typename Base, typename Type, std::integral Range, typename Compare, bool IsSmallOptimized>
+template<typename Base, typename Type, std::integral Range, typename Compare, bool IsSmallOptimized, typename GrowthPolicy>
 template<std::input_iterator InputIterator, typename Map>
-inline void kF::Core::Internal::SortedVectorDetails<Base, Type, Range, Compare, IsSmallOptimized>::resize(
+inline void kF::Core::Internal::SortedVectorDetails<Base, Type, Range, Compare, IsSmallOptimized, GrowthPolicy>::resize(
         InputIterator from, InputIterator to, Map &&map)
 {
     if (from != to) [[likely]] {
@@ -74,15 +140,37 @@ inline void kF::Core::Internal::SortedVectorDetails<Base, Type, Range, Compare,
     }
 }
 
-template<typename Base, typename Type, std::integral Range, typename Compare, bool IsSmallOptimized>
-inline void kF::Core::Internal::SortedVectorDetails<Base, Type, Range, Compare, IsSmallOptimized>::sort(void)
+template<typename Base, typename Type, std::integral Range, typename Compare, bool IsSmallOptimized, typename GrowthPolicy>
+inline void kF::Core::Internal::SortedVectorDetails<Base, Type, Range, Compare, IsSmallOptimized, GrowthPolicy>::sort(void)
 {
     std::sort(DetailsBase::beginUnsafe(), DetailsBase::endUnsafe(), Compare{});
 }
 
-template<typename Base, typename Type, std::integral Range, typename Compare, bool IsSmallOptimized>
+template<typename Base, typename Type, std::integral Range, typename Compare, bool IsSmallOptimized, typename GrowthPolicy>
+inline typename kF::Core::Internal::SortedVectorDetails<Base, Type, Range, Compare, IsSmallOptimized, GrowthPolicy>::ConstIterator
+    kF::Core::Internal::SortedVectorDetails<Base, Type, Range, Compare, IsSmallOptimized, GrowthPolicy>::lowerBound(const Type &value) const
+    noexcept_invocable(Compare, const Type &, const Type &)
+{
+    if constexpr (Utils::SimdSearchableCompare<Type, Compare>)
+        return Utils::SimdLowerBound(DetailsBase::begin(), DetailsBase::end(), value);
+    else
+        return std::lower_bound(DetailsBase::begin(), DetailsBase::end(), value, Compare{});
+}
+
+template<typename Base, typename Type, std::integral Range, typename Compare, bool IsSmallOptimized, typename GrowthPolicy>
+inline typename kF::Core::Internal::SortedVectorDetails<Base, Type, Range, Compare, IsSmallOptimized, GrowthPolicy>::ConstIterator
+    kF::Core::Internal::SortedVectorDetails<Base, Type, Range, Compare, IsSmallOptimized, GrowthPolicy>::upperBound(const Type &value) const
+    noexcept_invocable(Compare, const Type &, const Type &)
+{
+    if constexpr (Utils::SimdSearchableCompare<Type, Compare>)
+        return Utils::SimdUpperBound(DetailsBase::begin(), DetailsBase::end(), value);
+    else
+        return std::upper_bound(DetailsBase::begin(), DetailsBase::end(), value, Compare{});
+}
+
+template<typename Base, typename Type, std::integral Range, typename Compare, bool IsSmallOptimized, typename GrowthPolicy>
 template<typename AssignType>
-inline Range kF::Core::Internal::SortedVectorDetails<Base, Type, Range, Compare, IsSmallOptimized>::assign(const Range index, AssignType &&value)
+inline Range kF::Core::Internal::SortedVectorDetails<Base, Type, Range, Compare, IsSmallOptimized, GrowthPolicy>::assign(const Range index, AssignType &&value)
 {
     const auto count = DetailsBase::sizeUnsafe();
     auto &elem = DetailsBase::at(index);
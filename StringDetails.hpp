@@ -34,9 +34,14 @@ public:
     using Base::begin;
     using Base::end;
     using Base::resize;
+    using Base::resizeUninitialized;
+    using Base::appendUninitialized;
+    using Base::resizeAndOverwrite;
     using Base::insert;
     using Base::isSafe;
     using Base::reserve;
+    using Base::shrinkTo;
+    using Base::shrinkToFit;
     using Base::grow;
     using Base::operator bool;
 
@@ -121,4 +126,11 @@ private:
     [[nodiscard]] static std::size_t SafeStrlen(const char * const cstring) noexcept;
 };
 
+/** @brief A string is trivially relocatable if its base is */
+template<typename Base, typename Type, std::integral Range>
+    requires std::is_trivial_v<Type>
+struct kF::Core::IsTriviallyRelocatable<kF::Core::Internal::StringDetails<Base, Type, Range>>
+    : public kF::Core::IsTriviallyRelocatable<Base>
+{};
+
 #include "StringDetails.ipp"
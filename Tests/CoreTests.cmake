@@ -13,6 +13,15 @@ set(KubeCoreTestsSources
     ${KubeCoreTestsDir}/tests_SPSCQueue.cpp
     ${KubeCoreTestsDir}/tests_MPMCQueue.cpp
     ${KubeCoreTestsDir}/tests_Literal.cpp
+    ${KubeCoreTestsDir}/tests_ArenaAllocator.cpp
+    ${KubeCoreTestsDir}/tests_PoolAllocator.cpp
+    ${KubeCoreTestsDir}/tests_GrowthPolicy.cpp
+    ${KubeCoreTestsDir}/tests_FlatImage.cpp
+    ${KubeCoreTestsDir}/tests_SharedFlatVector.cpp
+    ${KubeCoreTestsDir}/tests_SoAVector.cpp
+    ${KubeCoreTestsDir}/tests_PackedVector.cpp
+    ${KubeCoreTestsDir}/tests_FlatMap.cpp
+    ${KubeCoreTestsDir}/tests_BTree.cpp
 )
 
 add_executable(${CMAKE_PROJECT_NAME} ${KubeCoreTestsSources})
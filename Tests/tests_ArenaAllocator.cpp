@@ -0,0 +1,136 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Tests of the monotonic arena allocator
+ */
+
+#include <gtest/gtest.h>
+
+#include <Kube/Core/ArenaAllocator.hpp>
+#include <Kube/Core/AllocatedVector.hpp>
+#include <Kube/Core/AllocatedSmallVector.hpp>
+#include <Kube/Core/AllocatedFlatVector.hpp>
+#include <Kube/Core/AllocatedString.hpp>
+
+using namespace kF;
+
+static Core::ArenaAllocator Arena(1024);
+
+TEST(ArenaAllocator, Basics)
+{
+    Core::ArenaAllocator arena(256);
+
+    ASSERT_EQ(arena.reservedBytes(), 0);
+    auto a = arena.allocate(10, 1);
+    auto b = arena.allocate(8, 8);
+    auto c = arena.allocate(4, 128);
+    ASSERT_NE(a, nullptr);
+    ASSERT_NE(b, nullptr);
+    ASSERT_NE(c, nullptr);
+    ASSERT_EQ(reinterpret_cast<std::uintptr_t>(b) % 8, 0);
+    ASSERT_EQ(reinterpret_cast<std::uintptr_t>(c) % 128, 0);
+    ASSERT_EQ(arena.reservedBytes(), 256);
+
+    // Oversized allocation gets its own block
+    auto big = arena.allocate(1000, 16);
+    ASSERT_NE(big, nullptr);
+    ASSERT_EQ(reinterpret_cast<std::uintptr_t>(big) % 16, 0);
+    ASSERT_EQ(arena.reservedBytes(), 1256);
+
+    arena.release();
+    ASSERT_EQ(arena.reservedBytes(), 0);
+}
+
+TEST(ArenaAllocator, LastDeallocation)
+{
+    Core::ArenaAllocator arena(256);
+
+    auto a = arena.allocate(32, 8);
+    arena.deallocate(a, 32, 8);
+    auto b = arena.allocate(32, 8);
+    ASSERT_EQ(a, b);
+    auto c = arena.allocate(32, 8);
+    arena.deallocate(b, 32, 8);
+    ASSERT_NE(arena.allocate(32, 8), b);
+    ASSERT_NE(c, b);
+}
+
+TEST(ArenaAllocator, Markers)
+{
+    Core::ArenaAllocator arena(128);
+
+    auto first = arena.allocate(16, 8);
+    void *inner = nullptr;
+    {
+        Core::ArenaAllocator::ScopedMarker scope(arena);
+        inner = arena.allocate(16, 8);
+        for (auto i = 0; i < 32; ++i)
+            ASSERT_NE(arena.allocate(16, 8), nullptr);
+    }
+    const auto reserved = arena.reservedBytes();
+    ASSERT_EQ(arena.allocate(16, 8), inner);
+    for (auto i = 0; i < 32; ++i)
+        ASSERT_NE(arena.allocate(16, 8), nullptr);
+    ASSERT_EQ(arena.reservedBytes(), reserved);
+    arena.reset();
+    ASSERT_EQ(arena.allocate(16, 8), first);
+    ASSERT_EQ(arena.reservedBytes(), reserved);
+}
+
+TEST(ArenaAllocator, Containers)
+{
+    constexpr auto count = 100ul;
+
+    Core::ArenaAllocator::ScopedMarker scope(Arena);
+    {
+        Core::AllocatedVector<std::size_t, &Core::ArenaAllocate<Arena>, &Core::ArenaDeallocate<Arena>> vector;
+        Core::AllocatedSmallVector<std::size_t, 4, &Core::ArenaAllocate<Arena>, &Core::ArenaDeallocate<Arena>> smallVector;
+        Core::AllocatedFlatVector<std::size_t, &Core::ArenaAllocate<Arena>, &Core::ArenaDeallocate<Arena>> flatVector;
+        for (auto i = 0ul; i < count; ++i) {
+            vector.push(i);
+            smallVector.push(i);
+            flatVector.push(i);
+        }
+        for (auto i = 0ul; i < count; ++i) {
+            ASSERT_EQ(vector[i], i);
+            ASSERT_EQ(smallVector[i], i);
+            ASSERT_EQ(flatVector[i], i);
+        }
+    }
+    {
+        constexpr auto str = "Arena allocated string";
+        Core::AllocatedString<&Core::ArenaAllocator::ThreadLocalAllocate, &Core::ArenaAllocator::ThreadLocalDeallocate> string(str);
+        ASSERT_EQ(string, str);
+        string += str;
+        ASSERT_EQ(string.size(), std::strlen(str) * 2);
+    }
+}
+
+TEST(ArenaAllocator, Reallocation)
+{
+    constexpr auto count = 100ul;
+
+    Core::ArenaAllocator arena(4096);
+    auto a = arena.allocate(16, 8);
+    ASSERT_EQ(arena.reallocate(a, 16, 64, 8), a);
+    ASSERT_EQ(arena.reallocate(a, 64, 32, 8), a);
+    auto b = arena.allocate(16, 8);
+    ASSERT_EQ(reinterpret_cast<std::byte *>(b), reinterpret_cast<std::byte *>(a) + 32);
+    ASSERT_EQ(arena.reallocate(a, 32, 64, 8), nullptr);
+    ASSERT_EQ(arena.reallocate(b, 16, 8192, 8), nullptr);
+
+    // Containers grow in place while they own the last allocation
+    Core::ArenaAllocator::ScopedMarker scope(Arena);
+    Core::AllocatedVector<std::size_t, &Core::ArenaAllocate<Arena>, &Core::ArenaDeallocate<Arena>, std::size_t, &Core::ArenaReallocate<Arena>> vector;
+    Core::AllocatedFlatVector<std::size_t, &Core::ArenaAllocate<Arena>, &Core::ArenaDeallocate<Arena>, std::size_t, Core::Internal::NoCustomHeaderType, &Core::ArenaReallocate<Arena>> flatVector;
+    vector.push(0ul);
+    const auto data = vector.data();
+    for (auto i = 1ul; i < count; ++i)
+        vector.push(i);
+    ASSERT_EQ(vector.data(), data);
+    for (auto i = 0ul; i < count; ++i) {
+        ASSERT_EQ(vector[i], i);
+        flatVector.push(i);
+    }
+    for (auto i = 0ul; i < count; ++i)
+        ASSERT_EQ(flatVector[i], i);
+}
@@ -0,0 +1,315 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: BTreeSet and BTreeMap unit tests
+ */
+
+#include <gtest/gtest.h>
+
+#include <map>
+#include <random>
+#include <set>
+#include <string>
+#include <string_view>
+
+#include <Kube/Core/BTreeMap.hpp>
+#include <Kube/Core/BTreeSet.hpp>
+
+using namespace kF;
+
+static void *BTreeAlloc(const std::size_t bytes, const std::size_t alignment)
+{
+    return Core::Utils::AlignedAlloc(bytes, alignment);
+}
+
+static void BTreeDealloc(void * const data, const std::size_t, const std::size_t)
+{
+    Core::Utils::AlignedFree(data);
+}
+
+/** @brief Smallest node size, forces deep trees with few elements */
+constexpr std::size_t TinyNodeSize = Core::CacheLineSize;
+
+template<typename Tree, typename Reference>
+static void CompareTree(const Tree &tree, const Reference &reference)
+{
+    ASSERT_EQ(tree.size(), reference.size());
+    ASSERT_EQ(tree.empty(), reference.empty());
+    auto it = tree.begin();
+    for (const auto &elem : reference) {
+        ASSERT_NE(it, tree.end());
+        if constexpr (requires { elem.second; }) {
+            ASSERT_EQ(it.key(), elem.first);
+            ASSERT_EQ(it.value(), elem.second);
+        } else
+            ASSERT_EQ(*it, elem);
+        ++it;
+    }
+    ASSERT_EQ(it, tree.end());
+    auto rit = reference.rbegin();
+    for (auto it = tree.end(); it != tree.begin(); ++rit) {
+        --it;
+        if constexpr (requires { rit->second; })
+            ASSERT_EQ(it.key(), rit->first);
+        else
+            ASSERT_EQ(*it, *rit);
+    }
+}
+
+#define GENERATE_BTREE_SET_TESTS(BTreeSet, ...) \
+TEST(BTreeSet, Basics) \
+{ \
+    Core::BTreeSet<int __VA_OPT__(,) __VA_ARGS__> set; \
+    ASSERT_TRUE(set.empty()); \
+    ASSERT_FALSE(set.contains(0)); \
+    ASSERT_EQ(set.find(0), set.end()); \
+    ASSERT_EQ(set.lowerBound(0), set.end()); \
+    ASSERT_EQ(set.begin(), set.end()); \
+    ASSERT_FALSE(set.erase(0)); \
+    for (auto i = 0; i < 1000; ++i) \
+        ASSERT_EQ(set.push((i * 37) % 1000), (i * 37) % 1000); \
+    ASSERT_EQ(set.size(), 1000); \
+    ASSERT_EQ(set.front(), 0); \
+    ASSERT_EQ(set.back(), 999); \
+    auto expected = 0; \
+    for (const auto key : set) \
+        ASSERT_EQ(key, expected++); \
+    for (auto i = 0; i < 1000; ++i) \
+        ASSERT_TRUE(set.contains(i)); \
+    ASSERT_FALSE(set.contains(1000)); \
+    ASSERT_EQ(*set.insert(500), 500); \
+    ASSERT_EQ(set.size(), 1001); \
+    ASSERT_EQ(std::distance(set.lowerBound(500), set.upperBound(500)), 2); \
+    ASSERT_EQ(*set.findSortedPlacement(500), 501); \
+    ASSERT_EQ(set.findSortedPlacement(999), set.end()); \
+    for (auto i = 0; i < 1000; i += 2) \
+        ASSERT_TRUE(set.erase(i)); \
+    ASSERT_EQ(set.size(), 501); \
+    ASSERT_TRUE(set.contains(500)); \
+    ASSERT_TRUE(set.erase(500)); \
+    ASSERT_FALSE(set.contains(500)); \
+    expected = 1; \
+    for (const auto key : set) { \
+        ASSERT_EQ(key, expected); \
+        expected += 2; \
+    } \
+    set.clear(); \
+    ASSERT_TRUE(set.empty()); \
+    ASSERT_EQ(set.begin(), set.end()); \
+    set.insert({ 3, 1, 2 }); \
+    ASSERT_EQ(set, (Core::BTreeSet<int __VA_OPT__(,) __VA_ARGS__>({ 1, 2, 3 }))); \
+} \
+ \
+TEST(BTreeSet, Randomized) \
+{ \
+    Core::BTreeSet<int __VA_OPT__(,) __VA_ARGS__> set; \
+    std::multiset<int> reference; \
+    std::mt19937 gen(42); \
+    std::uniform_int_distribution<int> dist(0, 2000); \
+    for (auto round = 0; round < 4; ++round) { \
+        for (auto i = 0; i < 5000; ++i) { \
+            const auto key = dist(gen); \
+            set.push(key); \
+            reference.insert(key); \
+        } \
+        CompareTree(set, reference); \
+        for (auto i = 0; i < 4000; ++i) { \
+            const auto key = dist(gen); \
+            const auto it = reference.find(key); \
+            ASSERT_EQ(set.erase(key), it != reference.end()); \
+            if (it != reference.end()) \
+                reference.erase(it); \
+        } \
+        CompareTree(set, reference); \
+        for (auto i = 0; i < 200; ++i) { \
+            const auto key = dist(gen); \
+            ASSERT_EQ(std::distance(set.begin(), set.lowerBound(key)), std::distance(reference.begin(), reference.lower_bound(key))); \
+            ASSERT_EQ(std::distance(set.begin(), set.upperBound(key)), std::distance(reference.begin(), reference.upper_bound(key))); \
+        } \
+    } \
+    while (!set.empty()) { \
+        const auto offset = std::uniform_int_distribution<std::size_t>(0, set.size() - 1)(gen); \
+        auto it = set.begin(); \
+        auto refIt = reference.begin(); \
+        std::advance(it, offset); \
+        std::advance(refIt, offset); \
+        it = set.erase(it); \
+        refIt = reference.erase(refIt); \
+        ASSERT_EQ(it == set.end(), refIt == reference.end()); \
+        if (refIt != reference.end()) { \
+            ASSERT_EQ(*it, *refIt); \
+        } \
+    } \
+    ASSERT_TRUE(reference.empty()); \
+} \
+ \
+TEST(BTreeSet, EraseRange) \
+{ \
+    Core::BTreeSet<int __VA_OPT__(,) __VA_ARGS__> set; \
+    for (auto i = 0; i < 3000; ++i) \
+        set.push(i); \
+    const auto it = set.erase(set.find(100), set.find(2900)); \
+    ASSERT_EQ(*it, 2900); \
+    ASSERT_EQ(set.size(), 200); \
+    auto expected = 0; \
+    for (const auto key : set) { \
+        ASSERT_EQ(key, expected); \
+        expected = expected == 99 ? 2900 : expected + 1; \
+    } \
+    const auto last = set.erase(set.begin(), set.end()); \
+    ASSERT_TRUE(set.empty()); \
+    ASSERT_EQ(last, set.end()); \
+} \
+ \
+TEST(BTreeSet, CopyMove) \
+{ \
+    using Set = Core::BTreeSet<int __VA_OPT__(,) __VA_ARGS__>; \
+    Set set; \
+    for (auto i = 0; i < 2000; ++i) \
+        set.push(i % 700); \
+    Set copy(set); \
+    ASSERT_EQ(copy, set); \
+    copy.erase(0); \
+    ASSERT_NE(copy, set); \
+    copy = set; \
+    ASSERT_EQ(copy, set); \
+    copy.push(42); \
+    ASSERT_EQ(copy.size(), set.size() + 1); \
+    Set moved(std::move(copy)); \
+    ASSERT_TRUE(copy.empty()); \
+    ASSERT_EQ(moved.size(), set.size() + 1); \
+    copy = std::move(moved); \
+    ASSERT_EQ(copy.size(), set.size() + 1); \
+    auto expected = 0; \
+    for (auto it = copy.begin(); it != copy.end(); ++it) { \
+        ASSERT_GE(*it, expected); \
+        expected = *it; \
+    } \
+}
+
+GENERATE_BTREE_SET_TESTS(BTreeSet)
+GENERATE_BTREE_SET_TESTS(TinyBTreeSet, std::less<int>, TinyNodeSize)
+GENERATE_BTREE_SET_TESTS(AllocatedBTreeSet, &BTreeAlloc, &BTreeDealloc, std::size_t, std::less<int>, TinyNodeSize)
+
+TEST(BTreeSet, Strings)
+{
+    Core::BTreeSet<std::string, std::size_t, std::less<>, TinyNodeSize> set;
+    std::multiset<std::string> reference;
+    std::mt19937 gen(7);
+    std::uniform_int_distribution<int> dist(0, 500);
+
+    for (auto i = 0; i < 3000; ++i) {
+        // Long strings, so that they are allocated on the heap
+        auto str = std::to_string(dist(gen)) + std::string(24, 'x');
+        reference.insert(str);
+        set.push(std::move(str));
+    }
+    CompareTree(set, reference);
+    for (auto i = 0; i < 2000; ++i) {
+        const auto str = std::to_string(dist(gen)) + std::string(24, 'x');
+        const auto it = reference.find(str);
+        ASSERT_EQ(set.erase(std::string_view(str)), it != reference.end());
+        if (it != reference.end())
+            reference.erase(it);
+    }
+    CompareTree(set, reference);
+    auto copy = set;
+    ASSERT_EQ(copy, set);
+}
+
+TEST(BTreeSet, CustomCompare)
+{
+    Core::BTreeSet<int, std::size_t, std::greater<int>, TinyNodeSize> set({ 1, 5, 3, 4, 2 });
+
+    ASSERT_EQ(set.front(), 5);
+    ASSERT_EQ(set.back(), 1);
+    ASSERT_EQ(*set.lowerBound(3), 3);
+    ASSERT_EQ(*set.upperBound(3), 2);
+}
+
+
+#define GENERATE_BTREE_MAP_TESTS(BTreeMap, ...) \
+TEST(BTreeMap, Basics) \
+{ \
+    Core::BTreeMap<int, std::string __VA_OPT__(,) __VA_ARGS__> map; \
+    ASSERT_TRUE(map.empty()); \
+    ASSERT_EQ(map.findValue(0), nullptr); \
+    for (auto i = 0; i < 1000; ++i) { \
+        const auto key = (i * 37) % 1000; \
+        const auto [it, inserted] = map.tryEmplace(key, std::to_string(key)); \
+        ASSERT_TRUE(inserted); \
+        ASSERT_EQ(it.key(), key); \
+        ASSERT_EQ(it.value(), std::to_string(key)); \
+    } \
+    ASSERT_EQ(map.size(), 1000); \
+    const auto [it, inserted] = map.tryEmplace(10, "other"); \
+    ASSERT_FALSE(inserted); \
+    ASSERT_EQ(it.value(), "10"); \
+    ASSERT_FALSE(map.insertOrAssign(10, std::string("other")).second); \
+    ASSERT_EQ(map.at(10), "other"); \
+    ASSERT_EQ(map[1000], ""); \
+    ASSERT_EQ(map.size(), 1001); \
+    map[1000] = "last"; \
+    ASSERT_EQ(*map.findValue(1000), "last"); \
+    auto expected = 0; \
+    map.forEach([&expected](const int key, const std::string &) { ASSERT_EQ(key, expected++); }); \
+    for (auto i = 0; i < 1000; i += 2) \
+        ASSERT_TRUE(map.erase(i)); \
+    ASSERT_EQ(map.size(), 501); \
+    for (auto it = map.begin(); it != map.end(); ++it) { \
+        ASSERT_EQ(it.key() % 2 || it.key() == 1000, true); \
+        if (it.key() != 10 && it.key() != 1000) { \
+            ASSERT_EQ(it.value(), std::to_string(it.key())); \
+        } \
+    } \
+    const auto copy = map; \
+    ASSERT_EQ(copy, map); \
+    ASSERT_EQ(copy.at(1000), "last"); \
+} \
+ \
+TEST(BTreeMap, Randomized) \
+{ \
+    Core::BTreeMap<int, std::size_t __VA_OPT__(,) __VA_ARGS__> map; \
+    std::map<int, std::size_t> reference; \
+    std::mt19937 gen(1337); \
+    std::uniform_int_distribution<int> dist(0, 5000); \
+    for (auto round = 0; round < 4; ++round) { \
+        for (std::size_t i = 0; i < 6000; ++i) { \
+            const auto key = dist(gen); \
+            if (i % 3) { \
+                ASSERT_EQ(map.tryEmplace(key, i).second, reference.try_emplace(key, i).second); \
+            } else { \
+                ASSERT_EQ(map.insertOrAssign(key, i).second, reference.insert_or_assign(key, i).second); \
+            } \
+        } \
+        CompareTree(map, reference); \
+        for (auto i = 0; i < 5000; ++i) { \
+            const auto key = dist(gen); \
+            ASSERT_EQ(map.erase(key), reference.erase(key) == 1); \
+        } \
+        CompareTree(map, reference); \
+    } \
+}
+
+GENERATE_BTREE_MAP_TESTS(BTreeMap)
+GENERATE_BTREE_MAP_TESTS(TinyBTreeMap, std::less<>, TinyNodeSize)
+GENERATE_BTREE_MAP_TESTS(AllocatedBTreeMap, &BTreeAlloc, &BTreeDealloc, std::size_t, std::less<>, TinyNodeSize)
+
+TEST(BTreeMap, HeterogeneousLookup)
+{
+    Core::BTreeMap<std::string, int> map {
+        { "one", 1 },
+        { "two", 2 },
+        { "three", 3 },
+        { "one", 4 }
+    };
+
+    ASSERT_EQ(map.size(), 3);
+    ASSERT_EQ(map.at(std::string_view("one")), 1);
+    ASSERT_EQ(map.at("three"), 3);
+    ASSERT_TRUE(map.contains(std::string_view("two")));
+    ASSERT_FALSE(map.contains("four"));
+    ASSERT_TRUE(map.erase(std::string_view("two")));
+    ASSERT_EQ(map.size(), 2);
+    map["four"] = 4;
+    ASSERT_EQ(map.front(), "four");
+}
@@ -0,0 +1,204 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: FlatImage unit tests
+ */
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <string_view>
+
+#ifndef _WIN32
+# include <fcntl.h>
+# include <sys/mman.h>
+# include <unistd.h>
+#endif
+
+#include <Kube/Core/FlatImage.hpp>
+#include <Kube/Core/FlatString.hpp>
+
+using namespace kF;
+
+/** @brief Trivially copyable tree node, children are nested through references */
+struct Node
+{
+    std::uint32_t id {};
+    Core::FlatImageStringRef<std::uint32_t> name {};
+    Core::FlatImageRef<std::uint32_t, std::uint32_t> values {};
+};
+
+struct Custom
+{
+    std::uint64_t tag {};
+};
+
+/** @brief Copy an image into page aligned memory, as a mapped file would be */
+[[nodiscard]] static std::unique_ptr<std::byte, decltype(&Core::Utils::AlignedFree)> CopyImage(const Core::FlatImageWriter &writer)
+{
+    std::unique_ptr<std::byte, decltype(&Core::Utils::AlignedFree)> copy(
+        Core::Utils::AlignedAlloc<4096, std::byte>(writer.bytes()), &Core::Utils::AlignedFree);
+    std::memcpy(copy.get(), writer.data(), writer.bytes());
+    return copy;
+}
+
+TEST(FlatImage, Basics)
+{
+    Core::FlatImageWriter writer;
+    const std::size_t values[] = { 1, 2, 3, 4 };
+    writer.setRoot(writer.write(std::begin(values), std::end(values)));
+
+    const auto copy = CopyImage(writer);
+    const Core::FlatImage image(copy.get(), writer.bytes());
+    ASSERT_TRUE(image.isValid());
+    const auto root = image.root<std::size_t>();
+    ASSERT_EQ(root.size(), 4);
+    ASSERT_EQ(root, values);
+    ASSERT_EQ(root.back(), 4);
+    ASSERT_EQ(root.data(), reinterpret_cast<const std::size_t *>(copy.get() + image.header().root + sizeof(Core::FlatImageView<std::size_t>::Header)));
+}
+
+TEST(FlatImage, Empty)
+{
+    Core::FlatImageWriter writer;
+    const auto copy = CopyImage(writer);
+    const Core::FlatImage image(copy.get(), writer.bytes());
+
+    ASSERT_TRUE(image.isValid());
+    ASSERT_TRUE(image.root<int>().empty());
+    ASSERT_EQ(image.root<int>().begin(), image.root<int>().end());
+
+    const auto ref = writer.write<std::uint32_t, int>(nullptr, nullptr);
+    ASSERT_TRUE(ref);
+    const auto copy2 = CopyImage(writer);
+    const Core::FlatImage image2(copy2.get(), writer.bytes());
+    ASSERT_TRUE(image2.isValid(ref));
+    ASSERT_TRUE(image2.view(ref).empty());
+}
+
+TEST(FlatImage, FlatVector)
+{
+    Core::FlatImageWriter writer;
+    Core::FlatVector<int, std::uint32_t, Custom> vector { 4, 8, 15, 16, 23, 42 };
+    vector.headerCustomType().tag = 0xCAFE;
+    const auto ref = writer.write(vector);
+    const Core::FlatString str("Flat string dumped as is");
+    const auto strRef = writer.write(str);
+
+    const auto copy = CopyImage(writer);
+    const Core::FlatImage image(copy.get(), writer.bytes());
+    ASSERT_TRUE(image.isValid());
+    const auto view = image.view(ref);
+    ASSERT_EQ(view, vector);
+    ASSERT_EQ(view.headerCustomType().tag, 0xCAFE);
+    const auto strView = image.view(strRef);
+    ASSERT_EQ(strView.toStdView(), str.toStdView());
+}
+
+TEST(FlatImage, AlignedFlatVector)
+{
+    Core::FlatImageWriter writer;
+    const Core::FlatString str("Misaligns the next block");
+    writer.write(str);
+    Core::AlignedFlatVector<float, 64> vector { 1.0f, 2.0f, 3.0f, 4.0f, 5.0f };
+    const auto ref = writer.write(vector);
+    ASSERT_EQ(writer.alignment(), 64);
+
+    const auto copy = CopyImage(writer);
+    const Core::FlatImage image(copy.get(), writer.bytes());
+    ASSERT_TRUE(image.isValid());
+    ASSERT_TRUE(image.isValid(ref));
+    const auto view = image.view(ref);
+    ASSERT_EQ(view, vector);
+    ASSERT_EQ(reinterpret_cast<std::uintptr_t>(view.data()) % 64, 0);
+    ASSERT_EQ(sizeof(decltype(view)::Header), 64);
+}
+
+TEST(FlatImage, NestedTree)
+{
+    constexpr auto count = 32u;
+    constexpr std::string_view Prefix = "Node #";
+
+    Core::FlatImageWriter writer;
+    Core::Vector<Node> nodes;
+    for (auto i = 0u; i < count; ++i) {
+        const auto name = std::string(Prefix) + std::to_string(i);
+        Core::Vector<std::uint32_t> values;
+        values.pushN(i, [i](const auto j) { return i * j; });
+        nodes.push(Node {
+            .id = i,
+            .name = writer.write<std::uint32_t>(name.data(), name.data() + name.size()),
+            .values = writer.write<std::uint32_t>(values.begin(), values.end())
+        });
+    }
+    writer.setRoot(writer.write<std::uint32_t>(nodes.begin(), nodes.end()));
+
+    const auto copy = CopyImage(writer);
+    const Core::FlatImage image(copy.get(), writer.bytes());
+    ASSERT_TRUE(image.isValid());
+    const auto root = image.root<Node, std::uint32_t>();
+    ASSERT_EQ(root.size(), count);
+    for (const auto &node : root) {
+        ASSERT_TRUE(image.isValid(node.name));
+        ASSERT_TRUE(image.isValid(node.values));
+        const auto name = image.view(node.name);
+        ASSERT_EQ(name.toStdView(), std::string(Prefix) + std::to_string(node.id));
+        const auto values = image.view(node.values);
+        ASSERT_EQ(values.size(), node.id);
+        for (auto j = 0u; j < values.size(); ++j)
+            ASSERT_EQ(values[j], node.id * j);
+    }
+}
+
+TEST(FlatImage, Invalid)
+{
+    Core::FlatImageWriter writer;
+    const std::uint64_t values[] = { 1, 2, 3 };
+    const auto ref = writer.write(std::begin(values), std::end(values));
+    const auto copy = CopyImage(writer);
+
+    ASSERT_FALSE(Core::FlatImage().isValid());
+    ASSERT_FALSE(Core::FlatImage(copy.get(), sizeof(Core::FlatImageHeader) - 1).isValid());
+    ASSERT_FALSE(Core::FlatImage(copy.get(), writer.bytes() - 1).isValid());
+    ASSERT_FALSE(Core::FlatImage(copy.get() + 8, writer.bytes() - 8).isValid());
+
+    const Core::FlatImage image(copy.get(), writer.bytes());
+    ASSERT_TRUE(image.isValid(ref));
+    ASSERT_FALSE(image.isValid(Core::FlatImageRef<std::uint64_t> { 8 }));
+    ASSERT_FALSE(image.isValid(Core::FlatImageRef<std::uint64_t> { writer.bytes() }));
+    ASSERT_FALSE(image.isValid(Core::FlatImageRef<std::uint64_t> { ref.offset + 1 }));
+    ASSERT_FALSE(image.isValid(Core::FlatImageRef<std::uint64_t> { ~std::uint64_t() & ~std::uint64_t(63) }));
+
+    // Corrupted size overflowing the image
+    reinterpret_cast<Core::FlatImageView<std::uint64_t>::Header *>(copy.get() + ref.offset)->size = 4;
+    ASSERT_FALSE(image.isValid(ref));
+    reinterpret_cast<Core::FlatImageHeader *>(copy.get())->magic = 0;
+    ASSERT_FALSE(image.isValid());
+}
+
+#ifndef _WIN32
+TEST(FlatImage, MappedFile)
+{
+    constexpr auto count = 10000ul;
+
+    Core::FlatImageWriter writer;
+    Core::Vector<std::size_t> values;
+    values.pushN(count, [](const auto i) { return i * i; });
+    writer.setRoot(writer.write(values.begin(), values.end()));
+
+    char path[] = "/tmp/kube_flat_image_XXXXXX";
+    const auto fd = ::mkstemp(path);
+    ASSERT_NE(fd, -1);
+    ASSERT_EQ(::write(fd, writer.data(), writer.bytes()), static_cast<ssize_t>(writer.bytes()));
+    const auto mapped = ::mmap(nullptr, writer.bytes(), PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    ::unlink(path);
+    ASSERT_NE(mapped, MAP_FAILED);
+
+    const Core::FlatImage image(mapped, writer.bytes());
+    ASSERT_TRUE(image.isValid());
+    const auto root = image.root<std::size_t>();
+    ASSERT_EQ(root, values);
+    ASSERT_EQ(reinterpret_cast<const void *>(root.data()), reinterpret_cast<const std::byte *>(mapped) + image.header().root + sizeof(Core::FlatImageView<std::size_t>::Header));
+    ::munmap(mapped, writer.bytes());
+}
+#endif
@@ -0,0 +1,215 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: FlatMap and FlatSet unit tests
+ */
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <string_view>
+
+#include <Kube/Core/FlatMap.hpp>
+#include <Kube/Core/FlatSet.hpp>
+
+using namespace kF;
+
+static void *FlatAlloc(const std::size_t bytes, const std::size_t alignment)
+{
+    return Core::Utils::AlignedAlloc(bytes, alignment);
+}
+
+static void FlatDealloc(void * const data, const std::size_t, const std::size_t)
+{
+    Core::Utils::AlignedFree(data);
+}
+
+#define GENERATE_FLAT_SET_TESTS(FlatSet, ...) \
+TEST(FlatSet, Basics) \
+{ \
+    Core::FlatSet<int __VA_OPT__(,) __VA_ARGS__> set; \
+    ASSERT_TRUE(set.empty()); \
+    ASSERT_FALSE(set.contains(0)); \
+    ASSERT_EQ(set.find(0), set.end()); \
+    ASSERT_EQ(set.lowerBound(0), set.end()); \
+    for (auto i = 0; i < 100; ++i) { \
+        const auto key = (i * 37) % 100; \
+        const auto [it, inserted] = set.insert(key); \
+        ASSERT_TRUE(inserted); \
+        ASSERT_EQ(*it, key); \
+    } \
+    ASSERT_EQ(set.size(), 100); \
+    ASSERT_TRUE(std::is_sorted(set.begin(), set.end())); \
+    const auto [it, inserted] = set.insert(42); \
+    ASSERT_FALSE(inserted); \
+    ASSERT_EQ(*it, 42); \
+    ASSERT_EQ(set.size(), 100); \
+    for (auto i = 0; i < 100; ++i) { \
+        ASSERT_TRUE(set.contains(i)); \
+        ASSERT_EQ(*set.find(i), i); \
+        ASSERT_EQ(set.findIndex(i), i); \
+    } \
+    ASSERT_FALSE(set.contains(100)); \
+    ASSERT_EQ(set.find(-1), set.end()); \
+    ASSERT_EQ(set.upperBound(41), set.find(42)); \
+    ASSERT_TRUE(set.erase(42)); \
+    ASSERT_FALSE(set.erase(42)); \
+    ASSERT_FALSE(set.contains(42)); \
+    ASSERT_EQ(*set.lowerBound(42), 43); \
+    ASSERT_EQ(set.size(), 99); \
+    auto copy(set); \
+    ASSERT_EQ(copy, set); \
+    set.clear(); \
+    ASSERT_TRUE(set.empty()); \
+    ASSERT_NE(copy, set); \
+    set = std::move(copy); \
+    ASSERT_EQ(set.size(), 99); \
+    set.insert({ 42, 1000, 42, -1 }); \
+    ASSERT_EQ(set.size(), 102); \
+    ASSERT_TRUE(std::is_sorted(set.begin(), set.end())); \
+    ASSERT_EQ(std::adjacent_find(set.begin(), set.end()), set.end()); \
+    set.release(); \
+    ASSERT_TRUE(set.empty()); \
+}
+
+#define GENERATE_FLAT_MAP_TESTS(FlatMap, ...) \
+TEST(FlatMap, Basics) \
+{ \
+    Core::FlatMap<int, std::string __VA_OPT__(,) __VA_ARGS__> map; \
+    ASSERT_TRUE(map.empty()); \
+    ASSERT_EQ(map.find(0), nullptr); \
+    for (auto i = 0; i < 100; ++i) { \
+        const auto key = (i * 37) % 100; \
+        auto [value, inserted] = map.tryEmplace(key, std::to_string(key)); \
+        ASSERT_TRUE(inserted); \
+        ASSERT_EQ(value, std::to_string(key)); \
+    } \
+    ASSERT_EQ(map.size(), 100); \
+    ASSERT_EQ(map.values().size(), 100); \
+    ASSERT_TRUE(std::is_sorted(map.keys().begin(), map.keys().end())); \
+    for (auto i = 0; i < 100; ++i) { \
+        ASSERT_TRUE(map.contains(i)); \
+        ASSERT_EQ(*map.find(i), std::to_string(i)); \
+        ASSERT_EQ(map.at(i), std::to_string(i)); \
+        ASSERT_EQ(map.keyAt(static_cast<std::size_t>(i)), i); \
+        ASSERT_EQ(map.valueAt(static_cast<std::size_t>(i)), std::to_string(i)); \
+    } \
+    auto [value, inserted] = map.tryEmplace(42, "unused"); \
+    ASSERT_FALSE(inserted); \
+    ASSERT_EQ(value, "42"); \
+    ASSERT_FALSE(map.insertOrAssign(42, std::string("answer")).second); \
+    ASSERT_EQ(map.at(42), "answer"); \
+    ASSERT_TRUE(map.insertOrAssign(1000, std::string("thousand")).second); \
+    ASSERT_EQ(map.lowerBound(1000), map.size() - 1); \
+    ASSERT_EQ(map.upperBound(1000), map.size()); \
+    map[-1] = "minus"; \
+    ASSERT_EQ(map.keyAt(0), -1); \
+    ASSERT_EQ(map.valueAt(0), "minus"); \
+    ASSERT_TRUE(map.erase(42)); \
+    ASSERT_FALSE(map.erase(42)); \
+    ASSERT_FALSE(map.contains(42)); \
+    ASSERT_EQ(map.size(), 101); \
+    ASSERT_EQ(map.values().size(), 101); \
+    auto index = 0; \
+    map.forEach([&index, &map](const int key, const std::string &value) { \
+        ASSERT_EQ(key, map.keyAt(static_cast<std::size_t>(index))); \
+        ASSERT_EQ(value, *map.find(key)); \
+        ++index; \
+    }); \
+    ASSERT_EQ(index, 101); \
+    auto copy(map); \
+    ASSERT_EQ(copy, map); \
+    map.clear(); \
+    ASSERT_TRUE(map.empty()); \
+    map = std::move(copy); \
+    ASSERT_EQ(map.size(), 101); \
+    ASSERT_EQ(*map.find(1000), "thousand"); \
+    map.release(); \
+    ASSERT_TRUE(map.empty()); \
+}
+
+GENERATE_FLAT_SET_TESTS(FlatSet)
+GENERATE_FLAT_SET_TESTS(TinyFlatSet)
+GENERATE_FLAT_SET_TESTS(SmallFlatSet, 8)
+GENERATE_FLAT_SET_TESTS(FlatVectorSet)
+GENERATE_FLAT_SET_TESTS(AllocatedFlatSet, &FlatAlloc, &FlatDealloc)
+GENERATE_FLAT_SET_TESTS(AllocatedSmallFlatSet, 8, &FlatAlloc, &FlatDealloc)
+
+GENERATE_FLAT_MAP_TESTS(FlatMap)
+GENERATE_FLAT_MAP_TESTS(TinyFlatMap)
+GENERATE_FLAT_MAP_TESTS(SmallFlatMap, 8)
+GENERATE_FLAT_MAP_TESTS(FlatVectorMap)
+GENERATE_FLAT_MAP_TESTS(AllocatedFlatMap, &FlatAlloc, &FlatDealloc)
+GENERATE_FLAT_MAP_TESTS(AllocatedSmallFlatMap, 8, &FlatAlloc, &FlatDealloc)
+
+TEST(FlatMap, HeterogeneousLookup)
+{
+    Core::FlatMap<std::string, int> map {
+        { "one", 1 },
+        { "two", 2 },
+        { "three", 3 },
+        { "one", 4 }
+    };
+
+    ASSERT_EQ(map.size(), 3);
+    ASSERT_EQ(map.at(std::string_view("one")), 1);
+    ASSERT_EQ(*map.find("two"), 2);
+    ASSERT_TRUE(map.contains(std::string_view("three")));
+    ASSERT_FALSE(map.contains("four"));
+    ASSERT_TRUE(map.tryEmplace("four", 4).second);
+    ASSERT_EQ(map.keyAt(map.findIndex("four")), "four");
+    ASSERT_TRUE(map.erase(std::string_view("one")));
+    ASSERT_EQ(map.keyAt(0), "four");
+
+    Core::FlatSet<std::string> set { "b", "a", "c", "a" };
+    ASSERT_EQ(set.size(), 3);
+    ASSERT_EQ(set.at(0), "a");
+    ASSERT_TRUE(set.contains(std::string_view("b")));
+    ASSERT_TRUE(set.tryEmplace(std::string_view("d")).second);
+    ASSERT_EQ(set.back(), "d");
+}
+
+/** @brief Lookup key whose conversion to std::string throws when empty */
+struct ThrowingKey
+{
+    std::string_view value {};
+
+    explicit operator std::string(void) const
+    {
+        if (value.empty())
+            throw std::invalid_argument("ThrowingKey: Empty key");
+        return std::string(value);
+    }
+
+    [[nodiscard]] friend bool operator<(const ThrowingKey &lhs, const std::string &rhs) noexcept { return lhs.value < rhs; }
+    [[nodiscard]] friend bool operator<(const std::string &lhs, const ThrowingKey &rhs) noexcept { return lhs < rhs.value; }
+};
+
+TEST(FlatMap, ThrowingKeyConversion)
+{
+    Core::FlatMap<std::string, int> map { { "b", 2 }, { "c", 3 } };
+
+    ASSERT_ANY_THROW(map.tryEmplace(ThrowingKey {}, 1));
+    ASSERT_ANY_THROW(map.insertOrAssign(ThrowingKey {}, 1));
+    ASSERT_EQ(map.size(), 2);
+    ASSERT_EQ(map.at("b"), 2);
+    ASSERT_EQ(map.at("c"), 3);
+    ASSERT_TRUE(map.tryEmplace(ThrowingKey { "a" }, 1).second);
+    ASSERT_EQ(map.at("a"), 1);
+    ASSERT_EQ(map.at("b"), 2);
+}
+
+TEST(FlatMap, CustomCompare)
+{
+    Core::FlatMap<int, int, std::size_t, std::greater<int>> map;
+
+    for (auto i = 0; i < 10; ++i)
+        map[i] = i * i;
+    ASSERT_EQ(map.keyAt(0), 9);
+    ASSERT_EQ(map.keyAt(9), 0);
+    ASSERT_EQ(map.at(3), 9);
+    ASSERT_EQ(map.lowerBound(5), 4);
+}
+
+static_assert(Core::IsTriviallyRelocatable<Core::FlatMap<int, std::string>>::Value, "FlatMap must be trivially relocatable");
+static_assert(Core::IsTriviallyRelocatable<Core::FlatSet<std::string>>::Value, "FlatSet must be trivially relocatable");
+static_assert(sizeof(Core::FlatVectorMap<int, int>) == 2 * sizeof(void *), "FlatVectorMap must only hold two pointers");
@@ -0,0 +1,73 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Tests of the vector growth policies
+ */
+
+#include <gtest/gtest.h>
+
+#include <Kube/Core/Vector.hpp>
+#include <Kube/Core/SmallVector.hpp>
+#include <Kube/Core/FlatVector.hpp>
+#include <Kube/Core/SortedVector.hpp>
+
+using namespace kF;
+
+static_assert(Core::DoublingGrowthPolicy::InitialCapacity<int, std::size_t>() == 2);
+static_assert(Core::DoublingGrowthPolicy::NextCapacity<int, std::size_t>(4, 0) == 8);
+static_assert(Core::DoublingGrowthPolicy::NextCapacity<int, std::size_t>(4, 10) == 14);
+static_assert(Core::DoublingGrowthPolicy::NextCapacity<int, std::size_t>(0, 0) == 1);
+static_assert(Core::OneAndHalfGrowthPolicy::NextCapacity<int, std::size_t>(2, 0) == 3);
+static_assert(Core::OneAndHalfGrowthPolicy::NextCapacity<int, std::size_t>(8, 0) == 12);
+static_assert(Core::OneAndHalfGrowthPolicy::NextCapacity<int, std::size_t>(8, 10) == 18);
+static_assert(Core::SizeClassGrowthPolicy<>::InitialCapacity<int, std::size_t>() == 16);
+static_assert(Core::SizeClassGrowthPolicy<>::NextCapacity<int, std::size_t>(16, 20) == 64);
+static_assert(Core::SizeClassGrowthPolicy<64, Core::OneAndHalfGrowthPolicy>::NextCapacity<char[24], std::size_t>(4, 0) == 10);
+static_assert(Core::PageGrowthPolicy<>::InitialCapacity<std::size_t, std::uint32_t>() == 512);
+static_assert(Core::PageGrowthPolicy<>::NextCapacity<std::size_t, std::uint32_t>(512, 1) == 1024);
+static_assert(Core::PageGrowthPolicy<>::InitialCapacity<char[5000], std::uint32_t>() == 1);
+
+template<typename Container>
+static void CheckGrowth(Container &container, const std::size_t count, std::initializer_list<std::size_t> capacities)
+{
+    auto capacity = capacities.begin();
+
+    for (auto i = 0ul; i < count; ++i) {
+        container.push(i);
+        if (container.capacity() != *capacity) {
+            ASSERT_EQ(container.capacity(), *++capacity);
+        }
+    }
+    ASSERT_EQ(++capacity, capacities.end());
+    for (auto i = 0ul; i < count; ++i)
+        ASSERT_EQ(container[i], i);
+}
+
+TEST(GrowthPolicy, Vector)
+{
+    Core::Vector<std::size_t> doubling;
+    CheckGrowth(doubling, 20, { 2, 4, 8, 16, 32 });
+
+    Core::Vector<std::size_t, std::size_t, Core::OneAndHalfGrowthPolicy> oneAndHalf;
+    CheckGrowth(oneAndHalf, 20, { 2, 3, 4, 6, 9, 13, 19, 28 });
+
+    Core::TinyVector<std::size_t, Core::SizeClassGrowthPolicy<128>> sizeClass;
+    CheckGrowth(sizeClass, 40, { 16, 32, 64 });
+
+    Core::FlatVector<std::size_t, std::size_t, Core::Internal::NoCustomHeaderType, Core::PageGrowthPolicy<>> page;
+    CheckGrowth(page, 1000, { 512, 1024 });
+}
+
+TEST(GrowthPolicy, SmallAndSortedVectors)
+{
+    Core::SmallVector<std::size_t, 4, std::size_t, Core::OneAndHalfGrowthPolicy> small;
+    CheckGrowth(small, 10, { 2, 3, 4, 6, 9, 13 });
+
+    Core::SortedVector<std::size_t, std::size_t, std::less<std::size_t>, Core::SizeClassGrowthPolicy<>> sorted;
+    CheckGrowth(sorted, 10, { 8, 16 });
+
+    // Inserting more than the policy growth still reserves enough room
+    Core::Vector<std::size_t, std::size_t, Core::OneAndHalfGrowthPolicy> vector(4ul, 0ul);
+    vector.insertDefault(vector.begin(), 100);
+    ASSERT_EQ(vector.capacity(), 104);
+    ASSERT_EQ(vector.size(), 104);
+}
@@ -54,4 +54,90 @@ TEST(HeapArray, Semantics)
         ++i;
     }
     ASSERT_EQ(i, count);
-}
\ No newline at end of file
+}
+
+TEST(HeapArray, Resize)
+{
+    Core::HeapArray<std::string> array(4, "4");
+
+    array.allocate(4, "0");
+    ASSERT_EQ(array.size(), 4);
+    ASSERT_EQ(array[3], "0");
+    array.allocate(0);
+    ASSERT_FALSE(array);
+    ASSERT_EQ(array.data(), nullptr);
+}
+
+template<typename AllocationPolicy>
+static void TestAllocationPolicy(void)
+{
+    constexpr auto count = 3ul * 1024 * 1024;
+
+    Core::HeapArray<std::size_t, AllocationPolicy> array(count, 42ul);
+    ASSERT_TRUE(array);
+    ASSERT_EQ(reinterpret_cast<std::uintptr_t>(array.data()) % alignof(std::size_t), 0);
+    for (auto i = 0ul; i < count; ++i)
+        array[i] += i;
+    for (auto i = 0ul; i < count; ++i)
+        ASSERT_EQ(array[i], 42ul + i);
+    array.allocate(count / 2, 0ul);
+    ASSERT_EQ(array.size(), count / 2);
+    ASSERT_EQ(array[count / 2 - 1], 0ul);
+    array.release();
+    ASSERT_FALSE(array);
+
+    Core::HeapArray<std::string, AllocationPolicy> strings(3, "Mapped string that is not small optimized");
+    ASSERT_EQ(strings[2], "Mapped string that is not small optimized");
+}
+
+TEST(HeapArray, AllocationPolicies)
+{
+    TestAllocationPolicy<Core::DefaultAllocationPolicy>();
+    TestAllocationPolicy<Core::MappedAllocationPolicy<Core::HugePageMode::None>>();
+    TestAllocationPolicy<Core::TransparentHugePageAllocationPolicy>();
+    TestAllocationPolicy<Core::HugePageAllocationPolicy>();
+    TestAllocationPolicy<Core::NumaInterleaveAllocationPolicy>();
+    TestAllocationPolicy<Core::NumaNodeAllocationPolicy<0>>();
+}
+
+TEST(HeapArray, AllocateParallel)
+{
+    constexpr auto count = 100'000ul;
+    constexpr auto str = "First touched string that is not small optimized";
+
+    Core::HeapArray<std::string, Core::TransparentHugePageAllocationPolicy> array;
+    for (const auto threadCount : { 0ul, 1ul, 3ul, 8ul }) {
+        array.allocateParallel(count + threadCount, threadCount, str);
+        ASSERT_EQ(array.size(), count + threadCount);
+        for (const auto &elem : array)
+            ASSERT_EQ(elem, str);
+    }
+    array.allocateParallel(3, 8, "small");
+    ASSERT_EQ(array.size(), 3);
+    ASSERT_EQ(array[2], "small");
+}
+
+TEST(HeapArray, ReleaseParallel)
+{
+    Core::HeapArray<std::string> array;
+
+    array.releaseParallel(4);
+    array.allocateParallel(100'000, 4, "Parallel string that is not small optimized");
+    array.releaseParallel(4);
+    ASSERT_FALSE(array);
+    ASSERT_EQ(array.data(), nullptr);
+}
+
+TEST(HeapArray, Aligned)
+{
+    Core::AlignedHeapArray<float, 32> array(13, 1.0f);
+
+    ASSERT_EQ(reinterpret_cast<std::uintptr_t>(array.data()) % 32, 0);
+    for (const auto value : array)
+        ASSERT_EQ(value, 1.0f);
+    for (auto i = 13ul; i < 16ul; ++i)
+        ASSERT_EQ(array.data()[i], 0.0f);
+    array.allocate(1000, 2.0f);
+    ASSERT_EQ(reinterpret_cast<std::uintptr_t>(array.data()) % 32, 0);
+    ASSERT_EQ(array[999], 2.0f);
+}
@@ -0,0 +1,164 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: PackedVector and BitVector unit tests
+ */
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include <Kube/Core/BitVector.hpp>
+
+using namespace kF;
+
+TEST(BitVector, Basics)
+{
+    Core::BitVector<> bits;
+
+    ASSERT_TRUE(bits.empty());
+    ASSERT_EQ(bits.count(), 0);
+    ASSERT_EQ(bits.findFirstSet(), 0);
+    for (auto i = 0u; i < 200u; ++i)
+        bits.push(i % 3 == 0);
+    ASSERT_EQ(bits.size(), 200);
+    ASSERT_EQ(bits.wordCount(), 4);
+    ASSERT_GE(bits.capacity(), 200);
+    for (auto i = 0u; i < 200u; ++i)
+        ASSERT_EQ(bits[i], i % 3 == 0);
+    ASSERT_EQ(bits.count(), 67);
+    bits.set(1, true);
+    ASSERT_TRUE(bits.at(1));
+    bits.set(0, false);
+    ASSERT_FALSE(bits.front());
+    ASSERT_EQ(bits.count(), 67);
+    while (bits.size() > 64) {
+        bits.pop();
+        ASSERT_EQ(bits.wordCount(), (bits.size() + 63) / 64);
+    }
+    ASSERT_EQ(bits.count(), 22);
+    ASSERT_EQ(bits.wordData()[0] >> 63, 1);
+}
+
+TEST(BitVector, Find)
+{
+    Core::BitVector<> bits(300);
+
+    ASSERT_TRUE(bits.none());
+    ASSERT_EQ(bits.findFirstSet(), 300);
+    ASSERT_EQ(bits.findFirstUnset(), 0);
+    bits.set(5, true);
+    bits.set(64, true);
+    bits.set(299, true);
+    ASSERT_TRUE(bits.any());
+    ASSERT_EQ(bits.findFirstSet(), 5);
+    ASSERT_EQ(bits.findFirstSet(6), 64);
+    ASSERT_EQ(bits.findFirstSet(65), 299);
+    ASSERT_EQ(bits.findFirstSet(300), 300);
+
+    std::vector<std::size_t> found;
+    bits.forEachSet([&found](const std::size_t index) { found.push_back(index); });
+    ASSERT_EQ(found, (std::vector<std::size_t> { 5, 64, 299 }));
+
+    bits.setRange(0, 300);
+    ASSERT_TRUE(bits.all());
+    ASSERT_EQ(bits.count(), 300);
+    ASSERT_EQ(bits.findFirstUnset(), 300);
+    bits.clearRange(70, 250);
+    ASSERT_EQ(bits.count(), 120);
+    ASSERT_EQ(bits.findFirstUnset(), 70);
+    ASSERT_EQ(bits.findFirstSet(70), 250);
+    bits.clearRange(3, 4);
+    ASSERT_EQ(bits.findFirstUnset(), 3);
+    ASSERT_EQ(bits.findFirstUnset(4), 70);
+}
+
+TEST(BitVector, Bitwise)
+{
+    Core::TinyBitVector<> a(130), b(130);
+
+    a.setRange(0, 100);
+    b.setRange(50, 130);
+    auto andBits = a;
+    andBits &= b;
+    ASSERT_EQ(andBits.count(), 50);
+    ASSERT_EQ(andBits.findFirstSet(), 50);
+    auto orBits = a;
+    orBits |= b;
+    ASSERT_TRUE(orBits.all());
+    auto xorBits = a;
+    xorBits ^= b;
+    ASSERT_EQ(xorBits.count(), 80);
+    ASSERT_EQ(xorBits.findFirstUnset(), 50);
+    ASSERT_EQ(xorBits.findFirstSet(50), 100);
+    ASSERT_NE(xorBits, orBits);
+    xorBits ^= a;
+    ASSERT_EQ(xorBits, b);
+}
+
+TEST(BitVector, Resize)
+{
+    Core::BitVector<> bits { true, false, true };
+
+    bits.resize(100, true);
+    ASSERT_EQ(bits.size(), 100);
+    ASSERT_EQ(bits.count(), 99);
+    ASSERT_FALSE(bits[1]);
+    bits.resize(65);
+    ASSERT_EQ(bits.count(), 64);
+    ASSERT_EQ(bits.wordData()[1], 1);
+    bits.resize(2);
+    ASSERT_EQ(bits.wordCount(), 1);
+    ASSERT_EQ(bits.wordData()[0], 1);
+    bits.resize(0);
+    ASSERT_EQ(bits.wordCount(), 0);
+    bits.release();
+    ASSERT_EQ(bits.capacity(), 0);
+}
+
+template<std::size_t Bits>
+static void TestPackedVector(void)
+{
+    using Vector = Core::PackedVector<Bits>;
+    constexpr auto Mask = Vector::ElementMask;
+    constexpr auto count = 1000ul;
+
+    Vector vector;
+    for (auto i = 0ul; i < count; ++i)
+        vector.push(static_cast<typename Vector::Value>(i * 7 & Mask));
+    ASSERT_EQ(vector.size(), count);
+    ASSERT_EQ(vector.wordCount(), (count + Vector::ElementsPerWord - 1) / Vector::ElementsPerWord);
+    for (auto i = 0ul; i < count; ++i)
+        ASSERT_EQ(vector[i], i * 7 & Mask);
+    vector.set(10, static_cast<typename Vector::Value>(Mask));
+    ASSERT_EQ(vector[10], Mask);
+    ASSERT_EQ(vector[9], 9 * 7 & Mask);
+    ASSERT_EQ(vector[11], 11 * 7 & Mask);
+    vector.pop();
+    ASSERT_EQ(vector.back(), (count - 2) * 7 & Mask);
+
+    Vector filled(count, static_cast<typename Vector::Value>(Mask));
+    for (auto i = 0ul; i < count; ++i)
+        ASSERT_EQ(filled[i], Mask);
+    filled.resize(count * 2, 1);
+    ASSERT_EQ(filled[count - 1], Mask);
+    ASSERT_EQ(filled[count], 1);
+    ASSERT_EQ(filled.back(), 1);
+    filled.resize(count / 2);
+    filled.resize(count, 0);
+    ASSERT_EQ(filled[count / 2 - 1], Mask);
+    ASSERT_EQ(filled[count / 2], 0);
+    ASSERT_EQ(filled.back(), 0);
+}
+
+TEST(PackedVector, Bits)
+{
+    TestPackedVector<2>();
+    TestPackedVector<3>();
+    TestPackedVector<4>();
+    TestPackedVector<5>();
+    TestPackedVector<8>();
+    TestPackedVector<12>();
+    TestPackedVector<32>();
+    static_assert(Core::PackedVector<3>::ElementsPerWord == 21);
+    static_assert(std::is_same_v<Core::PackedVector<12>::Value, std::uint16_t>);
+}
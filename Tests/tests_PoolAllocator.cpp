@@ -0,0 +1,148 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Tests of the size-class pool allocator
+ */
+
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <Kube/Core/PoolAllocator.hpp>
+#include <Kube/Core/AllocatedSmallVector.hpp>
+#include <Kube/Core/AllocatedSmallString.hpp>
+
+using namespace kF;
+
+TEST(PoolAllocator, SizeClasses)
+{
+    using Pool = Core::PoolAllocator;
+
+    ASSERT_EQ(Pool::SizeClassOf(0, 1), 0);
+    ASSERT_EQ(Pool::SizeClassOf(1, 1), 0);
+    ASSERT_EQ(Pool::BlockSizeOf(Pool::SizeClassOf(9, 1)), 16);
+    ASSERT_EQ(Pool::BlockSizeOf(Pool::SizeClassOf(16, 1)), 16);
+    ASSERT_EQ(Pool::BlockSizeOf(Pool::SizeClassOf(8, 64)), 64);
+    ASSERT_EQ(Pool::BlockSizeOf(Pool::SizeClassOf(Pool::MaxBlockSize, 8)), Pool::MaxBlockSize);
+    ASSERT_EQ(Pool::SizeClassOf(Pool::MaxBlockSize + 1, 8), Pool::NoSizeClass);
+    ASSERT_EQ(Pool::SizeClassOf(8, Pool::MaxBlockSize * 2), Pool::NoSizeClass);
+}
+
+TEST(PoolAllocator, Basics)
+{
+    using Pool = Core::PoolAllocator;
+    constexpr auto count = 10000ul;
+
+    std::vector<void *> ptrs;
+    for (auto i = 0ul; i < count; ++i) {
+        const auto size = 1ul + i % 300;
+        const auto alignment = 1ul << (i % 7);
+        auto ptr = Pool::Allocate(size, alignment);
+        ASSERT_NE(ptr, nullptr);
+        ASSERT_EQ(reinterpret_cast<std::uintptr_t>(ptr) % alignment, 0);
+        std::memset(ptr, static_cast<int>(i), size);
+        ptrs.push_back(ptr);
+    }
+    for (auto i = 0ul; i < count; ++i)
+        ASSERT_EQ(*reinterpret_cast<unsigned char *>(ptrs[i]), static_cast<unsigned char>(i));
+    for (auto i = 0ul; i < count; ++i)
+        Pool::Deallocate(ptrs[i], 1ul + i % 300, 1ul << (i % 7));
+
+    // Last released block is reused first
+    auto a = Pool::Allocate(24, 8);
+    Pool::Deallocate(a, 24, 8);
+    ASSERT_EQ(Pool::Allocate(24, 8), a);
+    Pool::Deallocate(a, 24, 8);
+
+    // Large allocations are not pooled
+    auto large = Pool::Allocate(Pool::MaxBlockSize * 4, 64);
+    ASSERT_NE(large, nullptr);
+    ASSERT_EQ(reinterpret_cast<std::uintptr_t>(large) % 64, 0);
+    Pool::Deallocate(large, Pool::MaxBlockSize * 4, 64);
+}
+
+TEST(PoolAllocator, CrossThreadDeallocation)
+{
+    using Pool = Core::PoolAllocator;
+    constexpr auto count = 4096ul;
+
+    std::vector<void *> ptrs(count);
+    std::thread producer([&ptrs] {
+        for (auto &ptr : ptrs)
+            ptr = Pool::Allocate(32, 8);
+    });
+    producer.join();
+    std::thread consumer([&ptrs] {
+        for (auto ptr : ptrs)
+            Pool::Deallocate(ptr, 32, 8);
+    });
+    consumer.join();
+
+    // The cache of the terminated producer is adopted and its remote blocks are recycled
+    std::thread adopter([&ptrs] {
+        for (auto i = 0ul; i < ptrs.size(); ++i) {
+            auto ptr = Pool::Allocate(32, 8);
+            ASSERT_NE(ptr, nullptr);
+            ptrs[i] = ptr;
+        }
+        for (auto ptr : ptrs)
+            Pool::Deallocate(ptr, 32, 8);
+    });
+    adopter.join();
+}
+
+TEST(PoolAllocator, ThreadLocalTeardown)
+{
+    using Pool = Core::PoolAllocator;
+    using Vector = Core::AllocatedTinySmallVector<std::size_t, 4, &Pool::Allocate, &Pool::Deallocate>;
+
+    /** @brief Thread local container constructed before the thread cache, so it is destroyed after it */
+    struct Holder
+    {
+        Vector vector;
+        void *block { nullptr };
+
+        ~Holder(void)
+        {
+            Pool::Deallocate(block, 48, 8);
+            vector.clear();
+            for (auto i = 0ul; i < 100; ++i)
+                vector.push(i);
+        }
+    };
+
+    for (auto round = 0; round < 4; ++round) {
+        std::thread owner([] {
+            static thread_local Holder holder;
+            for (auto i = 0ul; i < 100; ++i)
+                holder.vector.push(i);
+            holder.block = Pool::Allocate(48, 8);
+        });
+        // Adopters race with the teardown of the owner, its late frees must only touch remote lists
+        std::thread adopter([] {
+            std::vector<void *> ptrs(1024);
+            for (auto &ptr : ptrs)
+                ptr = Pool::Allocate(48, 8);
+            for (auto ptr : ptrs)
+                Pool::Deallocate(ptr, 48, 8);
+        });
+        owner.join();
+        adopter.join();
+    }
+}
+
+TEST(PoolAllocator, Containers)
+{
+    constexpr auto count = 100ul;
+    constexpr auto str = "Hello pool allocated world, too long for the small cache";
+
+    Core::AllocatedTinySmallVector<std::size_t, 4, &Core::PoolAllocator::Allocate, &Core::PoolAllocator::Deallocate> vector;
+    for (auto i = 0ul; i < count; ++i)
+        vector.push(i);
+    for (auto i = 0ul; i < count; ++i)
+        ASSERT_EQ(vector[i], i);
+
+    Core::AllocatedTinySmallString<&Core::PoolAllocator::Allocate, &Core::PoolAllocator::Deallocate> string(str);
+    ASSERT_FALSE(string.isCacheUsed());
+    ASSERT_EQ(string, str);
+}
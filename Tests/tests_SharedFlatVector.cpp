@@ -0,0 +1,121 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: SharedFlatVector unit tests
+ */
+
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include <Kube/Core/SharedFlatVector.hpp>
+#include <Kube/Core/SharedFlatString.hpp>
+
+using namespace kF;
+
+TEST(SharedFlatVector, Basics)
+{
+    Core::SharedFlatVector<int> empty;
+    ASSERT_FALSE(empty);
+    ASSERT_EQ(empty.useCount(), 0);
+    ASSERT_EQ(empty.begin(), empty.end());
+
+    Core::SharedFlatVector<int> vector { 1, 2, 3 };
+    ASSERT_EQ(vector.size(), 3);
+    ASSERT_TRUE(vector.isUnique());
+    ASSERT_EQ(vector, (Core::FlatVector<int> { 1, 2, 3 }));
+    ASSERT_EQ(vector.front(), 1);
+    ASSERT_EQ(vector.back(), 3);
+    ASSERT_EQ(*vector.rbegin(), 3);
+
+    empty = vector;
+    ASSERT_EQ(empty, vector);
+    ASSERT_EQ(vector.useCount(), 2);
+    empty.release();
+    ASSERT_FALSE(empty);
+    ASSERT_TRUE(vector.isUnique());
+}
+
+TEST(SharedFlatVector, CopyOnWrite)
+{
+    Core::SharedFlatVector<std::string> vector { "0", "1", "2", "3" };
+    const auto data = vector.data();
+
+    {
+        auto copy = vector;
+        auto copy2 = copy;
+        ASSERT_EQ(copy.data(), data);
+        ASSERT_EQ(copy2.data(), data);
+        ASSERT_EQ(vector.useCount(), 3);
+
+        // Editing a unique buffer doesn't clone it
+        copy2.edit().push("4");
+        ASSERT_NE(copy2.data(), data);
+        ASSERT_TRUE(copy2.isUnique());
+        ASSERT_EQ(vector.useCount(), 2);
+        const auto data2 = copy2.data();
+        copy2.edit()[0] = "-";
+        ASSERT_EQ(copy2.data(), data2);
+        ASSERT_EQ(copy2.size(), 5);
+        ASSERT_EQ(copy2[0], "-");
+        ASSERT_EQ(vector[0], "0");
+
+        copy = std::move(copy2);
+        ASSERT_TRUE(vector.isUnique());
+        ASSERT_FALSE(copy2);
+        ASSERT_EQ(copy.size(), 5);
+    }
+    ASSERT_TRUE(vector.isUnique());
+    vector.edit().erase(vector.edit().begin());
+    ASSERT_EQ(vector.data(), data);
+    ASSERT_EQ(vector, (Core::FlatVector<std::string> { "1", "2", "3" }));
+}
+
+TEST(SharedFlatVector, Adopt)
+{
+    Core::FlatVector<int, std::size_t, Core::Internal::SharedFlatHeader> flat { 4, 5 };
+    const auto data = flat.data();
+    Core::SharedFlatVector<int> vector(std::move(flat));
+
+    ASSERT_FALSE(flat);
+    ASSERT_EQ(vector.data(), data);
+    ASSERT_TRUE(vector.isUnique());
+    vector.edit().push(6);
+    ASSERT_EQ(vector, (Core::FlatVector<int> { 4, 5, 6 }));
+}
+
+TEST(SharedFlatVector, Threads)
+{
+    constexpr auto ThreadCount = 4;
+    constexpr auto CopyCount = 10000;
+
+    Core::SharedFlatVector<std::size_t> vector(1000ul, 42ul);
+    std::vector<std::thread> threads;
+    for (auto i = 0; i < ThreadCount; ++i) {
+        threads.emplace_back([&vector] {
+            for (auto j = 0; j < CopyCount; ++j) {
+                auto copy = vector;
+                if (j % 100 == 0)
+                    copy.edit().push(0ul);
+            }
+        });
+    }
+    for (auto &thread : threads)
+        thread.join();
+    ASSERT_TRUE(vector.isUnique());
+    ASSERT_EQ(vector.size(), 1000);
+}
+
+TEST(SharedFlatString, Basics)
+{
+    Core::SharedFlatString str("Hello world");
+    const auto copy = str;
+
+    ASSERT_EQ(copy.data(), str.data());
+    ASSERT_EQ(copy, std::string_view("Hello world"));
+    ASSERT_EQ(copy.toStdView(), "Hello world");
+    str.edit() += " !";
+    ASSERT_EQ(str.toStdView(), "Hello world !");
+    ASSERT_EQ(copy.toStdView(), "Hello world");
+    ASSERT_TRUE(str.isUnique());
+    ASSERT_TRUE(copy.isUnique());
+}
@@ -0,0 +1,156 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: SoAVector and SoAHeapArray unit tests
+ */
+
+#include <gtest/gtest.h>
+
+#include <string>
+
+#include <Kube/Core/SoAVector.hpp>
+#include <Kube/Core/SoAHeapArray.hpp>
+
+using namespace kF;
+
+using Particles = Core::SoAVector<float, double, std::string>;
+
+template<typename Container>
+static void AssertColumnsAligned(const Container &container)
+{
+    constexpr auto Alignment = Container::Layout::Alignment;
+
+    ASSERT_EQ(reinterpret_cast<std::uintptr_t>(container.template data<0>()) % Alignment, 0);
+    ASSERT_EQ(reinterpret_cast<std::uintptr_t>(container.template data<1>()) % Alignment, 0);
+    ASSERT_EQ(reinterpret_cast<std::uintptr_t>(container.template data<2>()) % Alignment, 0);
+}
+
+TEST(SoAVector, Basics)
+{
+    Particles particles;
+
+    ASSERT_TRUE(particles.empty());
+    ASSERT_EQ(particles.capacity(), 0);
+    ASSERT_EQ(particles.data<0>(), nullptr);
+    ASSERT_TRUE(particles.column<2>().empty());
+}
+
+TEST(SoAVector, Push)
+{
+    constexpr auto count = 100ul;
+    Particles particles;
+
+    for (auto i = 0ul; i < count; ++i) {
+        auto [x, y, name] = particles.push(static_cast<float>(i), i * 2.0, std::to_string(i));
+        ASSERT_EQ(x, static_cast<float>(i));
+        ASSERT_EQ(y, i * 2.0);
+        ASSERT_EQ(name, std::to_string(i));
+    }
+    ASSERT_EQ(particles.size(), count);
+    ASSERT_GE(particles.capacity(), count);
+    AssertColumnsAligned(particles);
+    for (auto i = 0ul; i < count; ++i) {
+        ASSERT_EQ(particles.get<0>(i), static_cast<float>(i));
+        ASSERT_EQ(particles.get<1>(i), i * 2.0);
+        ASSERT_EQ(particles.get<2>(i), std::to_string(i));
+    }
+    ASSERT_EQ(std::get<2>(particles.front()), "0");
+    ASSERT_EQ(std::get<2>(particles.back()), std::to_string(count - 1));
+    particles.pop();
+    ASSERT_EQ(particles.size(), count - 1);
+    ASSERT_EQ(std::get<2>(particles.back()), std::to_string(count - 2));
+}
+
+TEST(SoAVector, Columns)
+{
+    Particles particles(8);
+
+    auto [x, y] = particles.columns<0, 1>();
+    ASSERT_EQ(x.size(), 8);
+    ASSERT_EQ(y.size(), 8);
+    for (auto i = 0ul; i < x.size(); ++i) {
+        ASSERT_EQ(x[i], 0.0f);
+        x[i] = static_cast<float>(i);
+        y[i] = x[i] * 2.0;
+    }
+    std::get<1>(particles[3]) = 42.0;
+    const auto &constParticles = particles;
+    const auto column = constParticles.column<1>();
+    ASSERT_EQ(column[2], 4.0);
+    ASSERT_EQ(column[3], 42.0);
+    ASSERT_EQ(std::get<0>(constParticles.at(7)), 7.0f);
+}
+
+TEST(SoAVector, Erase)
+{
+    Particles particles;
+
+    for (auto i = 0; i < 10; ++i)
+        particles.push(static_cast<float>(i), static_cast<double>(i), std::to_string(i));
+    particles.erase(0);
+    particles.erase(2, 5);
+    ASSERT_EQ(particles.size(), 6);
+    const std::string expected[] = { "1", "2", "6", "7", "8", "9" };
+    for (auto i = 0ul; i < particles.size(); ++i) {
+        ASSERT_EQ(particles.get<2>(i), expected[i]);
+        ASSERT_EQ(particles.get<0>(i), std::stof(expected[i]));
+        ASSERT_EQ(particles.get<1>(i), std::stod(expected[i]));
+    }
+    particles.eraseUnordered(1);
+    ASSERT_EQ(particles.size(), 5);
+    ASSERT_EQ(particles.at(1), std::make_tuple(9.0f, 9.0, "9"));
+    particles.eraseUnordered(4);
+    ASSERT_EQ(particles.size(), 4);
+    ASSERT_EQ(particles.back(), std::make_tuple(7.0f, 7.0, "7"));
+}
+
+TEST(SoAVector, Semantics)
+{
+    Particles particles;
+    for (auto i = 0; i < 5; ++i)
+        particles.push(static_cast<float>(i), static_cast<double>(i), std::to_string(i));
+
+    Particles copy(particles);
+    ASSERT_EQ(copy.size(), particles.size());
+    AssertColumnsAligned(copy);
+    for (auto i = 0ul; i < copy.size(); ++i)
+        ASSERT_EQ(copy.at(i), particles.at(i));
+    Particles moved(std::move(copy));
+    ASSERT_TRUE(copy.empty());
+    ASSERT_EQ(moved.size(), 5);
+    copy = moved;
+    ASSERT_EQ(copy.get<2>(4), "4");
+    moved = std::move(particles);
+    ASSERT_EQ(moved.get<2>(4), "4");
+    copy.swap(moved);
+    copy.clear();
+    ASSERT_TRUE(copy.empty());
+    ASSERT_NE(copy.capacity(), 0);
+    copy.release();
+    ASSERT_EQ(copy.capacity(), 0);
+    ASSERT_FALSE(copy.reserve(0));
+    ASSERT_TRUE(copy.reserve(10));
+    ASSERT_EQ(copy.capacity(), 10);
+}
+
+TEST(SoAHeapArray, Basics)
+{
+    Core::SoAHeapArray<int, std::string> array(42);
+
+    ASSERT_EQ(array.size(), 42);
+    ASSERT_EQ(reinterpret_cast<std::uintptr_t>(array.data<1>()) % decltype(array)::Layout::Alignment, 0);
+    auto [ids, names] = array.columns<0, 1>();
+    for (auto i = 0ul; i < array.size(); ++i) {
+        ASSERT_EQ(ids[i], 0);
+        ASSERT_TRUE(names[i].empty());
+        ids[i] = static_cast<int>(i);
+        names[i] = std::to_string(i);
+    }
+    ASSERT_EQ(array.at(41), std::make_tuple(41, "41"));
+    array.allocate(42);
+    ASSERT_EQ(array.get<0>(41), 0);
+    Core::SoAHeapArray<int, std::string> other(std::move(array));
+    ASSERT_FALSE(array);
+    ASSERT_EQ(other.size(), 42);
+    other.allocate(0);
+    ASSERT_FALSE(other);
+}
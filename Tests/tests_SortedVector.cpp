@@ -6,6 +6,8 @@
 #include <gtest/gtest.h>
 
 #include <string>
+#include <string_view>
+#include <limits>
 #include <memory_resource>
 
 #include <Kube/Core/SortedVector.hpp>
@@ -14,6 +16,7 @@
 #include <Kube/Core/SortedAllocatedFlatVector.hpp>
 #include <Kube/Core/SortedSmallVector.hpp>
 #include <Kube/Core/SortedAllocatedSmallVector.hpp>
+#include <Kube/Core/Vector.hpp>
 
 #define GENERATE_VECTOR_TESTS(Vector, ...) \
 TEST(Vector, Basics) \
@@ -170,6 +173,76 @@ TEST(Vector, NullArgs) \
     ASSERT_EQ(f.size(), 0ul); ASSERT_TRUE(f.empty()); \
     ASSERT_EQ(g.size(), 0ul); ASSERT_TRUE(g.empty()); \
     ASSERT_EQ(h.size(), 0ul); ASSERT_TRUE(h.empty()); \
+} \
+ \
+TEST(Vector, PushN) \
+{ \
+    constexpr auto count = 100ul; \
+    Vector<std::size_t __VA_OPT__(,) __VA_ARGS__> vector; \
+    const unsigned int values[] = { 7, 1, 12 }; \
+ \
+    vector.pushN(0ul, [](const auto) { return 0ul; }); \
+    ASSERT_TRUE(vector.empty()); \
+    vector.pushN(count, [](const auto i) { return (i * 37) % count; }); \
+    vector.pushN(count, [](const auto i) { return count - i - 1; }); \
+    vector.emplaceRange(std::begin(values), std::end(values)); \
+    ASSERT_EQ(vector.size(), count * 2 + 3); \
+    ASSERT_TRUE(std::is_sorted(vector.begin(), vector.end())); \
+    ASSERT_EQ(std::count(vector.begin(), vector.end(), 1ul), 3); \
+    ASSERT_EQ(std::count(vector.begin(), vector.end(), 99ul), 2); \
+} \
+ \
+TEST(Vector, InsertMerge) \
+{ \
+    constexpr auto count = 100ul; \
+    Vector<std::size_t __VA_OPT__(,) __VA_ARGS__> vector; \
+    const std::size_t unsorted[] = { 150, 3, 42, 0, 99 }; \
+    const std::size_t sorted[] = { 1, 1, 50, 200 }; \
+ \
+    vector.insertSorted(std::begin(sorted), std::end(sorted)); \
+    ASSERT_EQ(vector.size(), 4); \
+    vector.pushN(count, [](const auto i) { return i * 2; }); \
+    vector.insert(std::begin(unsorted), std::end(unsorted)); \
+    ASSERT_TRUE(std::is_sorted(vector.begin(), vector.end())); \
+    vector.insertSorted(std::begin(sorted), std::end(sorted)); \
+    ASSERT_EQ(vector.size(), count + 13); \
+    ASSERT_TRUE(std::is_sorted(vector.begin(), vector.end())); \
+    ASSERT_EQ(std::count(vector.begin(), vector.end(), 1ul), 4); \
+    ASSERT_EQ(std::count(vector.begin(), vector.end(), 42ul), 2); \
+    ASSERT_EQ(vector.front(), 0); \
+    ASSERT_EQ(vector.back(), 200); \
+} \
+ \
+TEST(Vector, Freeze) \
+{ \
+    constexpr auto count = 100ul; \
+    Vector<std::size_t __VA_OPT__(,) __VA_ARGS__> vector; \
+ \
+    ASSERT_EQ(vector.freeze().lowerBound(42ul), 0); \
+    vector.pushN(count, [](const auto i) { return (i / 2) * 2; }); \
+    const auto index = vector.freeze(); \
+    ASSERT_EQ(index.size(), count); \
+    for (auto i = 0ul; i <= count; ++i) { \
+        const auto lower = std::lower_bound(vector.begin(), vector.end(), i) - vector.begin(); \
+        const auto upper = std::upper_bound(vector.begin(), vector.end(), i) - vector.begin(); \
+        ASSERT_EQ(index.lowerBound(i), lower); \
+        ASSERT_EQ(index.upperBound(i), upper); \
+        ASSERT_EQ(index.contains(i), i % 2 == 0 && i < count); \
+        ASSERT_EQ(index.find(i), index.contains(i) ? lower : count); \
+    } \
+} \
+ \
+TEST(Vector, EraseIf) \
+{ \
+    constexpr auto count = 100ul; \
+    Vector<std::size_t __VA_OPT__(,) __VA_ARGS__> vector; \
+ \
+    vector.pushN(count, [](const auto i) { return count - i - 1; }); \
+    ASSERT_EQ(vector.eraseIf([](const auto x) { return x % 3 == 0; }), 34); \
+    ASSERT_EQ(vector.size(), count - 34); \
+    ASSERT_TRUE(std::is_sorted(vector.begin(), vector.end())); \
+    ASSERT_EQ(vector.front(), 1); \
+    ASSERT_EQ(vector.back(), 98); \
 }
 
 using namespace kF::Core;
@@ -192,3 +265,73 @@ GENERATE_VECTOR_TESTS(SortedFlatVector)
 GENERATE_VECTOR_TESTS(SortedAllocatedFlatVector, &DefaultAlloc, &DefaultDealloc)
 GENERATE_VECTOR_TESTS(SortedSmallVector, 4)
 GENERATE_VECTOR_TESTS(SortedAllocatedSmallVector, 4, &DefaultAlloc, &DefaultDealloc)
+
+TEST(EytzingerIndex, Sizes)
+{
+    for (auto count = 0ul; count < 70ul; ++count) {
+        Vector<std::uint32_t> values;
+        values.pushN(count, [](const auto i) { return static_cast<std::uint32_t>(i * 3); });
+        const EytzingerIndex<std::uint32_t> index(values.begin(), values.end());
+        ASSERT_EQ(index.size(), count);
+        for (auto i = 0u; i < count * 3 + 2; ++i) {
+            const auto lower = std::lower_bound(values.begin(), values.end(), i) - values.begin();
+            ASSERT_EQ(index.lowerBound(i), lower);
+            ASSERT_EQ(index.find(i), i % 3 == 0 && i < count * 3 ? lower : count);
+        }
+    }
+}
+
+TEST(EytzingerIndex, CustomCompare)
+{
+    const std::string values[] = { "d", "c", "b", "a" };
+    const EytzingerIndex<std::string, std::uint32_t, std::greater<>> index(std::begin(values), std::end(values));
+
+    ASSERT_EQ(index.find("c"), 1u);
+    ASSERT_EQ(index.lowerBound(std::string_view("bb")), 2u);
+    ASSERT_EQ(index.upperBound("a"), 4u);
+    ASSERT_FALSE(index.contains("e"));
+}
+
+template<typename Type>
+static void TestSimdSearch(void)
+{
+    for (auto count = 0ul; count < 300ul; count += 7ul) {
+        Vector<Type> values;
+        values.pushN(count, [count](const auto i) { return static_cast<Type>(static_cast<Type>(i / 2) - static_cast<Type>(count / 4)); });
+        if constexpr (std::is_unsigned_v<Type>)
+            std::sort(values.begin(), values.end());
+        for (const auto value : values) {
+            for (const auto offset : { Type(0), Type(1) }) {
+                const auto key = static_cast<Type>(value + offset);
+                ASSERT_EQ(Utils::SimdLowerBound(values.begin(), values.end(), key), std::lower_bound(values.begin(), values.end(), key));
+                ASSERT_EQ(Utils::SimdUpperBound(values.begin(), values.end(), key), std::upper_bound(values.begin(), values.end(), key));
+            }
+        }
+        ASSERT_EQ(Utils::SimdLowerBound(values.begin(), values.end(), std::numeric_limits<Type>::lowest()), values.begin());
+        ASSERT_EQ(Utils::SimdUpperBound(values.begin(), values.end(), std::numeric_limits<Type>::max()), values.end());
+    }
+}
+
+TEST(SimdSearch, Bounds)
+{
+    TestSimdSearch<std::int32_t>();
+    TestSimdSearch<std::uint32_t>();
+    TestSimdSearch<float>();
+    TestSimdSearch<std::int64_t>();
+    TestSimdSearch<std::uint64_t>();
+    TestSimdSearch<double>();
+}
+
+TEST(SimdSearch, SortedVector)
+{
+    SortedVector<float> vector { 3.5f, -1.0f, 2.0f, 2.0f, 8.0f };
+
+    ASSERT_EQ(vector.lowerBound(2.0f) - vector.begin(), 1);
+    ASSERT_EQ(vector.upperBound(2.0f) - vector.begin(), 3);
+    ASSERT_EQ(vector.findSortedPlacement(10.0f), vector.end());
+    vector.pushN(200ul, [](const auto i) { return static_cast<float>(i) * 0.5f; });
+    ASSERT_TRUE(std::is_sorted(vector.begin(), vector.end()));
+    ASSERT_EQ(*vector.lowerBound(42.25f), 42.5f);
+    ASSERT_EQ(vector.upperBound(99.0f), vector.end() - 1);
+    ASSERT_EQ(vector.upperBound(99.5f), vector.end());
+}
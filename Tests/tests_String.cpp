@@ -49,6 +49,23 @@ TEST(String, Basics) \
     str = std::string(value); \
     assertStringValue(str); \
     str = std::string_view(value); \
+} \
+ \
+TEST(String, Uninitialized) \
+{ \
+    constexpr std::string_view value = "hello world"; \
+    String##Class str; \
+ \
+    std::memcpy(str.appendUninitialized(5), value.data(), 5); \
+    std::memcpy(str.appendUninitialized(6), value.data() + 5, 6); \
+    ASSERT_EQ(str, value); \
+    str.resizeAndOverwrite(64, [value](char * const data, const auto) { \
+        std::memcpy(data + 11, value.data(), 5); \
+        return 16; \
+    }); \
+    ASSERT_EQ(str, "hello worldhello"); \
+    str.resizeUninitialized(5); \
+    ASSERT_EQ(str, "hello"); \
 }
 
 using namespace kF::Core;
@@ -5,6 +5,8 @@
 
 #include <gtest/gtest.h>
 
+#include <functional>
+#include <list>
 #include <string>
 #include <memory_resource>
 
@@ -14,6 +16,13 @@
 #include <Kube/Core/AllocatedFlatVector.hpp>
 #include <Kube/Core/SmallVector.hpp>
 #include <Kube/Core/AllocatedSmallVector.hpp>
+#include <Kube/Core/InlineVector.hpp>
+
+/** @brief Compact small vectors don't store their capacity, their cache is always fully available */
+template<typename Vector>
+constexpr std::size_t CompactCacheCapacity = 0ul;
+template<typename Type, std::size_t OptimizedCapacity, std::integral Range, typename GrowthPolicy>
+constexpr std::size_t CompactCacheCapacity<kF::Core::CompactSmallVector<Type, OptimizedCapacity, Range, GrowthPolicy>> = OptimizedCapacity;
 
 #define GENERATE_VECTOR_TESTS(Vector, ...) \
 TEST(Vector, Basics) \
@@ -294,6 +303,136 @@ TEST(Vector, Find) \
     ASSERT_EQ(vector.find([](const std::size_t x) { return x == 15; }), vector.begin() + 15); \
     ASSERT_EQ(vector.find([](const std::size_t &x) { return x == 15; }), vector.begin() + 15); \
     ASSERT_EQ(vector.find([](std::size_t &x) { return ++x == 42; }), vector.end() - 1); \
+} \
+ \
+TEST(Vector, Uninitialized) \
+{ \
+    constexpr auto count = 42ul; \
+    Vector<std::size_t __VA_OPT__(,) __VA_ARGS__> vector; \
+ \
+    vector.resizeUninitialized(0); \
+    ASSERT_EQ(vector.size(), 0); \
+    vector.resizeUninitialized(count); \
+    ASSERT_EQ(vector.size(), count); \
+    for (auto i = 0ul; i < count; ++i) \
+        vector[i] = i; \
+    auto it = vector.appendUninitialized(count); \
+    ASSERT_EQ(it, vector.begin() + count); \
+    ASSERT_EQ(vector.size(), count * 2); \
+    for (auto i = count; i < count * 2; ++i) \
+        *it++ = i; \
+    vector.resizeUninitialized(count * 3); \
+    vector.resizeAndOverwrite(count * 4, [](std::size_t * const data, const auto size) { \
+        for (auto i = count * 2; i < size - 1; ++i) \
+            data[i] = i; \
+        return size - 1; \
+    }); \
+    ASSERT_EQ(vector.size(), count * 4 - 1); \
+    for (auto i = 0ul; i < vector.size(); ++i) \
+        ASSERT_EQ(vector[i], i); \
+} \
+ \
+TEST(Vector, PushN) \
+{ \
+    constexpr auto count = 42ul; \
+    Vector<std::string __VA_OPT__(,) __VA_ARGS__> vector; \
+    const char * const strs[] = { "a", "b", "c" }; \
+ \
+    ASSERT_EQ(vector.pushN(0, [](const auto) { return std::string(); }), vector.end()); \
+    auto it = vector.pushN(count, [](const auto i) { return std::to_string(i); }); \
+    ASSERT_EQ(it, vector.begin()); \
+    it = vector.pushN(count, [](const auto i) { return std::to_string(i + count); }); \
+    ASSERT_EQ(it, vector.begin() + count); \
+    ASSERT_EQ(vector.size(), count * 2); \
+    for (auto i = 0ul; i < count * 2; ++i) \
+        ASSERT_EQ(vector[i], std::to_string(i)); \
+    it = vector.emplaceRange(std::begin(strs), std::end(strs)); \
+    ASSERT_EQ(it, vector.begin() + count * 2); \
+    ASSERT_EQ(vector.size(), count * 2 + 3); \
+    ASSERT_EQ(vector.back(), "c"); \
+} \
+ \
+TEST(Vector, EraseIf) \
+{ \
+    constexpr auto count = 42ul; \
+    Vector<std::string __VA_OPT__(,) __VA_ARGS__> vector; \
+    auto isOdd = [](const std::string &str) { return std::stoul(str) % 2; }; \
+ \
+    ASSERT_EQ(vector.eraseIf(isOdd), 0); \
+    ASSERT_EQ(vector.eraseUnorderedIf(isOdd), 0); \
+    vector.pushN(count, [](const auto i) { return std::to_string(i); }); \
+    ASSERT_EQ(vector.eraseIf(isOdd), count / 2); \
+    ASSERT_EQ(vector.size(), count / 2); \
+    for (auto i = 0ul; i < count / 2; ++i) \
+        ASSERT_EQ(vector[i], std::to_string(i * 2)); \
+    vector.eraseUnordered(vector.begin()); \
+    ASSERT_EQ(vector.front(), std::to_string(count - 2)); \
+    vector.eraseUnordered(vector.end() - 1); \
+    ASSERT_EQ(vector.size(), count / 2 - 2); \
+    ASSERT_EQ(vector.back(), std::to_string(count - 6)); \
+    vector.clear(); \
+    vector.pushN(count, [](const auto i) { return std::to_string(i); }); \
+    ASSERT_EQ(vector.eraseUnorderedIf([](const std::string &str) { return std::stoul(str) % 3; }), count - count / 3); \
+    ASSERT_EQ(vector.size(), count / 3); \
+    std::sort(vector.begin(), vector.end(), [](const auto &lhs, const auto &rhs) { return std::stoul(lhs) < std::stoul(rhs); }); \
+    for (auto i = 0ul; i < count / 3; ++i) \
+        ASSERT_EQ(vector[i], std::to_string(i * 3)); \
+    ASSERT_EQ(vector.eraseUnorderedIf([](const auto &) { return true; }), count / 3); \
+    ASSERT_TRUE(vector.empty()); \
+} \
+ \
+TEST(Vector, Shrink) \
+{ \
+    constexpr auto count = 42ul; \
+    Vector<std::string __VA_OPT__(,) __VA_ARGS__> vector; \
+ \
+    ASSERT_FALSE(vector.shrinkToFit()); \
+    vector.reserve(count * 4); \
+    vector.pushN(count, [](const auto i) { return std::to_string(i); }); \
+    ASSERT_FALSE(vector.shrinkTo(count * 4)); \
+    ASSERT_TRUE(vector.shrinkTo(count * 2)); \
+    ASSERT_EQ(vector.capacity(), count * 2); \
+    ASSERT_TRUE(vector.shrinkTo(0)); \
+    ASSERT_EQ(vector.capacity(), count); \
+    ASSERT_FALSE(vector.shrinkToFit()); \
+    vector.erase(vector.begin() + 2, vector.end()); \
+    ASSERT_TRUE(vector.shrinkToFit()); \
+    ASSERT_EQ(vector.capacity(), std::max(2ul, CompactCacheCapacity<decltype(vector)>)); \
+    ASSERT_EQ(vector.size(), 2); \
+    ASSERT_EQ(vector[0], "0"); \
+    ASSERT_EQ(vector[1], "1"); \
+    vector.clear(); \
+    ASSERT_TRUE(vector.shrinkToFit()); \
+    ASSERT_FALSE(vector); \
+    ASSERT_EQ(vector.capacity(), 0); \
+} \
+ \
+TEST(Vector, Parallel) \
+{ \
+    constexpr auto str = "Parallel string that is not small optimized"; \
+    constexpr auto count = 50'000ul; \
+    Vector<std::string __VA_OPT__(,) __VA_ARGS__> vector; \
+ \
+    vector.resizeParallel(count, 4, str); \
+    ASSERT_EQ(vector.size(), count); \
+    for (const auto &elem : vector) \
+        ASSERT_EQ(elem, str); \
+    vector.resizeParallel(count * 2, 3); \
+    ASSERT_EQ(vector.size(), count * 2); \
+    for (const auto &elem : vector) \
+        ASSERT_TRUE(elem.empty()); \
+    vector.resizeParallel(3, 8, str); \
+    ASSERT_EQ(vector.size(), 3); \
+    ASSERT_EQ(vector[2], str); \
+    vector.resizeParallel(count, 8, str); \
+    vector.clearParallel(4); \
+    ASSERT_TRUE(vector.empty()); \
+    vector.resizeParallel(count, 2, str); \
+    vector.releaseParallel(4); \
+    ASSERT_FALSE(vector); \
+    ASSERT_EQ(vector.capacity(), 0); \
+    vector.resizeParallel(0, 4); \
+    ASSERT_EQ(vector.size(), 0); \
 }
 
 using namespace kF::Core;
@@ -316,6 +455,7 @@ GENERATE_VECTOR_TESTS(FlatVector)
 GENERATE_VECTOR_TESTS(AllocatedFlatVector, &DefaultAlloc, &DefaultDealloc)
 GENERATE_VECTOR_TESTS(SmallVector, 4)
 GENERATE_VECTOR_TESTS(AllocatedSmallVector, 4, &DefaultAlloc, &DefaultDealloc)
+GENERATE_VECTOR_TESTS(CompactSmallVector, 4)
 
 TEST(SmallVector, SmallOptimizationInsertRange)
 {
@@ -338,6 +478,26 @@ TEST(SmallVector, SmallOptimizationInsertRange)
         ASSERT_EQ(*vector.at(i), i);
 }
 
+TEST(SmallVector, SmallOptimizationShrink)
+{
+    SmallVector<std::string, 4> vector { "0", "1", "2", "3", "4", "5" };
+
+    ASSERT_FALSE(vector.isCacheUsed());
+    vector.pop();
+    vector.pop();
+    vector.pop();
+    ASSERT_TRUE(vector.shrinkTo(4));
+    ASSERT_TRUE(vector.isCacheUsed());
+    ASSERT_FALSE(vector.shrinkToFit());
+    ASSERT_EQ(vector.capacity(), 4);
+    ASSERT_EQ(vector.size(), 3);
+    for (auto i = 0ul; i < vector.size(); ++i)
+        ASSERT_EQ(vector[i], std::to_string(i));
+    vector.push("3");
+    ASSERT_TRUE(vector.isCacheUsed());
+    ASSERT_EQ(vector.back(), "3");
+}
+
 TEST(SmallVector, SmallOptimizationPush)
 {
     constexpr auto PushTest = [](auto &vector, const int value, const bool isCacheUsed) {
@@ -354,4 +514,271 @@ TEST(SmallVector, SmallOptimizationPush)
     PushTest(vector, 3, true);
 
     PushTest(vector, 4, false);
-}
\ No newline at end of file
+}
+
+TEST(SmallVector, SmallOptimizationSwap)
+{
+    constexpr auto Check = [](const auto &vector, const std::size_t size, const std::size_t offset) {
+        ASSERT_EQ(vector.size(), size);
+        for (auto i = 0ul; i < size; ++i)
+            ASSERT_EQ(vector[i], std::to_string(offset + i));
+    };
+    constexpr auto Make = [](const std::size_t size, const std::size_t offset) {
+        SmallVector<std::string, 4> vector;
+        vector.pushN(size, [offset](const auto i) { return std::to_string(offset + i); });
+        return vector;
+    };
+
+    for (const auto &[lhsSize, rhsSize] : { std::pair { 1ul, 3ul }, { 3ul, 1ul }, { 0ul, 2ul }, { 2ul, 6ul }, { 6ul, 2ul }, { 5ul, 7ul } }) {
+        auto lhs = Make(lhsSize, 0);
+        auto rhs = Make(rhsSize, 100);
+        lhs.swap(rhs);
+        Check(lhs, rhsSize, 100);
+        Check(rhs, lhsSize, 0);
+        ASSERT_EQ(lhs.isCacheUsed(), rhsSize <= 4 && rhsSize);
+        ASSERT_EQ(rhs.isCacheUsed(), lhsSize <= 4 && lhsSize);
+        lhs = std::move(rhs);
+        Check(lhs, lhsSize, 0);
+        ASSERT_TRUE(rhs.empty());
+    }
+
+    SmallVector<std::size_t, 4> lhs { 1ul, 2ul }, rhs { 3ul, 4ul, 5ul };
+    lhs.swap(rhs);
+    ASSERT_EQ(lhs, (SmallVector<std::size_t, 4> { 3ul, 4ul, 5ul }));
+    ASSERT_EQ(rhs, (SmallVector<std::size_t, 4> { 1ul, 2ul }));
+    ASSERT_TRUE(lhs.isCacheUsed() && rhs.isCacheUsed());
+}
+
+static_assert(sizeof(TinyCompactSmallVector<int, 4>) == sizeof(TinySmallVector<int, 4>) - sizeof(int *), "TinyCompactSmallVector must not store a data pointer beside its cache");
+static_assert(sizeof(TinyCompactSmallVector<int, 4>) < sizeof(TinySmallVector<int, 4>), "TinyCompactSmallVector must be smaller than TinySmallVector");
+
+TEST(CompactSmallVector, SmallOptimizationSpill)
+{
+    TinyCompactSmallVector<std::string, 2> vector;
+
+    vector.push("0");
+    vector.push("1");
+    ASSERT_TRUE(vector.isCacheUsed());
+    ASSERT_EQ(vector.capacity(), 2);
+    vector.insert(vector.begin(), "-1");
+    ASSERT_FALSE(vector.isCacheUsed());
+    ASSERT_EQ(vector.size(), 3);
+    for (auto i = 0u; i < vector.size(); ++i)
+        ASSERT_EQ(vector[i], std::to_string(static_cast<int>(i) - 1));
+    vector.erase(vector.begin());
+    ASSERT_TRUE(vector.shrinkToFit());
+    ASSERT_TRUE(vector.isCacheUsed());
+    ASSERT_EQ(vector.size(), 2);
+    ASSERT_EQ(vector[0], "0");
+    ASSERT_EQ(vector[1], "1");
+
+    TinyCompactSmallVector<std::string, 2> other { "a", "b", "c" };
+    vector.swap(other);
+    ASSERT_FALSE(vector.isCacheUsed());
+    ASSERT_TRUE(other.isCacheUsed());
+    ASSERT_EQ(vector.size(), 3);
+    ASSERT_EQ(vector[2], "c");
+    ASSERT_EQ(other.size(), 2);
+    ASSERT_EQ(other[1], "1");
+    other = std::move(vector);
+    ASSERT_TRUE(vector.empty());
+    ASSERT_FALSE(vector.data());
+    ASSERT_EQ(other.size(), 3);
+    ASSERT_EQ(other[0], "a");
+}
+
+static_assert(IsTriviallyRelocatable<Vector<std::string>>::Value, "Vector must be trivially relocatable");
+static_assert(IsTriviallyRelocatable<FlatVector<std::string>>::Value, "FlatVector must be trivially relocatable");
+static_assert(IsTriviallyRelocatable<AllocatedVector<int, &DefaultAlloc, &DefaultDealloc>>::Value, "AllocatedVector must be trivially relocatable");
+static_assert(!IsTriviallyRelocatable<SmallVector<int, 4>>::Value, "SmallVector must not be trivially relocatable");
+static_assert(IsTriviallyRelocatable<CompactSmallVector<int, 4>>::Value, "CompactSmallVector must be trivially relocatable");
+static_assert(!IsTriviallyRelocatable<std::string>::Value, "std::string must not be trivially relocatable");
+
+TEST(Vector, TriviallyRelocatableElements)
+{
+    constexpr auto count = 64ul;
+    constexpr auto Check = [](const auto &elem, const std::size_t value) {
+        ASSERT_EQ(elem.size(), value);
+        for (const auto x : elem)
+            ASSERT_EQ(x, value);
+    };
+
+    Vector<Vector<std::size_t>> vector;
+    for (auto i = 0ul; i < count; ++i)
+        vector.push(i, i);
+    vector.insert(vector.begin(), Vector<std::size_t>(count, count));
+    vector.insertCopy(vector.begin() + 1, 3, Vector<std::size_t>(1, 1));
+    vector.erase(vector.begin() + 1, vector.begin() + 4);
+    vector.erase(vector.begin());
+    ASSERT_EQ(vector.size(), count);
+    for (auto i = 0ul; i < count; ++i)
+        Check(vector[i], i);
+}
+
+TEST(Vector, NonTriviallyRelocatableElements)
+{
+    constexpr auto count = 64ul;
+
+    Vector<SmallVector<std::string, 2>> vector;
+    for (auto i = 0ul; i < count; ++i)
+        vector.push(i % 4, std::to_string(i));
+    vector.insertDefault(vector.begin() + 2, 5);
+    vector.erase(vector.begin() + 2, vector.begin() + 7);
+    ASSERT_EQ(vector.size(), count);
+    for (auto i = 0ul; i < count; ++i) {
+        ASSERT_EQ(vector[i].size(), i % 4);
+        for (const auto &str : vector[i])
+            ASSERT_EQ(str, std::to_string(i));
+    }
+}
+
+TEST(Vector, InsertSelfRange)
+{
+    Vector<std::string> vector { "0", "1", "2", "3" };
+
+    vector.insert(vector.end(), vector.begin(), vector.end());
+    ASSERT_EQ(vector.size(), 8);
+    for (auto i = 0ul; i < vector.size(); ++i)
+        ASSERT_EQ(vector[i], std::to_string(i % 4));
+
+    // Without growth, the source is shifted when the room is opened
+    Vector<std::string> reserved { "0", "1", "2", "3" };
+    reserved.reserve(16);
+    reserved.insert(reserved.begin(), reserved.begin() + 2, reserved.end());
+    ASSERT_EQ(reserved, (Vector<std::string> { "2", "3", "0", "1", "2", "3" }));
+    reserved.insert(reserved.begin(), reserved[2]);
+    ASSERT_EQ(reserved, (Vector<std::string> { "0", "2", "3", "0", "1", "2", "3" }));
+    reserved.insert(reserved.begin() + 1, std::move(reserved[6]));
+    ASSERT_EQ(reserved[1], "3");
+    reserved.insertCopy(reserved.begin(), 2, reserved[1]);
+    ASSERT_EQ(reserved.size(), 10);
+    ASSERT_EQ(reserved[0], "3");
+    ASSERT_EQ(reserved[1], "3");
+    ASSERT_EQ(reserved.capacity(), 16);
+
+    SmallVector<std::string, 8> small { "0", "1", "2", "3" };
+    small.insert(small.begin(), small.begin() + 2, small.end());
+    ASSERT_EQ(small, (SmallVector<std::string, 8> { "2", "3", "0", "1", "2", "3" }));
+}
+
+TEST(Vector, Reallocation)
+{
+    constexpr auto count = 10000ul;
+
+    Vector<std::size_t> vector;
+    FlatVector<std::size_t> flatVector;
+    for (auto i = 0ul; i < count; ++i) {
+        vector.push(i);
+        flatVector.push(i);
+    }
+    vector.reserve(count * 4);
+    flatVector.reserve(count * 4);
+    ASSERT_EQ(vector.capacity(), count * 4);
+    ASSERT_EQ(flatVector.capacity(), count * 4);
+    ASSERT_EQ(vector.size(), count);
+    ASSERT_EQ(flatVector.size(), count);
+    for (auto i = 0ul; i < count; ++i) {
+        ASSERT_EQ(vector[i], i);
+        ASSERT_EQ(flatVector[i], i);
+    }
+}
+
+template<typename Vector, std::size_t Width>
+static void TestAlignedVector(void)
+{
+    Vector vector;
+
+    for (auto i = 0; i < 100; ++i) {
+        vector.push(static_cast<float>(i));
+        ASSERT_EQ(reinterpret_cast<std::uintptr_t>(vector.data()) % Width, 0);
+        ASSERT_EQ((vector.capacity() * sizeof(float)) % Width, 0);
+    }
+    for (auto i = 0; i < 100; ++i)
+        ASSERT_EQ(vector[i], static_cast<float>(i));
+    vector.reserve(1000);
+    ASSERT_EQ(reinterpret_cast<std::uintptr_t>(vector.data()) % Width, 0);
+    ASSERT_EQ(vector[99], 99.0f);
+
+    // Exact reservations are padded with zeroes up to the SIMD width
+    vector.clear();
+    ASSERT_TRUE(vector.shrinkToFit());
+    vector.resize(3, 1.0f);
+    ASSERT_EQ(vector.capacity(), 3);
+    for (auto i = 3ul; i < Width / sizeof(float); ++i)
+        ASSERT_EQ(vector.data()[i], 0.0f);
+}
+
+TEST(AlignedVector, Alignment)
+{
+    TestAlignedVector<AlignedVector<float>, CacheLineSize>();
+    TestAlignedVector<AlignedVector<float, 32, std::uint32_t>, 32>();
+    TestAlignedVector<AlignedFlatVector<float>, CacheLineSize>();
+    TestAlignedVector<AlignedFlatVector<float, 32, std::uint32_t>, 32>();
+    static_assert(alignof(AlignedFlatVector<float>::Header) == CacheLineSize);
+    static_assert(sizeof(AlignedFlatVector<float, 32, std::uint32_t>::Header) == 32);
+}
+
+static_assert(std::is_trivially_copyable_v<InlineVector<int, 8>>, "Inline vectors of trivial types must be trivially copyable");
+static_assert(!std::is_trivially_copyable_v<InlineVector<std::string, 8>>, "Inline vectors of non-trivial types must not be trivially copyable");
+static_assert(sizeof(TinyInlineVector<int, 4>) == sizeof(int) * 4 + sizeof(std::uint32_t));
+static_assert(IsTriviallyRelocatable<InlineVector<int, 4>>::Value && !IsTriviallyRelocatable<InlineVector<std::list<int>, 4>>::Value);
+
+template<typename Type>
+static void TestInlineVector(const std::function<Type(std::size_t)> &make)
+{
+    constexpr auto capacity = 16ul;
+    InlineVector<Type, capacity> vector;
+
+    ASSERT_TRUE(vector.empty());
+    ASSERT_EQ(vector.capacity(), capacity);
+    const auto data = vector.data();
+    for (auto i = 0ul; i < capacity; ++i)
+        vector.push(make(i));
+    ASSERT_EQ(vector.data(), data);
+    ASSERT_EQ(vector.size(), capacity);
+    for (auto i = 0ul; i < capacity; ++i)
+        ASSERT_EQ(vector[i], make(i));
+
+    vector.erase(vector.begin() + 2, vector.begin() + 6);
+    ASSERT_EQ(vector.size(), capacity - 4);
+    ASSERT_EQ(vector[2], make(6));
+    vector.insert(vector.begin(), { make(42), make(43) });
+    ASSERT_EQ(vector.size(), capacity - 2);
+    ASSERT_EQ(vector[0], make(42));
+    ASSERT_EQ(vector[2], make(0));
+    vector.eraseUnordered(vector.begin());
+    ASSERT_EQ(vector[0], make(capacity - 1));
+
+    auto copy = vector;
+    ASSERT_EQ(copy, vector);
+    InlineVector<Type, capacity> moved(std::move(copy));
+    ASSERT_EQ(moved, vector);
+    InlineVector<Type, capacity> other(3, make(7));
+    other.swap(moved);
+    ASSERT_EQ(other, vector);
+    ASSERT_EQ(moved.size(), 3);
+    ASSERT_EQ(moved[2], make(7));
+    moved = std::move(other);
+    ASSERT_EQ(moved, vector);
+
+    vector.resize(capacity, make(1));
+    ASSERT_EQ(vector.size(), capacity);
+    ASSERT_EQ(vector.back(), make(1));
+    ASSERT_FALSE(vector.reserve(capacity));
+    vector.pop();
+    ASSERT_FALSE(vector.shrinkToFit());
+    ASSERT_EQ(vector.capacity(), capacity);
+    vector.clear();
+    ASSERT_FALSE(vector.shrinkToFit());
+    ASSERT_EQ(vector.capacity(), capacity);
+    vector.release();
+    ASSERT_TRUE(vector.empty());
+    ASSERT_EQ(vector.capacity(), capacity);
+    ASSERT_EQ(vector.data(), data);
+}
+
+TEST(InlineVector, Basics)
+{
+    TestInlineVector<std::size_t>([](const auto i) { return i; });
+    TestInlineVector<std::string>([](const auto i) { return "Inline vector string that is not small optimized #" + std::to_string(i); });
+}
@@ -12,6 +12,8 @@
 #include <iterator>
 #include <utility>
 #include <cstdlib>
+#include <cstring>
+#include <memory>
 
 /** @brief Helper used to pass template into macro */
 #define TEMPLATE_TYPE(Class, ...) decltype(std::declval<Class<__VA_ARGS__>>())
@@ -109,6 +111,14 @@ namespace kF::Core
     constexpr std::size_t CacheLineQuarterSize = CacheLineSize / 4;
     constexpr std::size_t CacheLineEighthSize = CacheLineSize / 8;
 
+    /** @brief Tell if a type can be moved to another address with a raw memory copy, without destroying the source
+     *  True for trivially copyable types, specialize it for types that own pointers but never point into themselves */
+    template<typename Type>
+    struct IsTriviallyRelocatable
+    {
+        static constexpr bool Value = std::is_trivially_copyable_v<Type>;
+    };
+
     namespace Utils
     {
         /** @brief Similar to std::aligned_alloc, but ensure arguments, you must use AlignedFree to free the memory */
@@ -118,6 +128,11 @@ namespace kF::Core
         template<typename Cast = void>
         [[nodiscard]] Cast *AlignedAlloc(const std::size_t bytes, const std::size_t alignment) noexcept;
 
+        /** @brief Resize a pointer allocated with AlignedAlloc, in place when possible
+         *  Only fundamental alignments are preserved, on failure returns nullptr and 'data' is left untouched */
+        template<std::size_t RequiredAlignment, typename Cast = void>
+        [[nodiscard]] Cast *AlignedRealloc(void * const data, const std::size_t bytes) noexcept;
+
         /** @brief Free a pointer allocated with AlignedAlloc */
         void AlignedFree(void *data) noexcept;
 
@@ -189,6 +204,18 @@ namespace kF::Core
         template<typename Convertible, template<typename...> class Op, typename... Args>
         constexpr bool IsDetectedConvertible = std::is_convertible_v<Convertible, DetectedType<Op, Args...>>;
 
+        /** @brief Relocate range [from, to[ to uninitialized 'output', which must not overlap or be located before 'from'
+         *  Source elements are left destroyed */
+        template<typename Type>
+        void RelocateForward(Type * const from, Type * const to, Type * const output)
+            noexcept(nothrow_move_constructible(Type) && nothrow_destructible(Type));
+
+        /** @brief Relocate range [from, to[ to uninitialized memory ending at 'outputEnd', which must not overlap or be located after 'to'
+         *  Source elements are left destroyed */
+        template<typename Type>
+        void RelocateBackward(Type * const from, Type * const to, Type * const outputEnd)
+            noexcept(nothrow_move_constructible(Type) && nothrow_destructible(Type));
+
         /** @brief Find the closest power of 2 of value */
         template<std::integral Unit>
         [[nodiscard]] constexpr Unit NextPowerOf2(Unit value) noexcept;
@@ -28,11 +28,53 @@ inline Cast *kF::Core::Utils::AlignedAlloc(const std::size_t bytes, [[maybe_unus
 #endif
 }
 
+template<std::size_t RequiredAlignment, typename Cast>
+inline Cast *kF::Core::Utils::AlignedRealloc(void * const data, const std::size_t bytes) noexcept
+{
+    static_assert(RequiredAlignment <= alignof(std::max_align_t), "Realloc only preserves fundamental alignments");
+
+    return reinterpret_cast<Cast *>(std::realloc(data, bytes));
+}
+
 inline void kF::Core::Utils::AlignedFree(void *data) noexcept
 {
     std::free(data);
 }
 
+template<typename Type>
+inline void kF::Core::Utils::RelocateForward(Type * const from, Type * const to, Type * const output)
+    noexcept(nothrow_move_constructible(Type) && nothrow_destructible(Type))
+{
+    if constexpr (IsTriviallyRelocatable<Type>::Value) {
+        if (from != to) [[likely]]
+            std::memmove(static_cast<void *>(output), static_cast<const void *>(from), sizeof(Type) * static_cast<std::size_t>(to - from));
+    } else {
+        auto out = output;
+        for (auto it = from; it != to; ++it, ++out) {
+            new (out) Type(std::move(*it));
+            it->~Type();
+        }
+    }
+}
+
+template<typename Type>
+inline void kF::Core::Utils::RelocateBackward(Type * const from, Type * const to, Type * const outputEnd)
+    noexcept(nothrow_move_constructible(Type) && nothrow_destructible(Type))
+{
+    if constexpr (IsTriviallyRelocatable<Type>::Value) {
+        if (from != to) [[likely]]
+            std::memmove(static_cast<void *>(outputEnd - (to - from)), static_cast<const void *>(from), sizeof(Type) * static_cast<std::size_t>(to - from));
+    } else {
+        auto out = outputEnd;
+        for (auto it = to; it != from;) {
+            --it;
+            --out;
+            new (out) Type(std::move(*it));
+            it->~Type();
+        }
+    }
+}
+
 template<std::integral Unit>
 inline constexpr Unit kF::Core::Utils::NextPowerOf2(Unit value) noexcept
 {
@@ -16,11 +16,18 @@ namespace kF::Core
      *
      * @tparam Type Internal type in container
      * @tparam Range Range of container
+     * @tparam GrowthPolicy Capacity growth policy
+     * @tparam AllocationPolicy Policy placing the buffer in memory
      */
-    template<typename Type, std::integral Range = std::size_t>
-    using Vector = Internal::VectorDetails<Internal::VectorBase<Type, Range>, Type, Range>;
+    template<typename Type, std::integral Range = std::size_t, typename GrowthPolicy = DefaultGrowthPolicy, typename AllocationPolicy = DefaultAllocationPolicy>
+    using Vector = Internal::VectorDetails<Internal::VectorBase<Type, Range, AllocationPolicy>, Type, Range, false, GrowthPolicy>;
 
     /** @brief 16 bytes vector with a reduced range */
-    template<typename Type>
-    using TinyVector = Vector<Type, std::uint32_t>;
+    template<typename Type, typename GrowthPolicy = DefaultGrowthPolicy>
+    using TinyVector = Vector<Type, std::uint32_t, GrowthPolicy>;
+
+    /** @brief Vector whose data is aligned to 'Width' bytes and whose capacity fills a multiple of 'Width' bytes
+     *  Meant for SIMD loops using aligned full width loads */
+    template<typename Type, std::size_t Width = CacheLineSize, std::integral Range = std::size_t>
+    using AlignedVector = Vector<Type, Range, PageGrowthPolicy<Width>, SimdAllocationPolicy<Width>>;
 }
\ No newline at end of file
@@ -6,15 +6,16 @@
 #pragma once
 
 #include "Utils.hpp"
+#include "AllocationPolicy.hpp"
 
 namespace kF::Core::Internal
 {
-    template<typename Type, std::integral Range>
+    template<typename Type, std::integral Range, typename AllocationPolicy = DefaultAllocationPolicy>
     class VectorBase;
 }
 
 /** @brief Base implementation of a vector with size and capacity cached */
-template<typename Type, std::integral Range>
+template<typename Type, std::integral Range, typename AllocationPolicy>
 class kF::Core::Internal::VectorBase
 {
 public:
@@ -83,10 +84,17 @@ protected:
 
     /** @brief Allocates a new buffer */
     [[nodiscard]] Type *allocate(const Range capacity) noexcept
-        { return reinterpret_cast<Type *>(Utils::AlignedAlloc<alignof(Type)>(sizeof(Type) * capacity)); }
+        { return reinterpret_cast<Type *>(AllocationPolicy::Allocate(sizeof(Type) * capacity, alignof(Type))); }
 
     /** @brief Deallocates a buffer */
-    void deallocate(Type * const data, const Range) noexcept { Utils::AlignedFree(data); }
+    void deallocate(Type * const data, const Range capacity) noexcept
+        { AllocationPolicy::Deallocate(data, sizeof(Type) * capacity, alignof(Type)); }
+
+    /** @brief Resize a buffer in place when possible, its content is moved bytewise
+     *  @return nullptr if the buffer could not be resized, in which case it is left untouched */
+    [[nodiscard]] Type *reallocate(Type * const data, const Range, const Range capacity) noexcept
+        requires (alignof(Type) <= alignof(std::max_align_t) && std::is_same_v<AllocationPolicy, DefaultAllocationPolicy>)
+        { return Utils::AlignedRealloc<alignof(Type), Type>(data, sizeof(Type) * capacity); }
 
 private:
     Type *_data { nullptr };
@@ -94,4 +102,11 @@ private:
     Range _capacity {};
 };
 
+/** @brief VectorBase only owns a heap pointer */
+template<typename Type, std::integral Range, typename AllocationPolicy>
+struct kF::Core::IsTriviallyRelocatable<kF::Core::Internal::VectorBase<Type, Range, AllocationPolicy>>
+{
+    static constexpr bool Value = true;
+};
+
 #include "VectorBase.ipp"
\ No newline at end of file
@@ -3,8 +3,8 @@
  * @ Description: Vector
  */
 
-template<typename Type, std::integral Range>
-inline void kF::Core::Internal::VectorBase<Type, Range>::steal(VectorBase &other) noexcept
+template<typename Type, std::integral Range, typename AllocationPolicy>
+inline void kF::Core::Internal::VectorBase<Type, Range, AllocationPolicy>::steal(VectorBase &other) noexcept
 {
     if (_data) {
         std::destroy(beginUnsafe(), endUnsafe());
@@ -18,8 +18,8 @@ inline void kF::Core::Internal::VectorBase<Type, Range>::steal(VectorBase &other
     other._capacity = Range{};
 }
 
-template<typename Type, std::integral Range>
-inline void kF::Core::Internal::VectorBase<Type, Range>::swap(VectorBase &other) noexcept
+template<typename Type, std::integral Range, typename AllocationPolicy>
+inline void kF::Core::Internal::VectorBase<Type, Range, AllocationPolicy>::swap(VectorBase &other) noexcept
 {
     std::swap(_data, other._data);
     std::swap(_size, other._size);
@@ -6,19 +6,23 @@
 #pragma once
 
 #include <algorithm>
+#include <functional>
 #include <initializer_list>
 #include <memory>
+#include <stdexcept>
 
 #include "Assert.hpp"
 #include "Utils.hpp"
+#include "GrowthPolicy.hpp"
+#include "Parallel.hpp"
 
 namespace kF::Core::Internal
 {
-    template<typename Base, typename Type, std::integral Range, bool IsSmallOptimized = false>
+    template<typename Base, typename Type, std::integral Range, bool IsSmallOptimized = false, typename GrowthPolicy = DefaultGrowthPolicy>
     class VectorDetails;
 }
 
-template<typename Base, typename Type, std::integral Range, bool IsSmallOptimized>
+template<typename Base, typename Type, std::integral Range, bool IsSmallOptimized, typename GrowthPolicy>
 class kF::Core::Internal::VectorDetails : public Base
 {
 public:
@@ -46,15 +50,20 @@ public:
     using Base::swap;
     using Base::isSafe;
 
+    /** @brief Bases flagged 'IsTriviallyCopyable' make the vector trivially copyable (ex: inline storage of trivial types) */
+    static constexpr bool IsTriviallyCopyable = requires { requires Base::IsTriviallyCopyable; };
+
     /** @brief Default constructor */
     VectorDetails(void) noexcept = default;
 
     /** @brief Copy constructor */
-    VectorDetails(const VectorDetails &other) noexcept_copy_constructible(Type)
+    VectorDetails(const VectorDetails &other) noexcept requires IsTriviallyCopyable = default;
+    VectorDetails(const VectorDetails &other) noexcept_copy_constructible(Type) requires (!IsTriviallyCopyable)
         { resize(other.begin(), other.end()); }
 
     /** @brief Move constructor */
-    VectorDetails(VectorDetails &&other) noexcept { steal(other); }
+    VectorDetails(VectorDetails &&other) noexcept requires IsTriviallyCopyable = default;
+    VectorDetails(VectorDetails &&other) noexcept requires (!IsTriviallyCopyable) { steal(other); }
 
     /** @brief Resize with default constructor */
     VectorDetails(const Range count)
@@ -83,14 +92,17 @@ public:
         : VectorDetails(init.begin(), init.end()) {}
 
     /** @brief Release the vector */
-    ~VectorDetails(void) noexcept_destructible(Type) { release(); }
+    ~VectorDetails(void) noexcept requires IsTriviallyCopyable = default;
+    ~VectorDetails(void) noexcept_destructible(Type) requires (!IsTriviallyCopyable) { release(); }
 
     /** @brief Copy assignment */
-    VectorDetails &operator=(const VectorDetails &other) noexcept_copy_constructible(Type)
+    VectorDetails &operator=(const VectorDetails &other) noexcept requires IsTriviallyCopyable = default;
+    VectorDetails &operator=(const VectorDetails &other) noexcept_copy_constructible(Type) requires (!IsTriviallyCopyable)
         { resize(other.begin(), other.end()); return *this; }
 
     /** @brief Move assignment */
-    VectorDetails &operator=(VectorDetails &&other) noexcept { steal(other); return *this; }
+    VectorDetails &operator=(VectorDetails &&other) noexcept requires IsTriviallyCopyable = default;
+    VectorDetails &operator=(VectorDetails &&other) noexcept requires (!IsTriviallyCopyable) { steal(other); return *this; }
 
     /** @brief Fast non-empty check */
     [[nodiscard]] operator bool(void) const noexcept { return !empty(); }
@@ -129,6 +141,21 @@ public:
     Type &push(Args &&...args)
         noexcept(nothrow_constructible(Type, Args...) && nothrow_forward_constructible(Type) && nothrow_destructible(Type));
 
+    /** @brief Push 'count' elements constructed from 'generator(index)', the buffer grows at most once
+     *  @return Iterator to the first pushed element */
+    template<typename Generator>
+        requires std::invocable<Generator &, Range> && std::constructible_from<Type, std::invoke_result_t<Generator &, Range>>
+    Iterator pushN(const Range count, Generator &&generator)
+        noexcept(nothrow_invocable(Generator &, Range) && nothrow_constructible(Type, std::invoke_result_t<Generator &, Range>)
+            && nothrow_forward_constructible(Type) && nothrow_destructible(Type));
+
+    /** @brief Push a range of elements constructed from each dereferenced iterator, the buffer grows at most once
+     *  @return Iterator to the first pushed element */
+    template<std::input_iterator InputIterator>
+        requires std::constructible_from<Type, std::iter_reference_t<InputIterator>>
+    Iterator emplaceRange(InputIterator from, InputIterator to)
+        noexcept(nothrow_constructible(Type, std::iter_reference_t<InputIterator>) && nothrow_forward_constructible(Type) && nothrow_destructible(Type));
+
     /** @brief Pop the last element of the vector */
     void pop(void) noexcept_destructible(Type);
 
@@ -180,6 +207,25 @@ public:
         noexcept(nothrow_forward_constructible(Type) && nothrow_destructible(Type))
         { erase(pos, pos + 1); }
 
+    /** @brief Remove a specific element in O(1) by relocating the last element in its place, order is not preserved */
+    void eraseUnordered(Iterator pos)
+        noexcept(nothrow_forward_constructible(Type) && nothrow_destructible(Type));
+
+    /** @brief Remove every element matching 'predicate' in a single stable pass
+     *  @return Count of removed elements */
+    template<typename Predicate>
+        requires std::predicate<Predicate &, Type &>
+    Range eraseIf(Predicate &&predicate)
+        noexcept(nothrow_invocable(Predicate &, Type &) && nothrow_move_assignable(Type) && nothrow_destructible(Type));
+
+    /** @brief Remove every element matching 'predicate' in a single pass, filling holes with the last elements
+     *  Order is not preserved but fewer elements are moved than with 'eraseIf'
+     *  @return Count of removed elements */
+    template<typename Predicate>
+        requires std::predicate<Predicate &, Type &>
+    Range eraseUnorderedIf(Predicate &&predicate)
+        noexcept(nothrow_invocable(Predicate &, Type &) && nothrow_forward_constructible(Type) && nothrow_destructible(Type));
+
 
     /** @brief Resize the vector using default constructor to initialize each element */
     void resize(const Range count)
@@ -191,6 +237,16 @@ public:
         noexcept(nothrow_copy_constructible(Type) && nothrow_forward_constructible(Type) && nothrow_destructible(Type))
         requires std::copy_constructible<Type>;
 
+    /** @brief Resize the vector using default constructor, elements are constructed by 'threadCount' threads
+     *  The constructor of Type must not throw */
+    void resizeParallel(const Range count, const std::size_t threadCount) noexcept_destructible(Type)
+        requires std::constructible_from<Type>;
+
+    /** @brief Resize the vector by copying given element, elements are constructed by 'threadCount' threads
+     *  The copy constructor of Type must not throw */
+    void resizeParallel(const Range count, const std::size_t threadCount, const Type &value) noexcept_destructible(Type)
+        requires std::copy_constructible<Type>;
+
     /** @brief Resize the vector with input iterators */
     template<std::input_iterator InputIterator>
     void resize(InputIterator from, InputIterator to)
@@ -201,20 +257,54 @@ public:
     void resize(InputIterator from, InputIterator to, Map &&map);
 
 
+    /** @brief Resize the vector without initializing new elements, existing elements are preserved
+     *  Meant to write directly into the buffer (ex: I/O reads) without a redundant initialization */
+    void resizeUninitialized(const Range count) noexcept
+        requires std::is_trivially_default_constructible_v<Type> && std::is_trivially_destructible_v<Type>;
+
+    /** @brief Append 'count' uninitialized elements, growing using GrowthPolicy
+     *  @return Iterator to the first appended element */
+    Iterator appendUninitialized(const Range count) noexcept
+        requires std::is_trivially_default_constructible_v<Type> && std::is_trivially_destructible_v<Type>;
+
+    /** @brief Resize the vector to 'count' uninitialized elements then let 'operation(data, count)' write them
+     *  The operation must return the final size of the vector, lower or equal to 'count' */
+    template<typename Operation>
+        requires std::is_invocable_r_v<Range, Operation, Type *, Range>
+    void resizeAndOverwrite(const Range count, Operation &&operation) noexcept(nothrow_ndebug && nothrow_invocable(Operation, Type *, Range))
+        requires std::is_trivially_default_constructible_v<Type> && std::is_trivially_destructible_v<Type>;
+
+
     /** @brief Destroy all elements */
     void clear(void) noexcept_destructible(Type);
     void clearUnsafe(void) noexcept_destructible(Type);
 
+    /** @brief Destroy all elements using 'threadCount' threads, the destructor of Type must not throw */
+    void clearParallel(const std::size_t threadCount) noexcept_destructible(Type);
+
     /** @brief Destroy all elements and release the buffer instance */
     void release(void) noexcept_destructible(Type);
     void releaseUnsafe(void) noexcept_destructible(Type);
 
+    /** @brief Destroy all elements using 'threadCount' threads and release the buffer instance */
+    void releaseParallel(const std::size_t threadCount) noexcept_destructible(Type);
+
 
     /** @brief Reserve memory for fast emplace only if asked capacity is higher than current capacity
      *  The data is either preserved or moved
      *  @return True if the reserve happened and the data has been moved */
     bool reserve(const Range capacity) noexcept(nothrow_forward_constructible(Type) && nothrow_destructible(Type));
 
+    /** @brief Reduce capacity to the greatest of 'capacity' and current size, the data is either preserved or moved
+     *  An empty vector is released, a small optimized vector moves back into its cache when possible
+     *  @return True if the capacity has been reduced */
+    bool shrinkTo(const Range capacity) noexcept(nothrow_forward_constructible(Type) && nothrow_destructible(Type));
+
+    /** @brief Reduce capacity to current size
+     *  @return True if the capacity has been reduced */
+    bool shrinkToFit(void) noexcept(nothrow_forward_constructible(Type) && nothrow_destructible(Type))
+        { return shrinkTo(size()); }
+
 
     /** @brief Move range [from, to] at [output, to - from] */
     void move(Range from, Range to, Range output) noexcept_ndebug;
@@ -248,7 +338,7 @@ public:
         { return std::find_if(begin(), end(), std::forward<Functor>(functor)); }
 
 
-    /** @brief Grow internal buffer of a given minimum */
+    /** @brief Grow internal buffer of a given minimum, the new capacity is chosen by GrowthPolicy */
     void grow(const Range minimum = Range()) noexcept(nothrow_forward_constructible(Type) && nothrow_destructible(Type));
 
 protected:
@@ -261,6 +351,33 @@ protected:
     /** @brief Reserve unsafe takes IsSafe as template parameter */
     template<bool IsSafe = true>
     bool reserveUnsafe(const Range capacity) noexcept(nothrow_forward_constructible(Type) && nothrow_destructible(Type));
+
+    /** @brief Move the elements into a buffer of 'capacity', in place when possible
+     *  @return False if a small optimized vector kept its cache */
+    bool relocateBuffer(const Range currentCapacity, const Range capacity) noexcept(nothrow_forward_constructible(Type) && nothrow_destructible(Type));
+
+    /** @brief Try to resize the current buffer in place through the optional 'reallocate' hook of Base
+     *  Only trivially relocatable types are eligible, returns false if the caller must allocate and relocate instead */
+    [[nodiscard]] bool tryReallocate(const Range currentCapacity, const Range capacity) noexcept;
+
+    /** @brief Open room for 'count' elements at 'pos' by relocating the tail (or growing) then call 'construct' on the room
+     *  If 'aliasing' is true, 'construct' reads elements of the vector and must run before the tail is relocated */
+    template<typename Construct>
+    Iterator insertImpl(const Iterator pos, const Range count, Construct &&construct, const bool aliasing = false);
+
+    /** @brief Relocate the tail of the current buffer to open room for 'count' elements at 'position' then call 'construct' on the room */
+    template<typename Construct>
+    void openRoom(const Range position, const Range count, Construct &&construct, const bool aliasing);
+
+    /** @brief Check if an iterator points to an element of the vector */
+    template<typename InputIterator>
+    [[nodiscard]] bool isAliasing(const InputIterator &it) const noexcept;
 };
 
+/** @brief A vector is trivially relocatable if its base is */
+template<typename Base, typename Type, std::integral Range, bool IsSmallOptimized, typename GrowthPolicy>
+struct kF::Core::IsTriviallyRelocatable<kF::Core::Internal::VectorDetails<Base, Type, Range, IsSmallOptimized, GrowthPolicy>>
+    : public kF::Core::IsTriviallyRelocatable<Base>
+{};
+
 #include "VectorDetails.ipp"
\ No newline at end of file
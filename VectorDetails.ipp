@@ -3,13 +3,13 @@
  * @ Description: VectorDetails
  */
 
-template<typename Base, typename Type, std::integral Range, bool IsSmallOptimized>
+template<typename Base, typename Type, std::integral Range, bool IsSmallOptimized, typename GrowthPolicy>
 template<typename ...Args> requires std::constructible_from<Type, Args...>
-inline Type &kF::Core::Internal::VectorDetails<Base, Type, Range, IsSmallOptimized>::push(Args &&...args)
+inline Type &kF::Core::Internal::VectorDetails<Base, Type, Range, IsSmallOptimized, GrowthPolicy>::push(Args &&...args)
     noexcept(nothrow_constructible(Type, Args...) && nothrow_forward_constructible(Type) && nothrow_destructible(Type))
 {
     if (!data())
-        reserveUnsafe<false>(static_cast<Range>(2));
+        reserveUnsafe<false>(GrowthPolicy::template InitialCapacity<Type, Range>());
     else if (sizeUnsafe() == capacityUnsafe())
         grow();
     const Range currentSize = sizeUnsafe();
@@ -19,8 +19,41 @@ inline Type &kF::Core::Internal::VectorDetails<Base, Type, Range, IsSmallOptimiz
     return *elem;
 }
 
-template<typename Base, typename Type, std::integral Range, bool IsSmallOptimized>
-inline void kF::Core::Internal::VectorDetails<Base, Type, Range, IsSmallOptimized>::pop(void) noexcept_destructible(Type)
+template<typename Base, typename Type, std::integral Range, bool IsSmallOptimized, typename GrowthPolicy>
+template<typename Generator>
+    requires std::invocable<Generator &, Range> && std::constructible_from<Type, std::invoke_result_t<Generator &, Range>>
+inline typename kF::Core::Internal::VectorDetails<Base, Type, Range, IsSmallOptimized, GrowthPolicy>::Iterator
+    kF::Core::Internal::VectorDetails<Base, Type, Range, IsSmallOptimized, GrowthPolicy>::pushN(const Range count, Generator &&generator)
+    noexcept(nothrow_invocable(Generator &, Range) && nothrow_constructible(Type, std::invoke_result_t<Generator &, Range>)
+        && nothrow_forward_constructible(Type) && nothrow_destructible(Type))
+{
+    if (!count) [[unlikely]]
+        return end();
+    return insertImpl(end(), count, [count, &generator](const Iterator output) {
+        for (Range i = 0; i < count; ++i)
+            new (output + i) Type(std::invoke(generator, i));
+    });
+}
+
+template<typename Base, typename Type, std::integral Range, bool IsSmallOptimized, typename GrowthPolicy>
+template<std::input_iterator InputIterator>
+    requires std::constructible_from<Type, std::iter_reference_t<InputIterator>>
+inline typename kF::Core::Internal::VectorDetails<Base, Type, Range, IsSmallOptimized, GrowthPolicy>::Iterator
+    kF::Core::Internal::VectorDetails<Base, Type, Range, IsSmallOptimized, GrowthPolicy>::emplaceRange(InputIterator from, InputIterator to)
+    noexcept(nothrow_constructible(Type, std::iter_reference_t<InputIterator>) && nothrow_forward_constructible(Type) && nothrow_destructible(Type))
+{
+    const Range count = static_cast<Range>(std::distance(from, to));
+
+    if (!count) [[unlikely]]
+        return end();
+    return insertImpl(end(), count, [from, to](Iterator output) mutable {
+        for (; from != to; ++from, ++output)
+            new (output) Type(*from);
+    });
+}
+
+template<typename Base, typename Type, std::integral Range, bool IsSmallOptimized, typename GrowthPolicy>
+inline void kF::Core::Internal::VectorDetails<Base, Type, Range, IsSmallOptimized, GrowthPolicy>::pop(void) noexcept_destructible(Type)
 {
     const auto desiredSize = sizeUnsafe() - 1;
 
@@ -28,233 +61,219 @@ inline void kF::Core::Internal::VectorDetails<Base, Type, Range, IsSmallOptimize
     setSize(desiredSize);
 }
 
-template<typename Base, typename Type, std::integral Range, bool IsSmallOptimized>
-inline typename kF::Core::Internal::VectorDetails<Base, Type, Range, IsSmallOptimized>::Iterator
-    kF::Core::Internal::VectorDetails<Base, Type, Range, IsSmallOptimized>::insertDefault(Iterator pos, const Range count)
+template<typename Base, typename Type, std::integral Range, bool IsSmallOptimized, typename GrowthPolicy>
+inline typename kF::Core::Internal::VectorDetails<Base, Type, Range, IsSmallOptimized, GrowthPolicy>::Iterator
+    kF::Core::Internal::VectorDetails<Base, Type, Range, IsSmallOptimized, GrowthPolicy>::insertDefault(Iterator pos, const Range count)
     noexcept(nothrow_default_constructible(Type) && nothrow_forward_constructible(Type) && nothrow_destructible(Type))
 {
     if (!count) [[unlikely]]
         return end();
-    else if (pos == nullptr) [[unlikely]] {
-        resize(count);
-        return beginUnsafe();
-    }
-    const auto currentData = dataUnsafe();
-    const auto currentSize = sizeUnsafe();
-    auto currentBegin = beginUnsafe();
-    auto currentEnd = endUnsafe();
-    Range position = pos - currentBegin;
-    if (const auto currentCapacity = capacityUnsafe(), total = currentSize + count; total > currentCapacity) [[unlikely]] {
-        const auto desiredCapacity = currentCapacity + std::max(currentCapacity, count);
-        const auto tmpData = allocate(desiredCapacity);
-        setData(tmpData);
-        setSize(total);
-        setCapacity(desiredCapacity);
-        if constexpr (IsSmallOptimized) {
-            if (tmpData == currentData) {
-                if (const auto after = currentSize - position; after > count) {
-                    std::uninitialized_move(currentEnd - count, currentEnd, currentEnd);
-                    std::move_backward(currentBegin + position, currentEnd - count, currentEnd);
-                } else
-                    std::uninitialized_move(currentBegin + position, currentEnd, currentEnd + count - after);
-                std::uninitialized_default_construct_n(tmpData + position, count);
-                return tmpData + position;
-            }
-        }
-        std::uninitialized_move_n(currentBegin, position, tmpData);
-        std::uninitialized_move(currentBegin + position, currentEnd, tmpData + position + count);
-        std::uninitialized_default_construct_n(tmpData + position, count);
-        deallocate(currentData, currentCapacity);
-        return tmpData + position;
-    } else if (const auto after = currentSize - position; after > count) {
-        std::uninitialized_move(currentEnd - count, currentEnd, currentEnd);
-        std::move_backward(currentBegin + position, currentEnd - count, currentEnd);
-    } else
-        std::uninitialized_move(currentBegin + position, currentEnd, currentEnd + count - after);
-    std::uninitialized_default_construct_n(currentBegin + position, count);
-    setSize(currentSize + count);
-    return currentBegin + position;
+    return insertImpl(pos, count, [count](const Iterator output) {
+        std::uninitialized_value_construct_n(output, count);
+    });
 }
 
-template<typename Base, typename Type, std::integral Range, bool IsSmallOptimized>
-inline typename kF::Core::Internal::VectorDetails<Base, Type, Range, IsSmallOptimized>::Iterator
-    kF::Core::Internal::VectorDetails<Base, Type, Range, IsSmallOptimized>::insertCopy(
+template<typename Base, typename Type, std::integral Range, bool IsSmallOptimized, typename GrowthPolicy>
+inline typename kF::Core::Internal::VectorDetails<Base, Type, Range, IsSmallOptimized, GrowthPolicy>::Iterator
+    kF::Core::Internal::VectorDetails<Base, Type, Range, IsSmallOptimized, GrowthPolicy>::insertCopy(
         Iterator pos, const Range count, const Type &value)
     noexcept(nothrow_copy_constructible(Type) && nothrow_forward_constructible(Type) && nothrow_destructible(Type))
 {
     if (!count) [[unlikely]]
         return end();
-    else if (pos == nullptr) [[unlikely]] {
-        resize(count, value);
-        return beginUnsafe();
-    }
-    const auto currentData = dataUnsafe();
-    const auto currentSize = sizeUnsafe();
-    auto currentBegin = beginUnsafe();
-    auto currentEnd = endUnsafe();
-    Range position = pos - currentBegin;
-    if (const auto currentCapacity = capacityUnsafe(), total = currentSize + count; total > currentCapacity) [[unlikely]] {
-        const auto desiredCapacity = currentCapacity + std::max(currentCapacity, count);
-        const auto tmpData = allocate(desiredCapacity);
-        setData(tmpData);
-        setSize(total);
-        setCapacity(desiredCapacity);
-        if constexpr (IsSmallOptimized) {
-            if (tmpData == currentData) {
-                if (const auto after = currentSize - position; after > count) {
-                    std::uninitialized_move(currentEnd - count, currentEnd, currentEnd);
-                    std::move_backward(currentBegin + position, currentEnd - count, currentEnd);
-                } else
-                    std::uninitialized_move(currentBegin + position, currentEnd, currentEnd + count - after);
-                std::fill_n(tmpData + position, count, value);
-                return tmpData + position;
-            }
-        }
-        std::uninitialized_move_n(currentBegin, position, tmpData);
-        std::uninitialized_move(currentBegin + position, currentEnd, tmpData + position + count);
-        std::fill_n(tmpData + position, count, value);
-        deallocate(currentData, currentCapacity);
-        return tmpData + position;
-    } else if (const auto after = currentSize - position; after > count) {
-        std::uninitialized_move(currentEnd - count, currentEnd, currentEnd);
-        std::move_backward(currentBegin + position, currentEnd - count, currentEnd);
-    } else
-        std::uninitialized_move(currentBegin + position, currentEnd, currentEnd + count - after);
-    std::fill_n(currentBegin + position, count, value);
-    setSize(currentSize + count);
-    return currentBegin + position;
+    return insertImpl(pos, count, [count, &value](const Iterator output) {
+        std::uninitialized_fill_n(output, count, value);
+    }, isAliasing(&value));
 }
 
-template<typename Base, typename Type, std::integral Range, bool IsSmallOptimized>
+template<typename Base, typename Type, std::integral Range, bool IsSmallOptimized, typename GrowthPolicy>
 template<std::input_iterator InputIterator>
-inline typename kF::Core::Internal::VectorDetails<Base, Type, Range, IsSmallOptimized>::Iterator
-    kF::Core::Internal::VectorDetails<Base, Type, Range, IsSmallOptimized>::insert(
+inline typename kF::Core::Internal::VectorDetails<Base, Type, Range, IsSmallOptimized, GrowthPolicy>::Iterator
+    kF::Core::Internal::VectorDetails<Base, Type, Range, IsSmallOptimized, GrowthPolicy>::insert(
         Iterator pos, InputIterator from, InputIterator to)
     noexcept(nothrow_forward_iterator_constructible(InputIterator) && nothrow_forward_constructible(Type) && nothrow_destructible(Type))
 {
-    const Range count = std::distance(from, to);
-    Range position;
+    const Range count = static_cast<Range>(std::distance(from, to));
 
     if (!count) [[unlikely]]
         return end();
-    else if (pos == Iterator()) [[unlikely]] {
-        reserve(count);
-        position = 0;
-    } else [[likely]]
-        position = pos - beginUnsafe();
-    const auto currentData = dataUnsafe();
-    const auto currentSize = sizeUnsafe();
-    auto currentBegin = beginUnsafe();
-    auto currentEnd = endUnsafe();
-    if (const auto currentCapacity = capacityUnsafe(), total = currentSize + count; total > currentCapacity) [[unlikely]] {
-        const auto desiredCapacity = currentCapacity + std::max(currentCapacity, count);
-        const auto tmpData = allocate(desiredCapacity);
-        setData(tmpData);
-        setSize(total);
-        setCapacity(desiredCapacity);
-        if constexpr (IsSmallOptimized) {
-            if (tmpData == currentData) {
-                if (const auto after = currentSize - position; after > count) {
-                    std::uninitialized_move(currentEnd - count, currentEnd, currentEnd);
-                    std::move_backward(currentBegin + position, currentEnd - count, currentEnd);
-                } else
-                    std::uninitialized_move(currentBegin + position, currentEnd, currentEnd + count - after);
-                std::copy(from, to, tmpData + position);
-                return tmpData + position;
-            }
-        }
-        std::uninitialized_move_n(currentBegin, position, tmpData);
-        std::uninitialized_move(currentBegin + position, currentEnd, tmpData + position + count);
-        std::copy(from, to, tmpData + position);
-        deallocate(currentData, currentCapacity);
-        return tmpData + position;
-    } else if (const auto after = currentSize - position; after > count) {
-        std::uninitialized_move(currentEnd - count, currentEnd, currentEnd);
-        std::move_backward(currentBegin + position, currentEnd - count, currentEnd);
-    } else
-        std::uninitialized_move(currentBegin + position, currentEnd, currentEnd + count - after);
-    std::copy(from, to, currentBegin + position);
-    setSize(currentSize + count);
-    return currentBegin + position;
+    return insertImpl(pos, count, [from, to](const Iterator output) {
+        std::uninitialized_copy(from, to, output);
+    }, isAliasing(from));
 }
 
-template<typename Base, typename Type, std::integral Range, bool IsSmallOptimized>
+template<typename Base, typename Type, std::integral Range, bool IsSmallOptimized, typename GrowthPolicy>
 template<std::input_iterator InputIterator, typename Map>
-inline typename kF::Core::Internal::VectorDetails<Base, Type, Range, IsSmallOptimized>::Iterator
-    kF::Core::Internal::VectorDetails<Base, Type, Range, IsSmallOptimized>::insert(
+inline typename kF::Core::Internal::VectorDetails<Base, Type, Range, IsSmallOptimized, GrowthPolicy>::Iterator
+    kF::Core::Internal::VectorDetails<Base, Type, Range, IsSmallOptimized, GrowthPolicy>::insert(
         Iterator pos, InputIterator from, InputIterator to, Map &&map)
 {
-    constexpr auto MapCopy = [](InputIterator from, InputIterator to, auto &&map, Iterator begin) {
+    const Range count = static_cast<Range>(std::distance(from, to));
+
+    if (!count) [[unlikely]]
+        return end();
+    return insertImpl(pos, count, [from, to, &map](Iterator output) mutable {
         while (from != to) {
             if constexpr (Utils::IsMoveIterator<InputIterator>::Value)
-                new (begin) Type(map(std::move(*from)));
+                new (output) Type(map(std::move(*from)));
             else
-                new (begin) Type(map(*from));
+                new (output) Type(map(*from));
             ++from;
-            ++begin;
+            ++output;
         }
-    };
+    }, isAliasing(from));
+}
 
-    const Range count = std::distance(from, to);
+template<typename Base, typename Type, std::integral Range, bool IsSmallOptimized, typename GrowthPolicy>
+template<typename Construct>
+inline typename kF::Core::Internal::VectorDetails<Base, Type, Range, IsSmallOptimized, GrowthPolicy>::Iterator
+    kF::Core::Internal::VectorDetails<Base, Type, Range, IsSmallOptimized, GrowthPolicy>::insertImpl(
+        const Iterator pos, const Range count, Construct &&construct, const bool aliasing)
+{
     Range position;
 
-    if (!count) [[unlikely]]
-        return end();
-    else if (pos == Iterator()) [[unlikely]] {
+    if (pos == Iterator()) [[unlikely]] {
         reserve(count);
         position = 0;
     } else [[likely]]
-        position = pos - beginUnsafe();
+        position = static_cast<Range>(pos - beginUnsafe());
     const auto currentData = dataUnsafe();
     const auto currentSize = sizeUnsafe();
-    auto currentBegin = beginUnsafe();
-    auto currentEnd = endUnsafe();
-    if (const auto currentCapacity = capacityUnsafe(), total = currentSize + count; total > currentCapacity) [[unlikely]] {
-        const auto desiredCapacity = currentCapacity + std::max(currentCapacity, count);
+    const auto total = static_cast<Range>(currentSize + count);
+    if (const auto currentCapacity = capacityUnsafe(); total > currentCapacity) [[unlikely]] {
+        const auto desiredCapacity = GrowthPolicy::template NextCapacity<Type, Range>(currentCapacity, count);
         const auto tmpData = allocate(desiredCapacity);
-        setData(tmpData);
-        setSize(total);
-        setCapacity(desiredCapacity);
         if constexpr (IsSmallOptimized) {
             if (tmpData == currentData) {
-                if (const auto after = currentSize - position; after > count) {
-                    std::uninitialized_move(currentEnd - count, currentEnd, currentEnd);
-                    std::move_backward(currentBegin + position, currentEnd - count, currentEnd);
-                } else
-                    std::uninitialized_move(currentBegin + position, currentEnd, currentEnd + count - after);
-                MapCopy(from, to, std::forward<Map>(map), tmpData + position);
+                setCapacity(desiredCapacity);
+                openRoom(position, count, construct, aliasing);
                 return tmpData + position;
             }
         }
-        std::uninitialized_move_n(currentBegin, position, tmpData);
-        std::uninitialized_move(currentBegin + position, currentEnd, tmpData + position + count);
-        MapCopy(from, to, std::forward<Map>(map), tmpData + position);
+        // New elements are constructed first as their source may live in the old buffer
+        construct(tmpData + position);
+        Utils::RelocateForward(currentData, currentData + position, tmpData);
+        Utils::RelocateForward(currentData + position, currentData + currentSize, tmpData + position + count);
+        setData(tmpData);
+        setSize(total);
+        setCapacity(desiredCapacity);
         deallocate(currentData, currentCapacity);
         return tmpData + position;
-    } else if (const auto after = currentSize - position; after > count) {
-        std::uninitialized_move(currentEnd - count, currentEnd, currentEnd);
-        std::move_backward(currentBegin + position, currentEnd - count, currentEnd);
+    }
+    openRoom(position, count, construct, aliasing);
+    return currentData + position;
+}
+
+template<typename Base, typename Type, std::integral Range, bool IsSmallOptimized, typename GrowthPolicy>
+template<typename Construct>
+inline void kF::Core::Internal::VectorDetails<Base, Type, Range, IsSmallOptimized, GrowthPolicy>::openRoom(
+        const Range position, const Range count, Construct &&construct, const bool aliasing)
+{
+    const auto currentData = dataUnsafe();
+    const auto currentSize = sizeUnsafe();
+    const auto total = static_cast<Range>(currentSize + count);
+
+    if (!aliasing) [[likely]] {
+        Utils::RelocateBackward(currentData + position, currentData + currentSize, currentData + total);
+        construct(currentData + position);
+    } else {
+        // New elements are built aside as relocating the tail would move their source
+        std::unique_ptr<Type, decltype(&Utils::AlignedFree)> tmpData(
+            Utils::AlignedAlloc<alignof(Type), Type>(sizeof(Type) * count), &Utils::AlignedFree);
+        kFAssert(tmpData,
+            throw std::runtime_error("Core::Vector::insert: Malloc failed"));
+        construct(tmpData.get());
+        Utils::RelocateBackward(currentData + position, currentData + currentSize, currentData + total);
+        Utils::RelocateForward(tmpData.get(), tmpData.get() + count, currentData + position);
+    }
+    setSize(total);
+}
+
+template<typename Base, typename Type, std::integral Range, bool IsSmallOptimized, typename GrowthPolicy>
+template<typename InputIterator>
+inline bool kF::Core::Internal::VectorDetails<Base, Type, Range, IsSmallOptimized, GrowthPolicy>::isAliasing(const InputIterator &it) const noexcept
+{
+    if constexpr (Utils::IsMoveIterator<InputIterator>::Value) {
+        return isAliasing(it.base());
+    } else if constexpr (std::contiguous_iterator<InputIterator> && std::same_as<std::iter_value_t<InputIterator>, Type>) {
+        if (!data()) [[unlikely]]
+            return false;
+        const auto address = std::to_address(it);
+        return !std::less<>{}(address, dataUnsafe()) && std::less<>{}(address, dataUnsafe() + sizeUnsafe());
     } else
-        std::uninitialized_move(currentBegin + position, currentEnd, currentEnd + count - after);
-    MapCopy(from, to, std::forward<Map>(map), currentBegin + position);
-    setSize(currentSize + count);
-    return currentBegin + position;
+        return false;
 }
 
-template<typename Base, typename Type, std::integral Range, bool IsSmallOptimized>
-inline void kF::Core::Internal::VectorDetails<Base, Type, Range, IsSmallOptimized>::erase(Iterator from, Iterator to)
+template<typename Base, typename Type, std::integral Range, bool IsSmallOptimized, typename GrowthPolicy>
+inline void kF::Core::Internal::VectorDetails<Base, Type, Range, IsSmallOptimized, GrowthPolicy>::erase(Iterator from, Iterator to)
     noexcept(nothrow_forward_constructible(Type) && nothrow_destructible(Type))
 {
     if (from == to) [[unlikely]]
         return;
     const auto end = endUnsafe();
-    setSize(sizeUnsafe() - std::distance(from, to));
+    setSize(static_cast<Range>(sizeUnsafe() - std::distance(from, to)));
     std::destroy(from, to);
-    std::uninitialized_move(to, end, from);
+    Utils::RelocateForward(to, end, from);
+}
+
+template<typename Base, typename Type, std::integral Range, bool IsSmallOptimized, typename GrowthPolicy>
+inline void kF::Core::Internal::VectorDetails<Base, Type, Range, IsSmallOptimized, GrowthPolicy>::eraseUnordered(Iterator pos)
+    noexcept(nothrow_forward_constructible(Type) && nothrow_destructible(Type))
+{
+    const auto last = endUnsafe() - 1;
+
+    setSize(static_cast<Range>(sizeUnsafe() - 1));
+    std::destroy_at(pos);
+    if (pos != last) [[likely]]
+        Utils::RelocateForward(last, last + 1, pos);
+}
+
+template<typename Base, typename Type, std::integral Range, bool IsSmallOptimized, typename GrowthPolicy>
+template<typename Predicate>
+    requires std::predicate<Predicate &, Type &>
+inline Range kF::Core::Internal::VectorDetails<Base, Type, Range, IsSmallOptimized, GrowthPolicy>::eraseIf(Predicate &&predicate)
+    noexcept(nothrow_invocable(Predicate &, Type &) && nothrow_move_assignable(Type) && nothrow_destructible(Type))
+{
+    if (!data()) [[unlikely]]
+        return Range();
+    const auto end = endUnsafe();
+    const auto last = std::remove_if(beginUnsafe(), end, predicate);
+    const auto count = static_cast<Range>(end - last);
+
+    std::destroy(last, end);
+    setSize(static_cast<Range>(sizeUnsafe() - count));
+    return count;
 }
 
-template<typename Base, typename Type, std::integral Range, bool IsSmallOptimized>
-inline void kF::Core::Internal::VectorDetails<Base, Type, Range, IsSmallOptimized>::resize(const Range count)
+template<typename Base, typename Type, std::integral Range, bool IsSmallOptimized, typename GrowthPolicy>
+template<typename Predicate>
+    requires std::predicate<Predicate &, Type &>
+inline Range kF::Core::Internal::VectorDetails<Base, Type, Range, IsSmallOptimized, GrowthPolicy>::eraseUnorderedIf(Predicate &&predicate)
+    noexcept(nothrow_invocable(Predicate &, Type &) && nothrow_forward_constructible(Type) && nothrow_destructible(Type))
+{
+    if (!data()) [[unlikely]]
+        return Range();
+    const auto end = endUnsafe();
+    auto it = beginUnsafe();
+    auto last = end;
+
+    // Each element is tested once: a hole is filled with the last untested element which is tested next
+    while (it != last) {
+        if (!std::invoke(predicate, *it)) [[likely]] {
+            ++it;
+            continue;
+        }
+        std::destroy_at(it);
+        if (it != --last)
+            Utils::RelocateForward(last, last + 1, it);
+    }
+    const auto count = static_cast<Range>(end - last);
+    setSize(static_cast<Range>(sizeUnsafe() - count));
+    return count;
+}
+
+template<typename Base, typename Type, std::integral Range, bool IsSmallOptimized, typename GrowthPolicy>
+inline void kF::Core::Internal::VectorDetails<Base, Type, Range, IsSmallOptimized, GrowthPolicy>::resize(const Range count)
     noexcept(nothrow_default_constructible(Type) && nothrow_destructible(Type))
     requires std::constructible_from<Type>
 {
@@ -271,8 +290,8 @@ inline void kF::Core::Internal::VectorDetails<Base, Type, Range, IsSmallOptimize
     std::uninitialized_value_construct_n(dataUnsafe(), count);
 }
 
-template<typename Base, typename Type, std::integral Range, bool IsSmallOptimized>
-inline void kF::Core::Internal::VectorDetails<Base, Type, Range, IsSmallOptimized>::resize(const Range count, const Type &value)
+template<typename Base, typename Type, std::integral Range, bool IsSmallOptimized, typename GrowthPolicy>
+inline void kF::Core::Internal::VectorDetails<Base, Type, Range, IsSmallOptimized, GrowthPolicy>::resize(const Range count, const Type &value)
     noexcept(nothrow_copy_constructible(Type) && nothrow_forward_constructible(Type) && nothrow_destructible(Type))
     requires std::copy_constructible<Type>
 {
@@ -289,9 +308,50 @@ inline void kF::Core::Internal::VectorDetails<Base, Type, Range, IsSmallOptimize
     std::uninitialized_fill_n(dataUnsafe(), count, value);
 }
 
-template<typename Base, typename Type, std::integral Range, bool IsSmallOptimized>
+template<typename Base, typename Type, std::integral Range, bool IsSmallOptimized, typename GrowthPolicy>
+inline void kF::Core::Internal::VectorDetails<Base, Type, Range, IsSmallOptimized, GrowthPolicy>::resizeParallel(const Range count, const std::size_t threadCount)
+    noexcept_destructible(Type)
+    requires std::constructible_from<Type>
+{
+    if (!count) [[unlikely]] {
+        clearParallel(threadCount);
+        return;
+    } else if (!data()) [[likely]]
+        reserveUnsafe<false>(count);
+    else {
+        clearParallel(threadCount);
+        reserveUnsafe<true>(count);
+    }
+    setSize(count);
+    Utils::ParallelChunks(dataUnsafe(), dataUnsafe() + count, threadCount, [](Type * const from, Type * const to) noexcept {
+        std::uninitialized_value_construct(from, to);
+    });
+}
+
+template<typename Base, typename Type, std::integral Range, bool IsSmallOptimized, typename GrowthPolicy>
+inline void kF::Core::Internal::VectorDetails<Base, Type, Range, IsSmallOptimized, GrowthPolicy>::resizeParallel(
+        const Range count, const std::size_t threadCount, const Type &value)
+    noexcept_destructible(Type)
+    requires std::copy_constructible<Type>
+{
+    if (!count) [[unlikely]] {
+        clearParallel(threadCount);
+        return;
+    } else if (!data()) [[likely]]
+        reserveUnsafe<false>(count);
+    else {
+        clearParallel(threadCount);
+        reserveUnsafe<true>(count);
+    }
+    setSize(count);
+    Utils::ParallelChunks(dataUnsafe(), dataUnsafe() + count, threadCount, [&value](Type * const from, Type * const to) noexcept {
+        std::uninitialized_fill(from, to, value);
+    });
+}
+
+template<typename Base, typename Type, std::integral Range, bool IsSmallOptimized, typename GrowthPolicy>
 template<std::input_iterator InputIterator>
-inline void kF::Core::Internal::VectorDetails<Base, Type, Range, IsSmallOptimized>::resize(InputIterator from, InputIterator to)
+inline void kF::Core::Internal::VectorDetails<Base, Type, Range, IsSmallOptimized, GrowthPolicy>::resize(InputIterator from, InputIterator to)
     noexcept(nothrow_forward_iterator_constructible(InputIterator) && nothrow_forward_constructible(Type) && nothrow_destructible(Type))
 {
     const Range count = std::distance(from, to);
@@ -309,9 +369,9 @@ inline void kF::Core::Internal::VectorDetails<Base, Type, Range, IsSmallOptimize
     std::uninitialized_copy(from, to, beginUnsafe());
 }
 
-template<typename Base, typename Type, std::integral Range, bool IsSmallOptimized>
+template<typename Base, typename Type, std::integral Range, bool IsSmallOptimized, typename GrowthPolicy>
 template<std::input_iterator InputIterator, typename Map>
-inline void kF::Core::Internal::VectorDetails<Base, Type, Range, IsSmallOptimized>::resize(InputIterator from, InputIterator to, Map &&map)
+inline void kF::Core::Internal::VectorDetails<Base, Type, Range, IsSmallOptimized, GrowthPolicy>::resize(InputIterator from, InputIterator to, Map &&map)
 {
     const Range count = std::distance(from, to);
 
@@ -336,29 +396,77 @@ inline void kF::Core::Internal::VectorDetails<Base, Type, Range, IsSmallOptimize
     }
 }
 
-template<typename Base, typename Type, std::integral Range, bool IsSmallOptimized>
-inline void kF::Core::Internal::VectorDetails<Base, Type, Range, IsSmallOptimized>::clear(void) noexcept_destructible(Type)
+template<typename Base, typename Type, std::integral Range, bool IsSmallOptimized, typename GrowthPolicy>
+inline void kF::Core::Internal::VectorDetails<Base, Type, Range, IsSmallOptimized, GrowthPolicy>::resizeUninitialized(const Range count) noexcept
+    requires std::is_trivially_default_constructible_v<Type> && std::is_trivially_destructible_v<Type>
+{
+    if (capacity() < count)
+        reserve(count);
+    if (data()) [[likely]]
+        setSize(count);
+}
+
+template<typename Base, typename Type, std::integral Range, bool IsSmallOptimized, typename GrowthPolicy>
+inline typename kF::Core::Internal::VectorDetails<Base, Type, Range, IsSmallOptimized, GrowthPolicy>::Iterator
+    kF::Core::Internal::VectorDetails<Base, Type, Range, IsSmallOptimized, GrowthPolicy>::appendUninitialized(const Range count) noexcept
+    requires std::is_trivially_default_constructible_v<Type> && std::is_trivially_destructible_v<Type>
+{
+    if (!count) [[unlikely]]
+        return end();
+    return insertImpl(end(), count, [](const Iterator) {});
+}
+
+template<typename Base, typename Type, std::integral Range, bool IsSmallOptimized, typename GrowthPolicy>
+template<typename Operation>
+    requires std::is_invocable_r_v<Range, Operation, Type *, Range>
+inline void kF::Core::Internal::VectorDetails<Base, Type, Range, IsSmallOptimized, GrowthPolicy>::resizeAndOverwrite(const Range count, Operation &&operation)
+    noexcept(nothrow_ndebug && nothrow_invocable(Operation, Type *, Range))
+    requires std::is_trivially_default_constructible_v<Type> && std::is_trivially_destructible_v<Type>
+{
+    resizeUninitialized(count);
+    const Range size = std::invoke(std::forward<Operation>(operation), data(), count);
+    kFAssert(size <= count,
+        throw std::length_error("Core::Vector::resizeAndOverwrite: Operation returned a size greater than count"));
+    if (data()) [[likely]]
+        setSize(size);
+}
+
+template<typename Base, typename Type, std::integral Range, bool IsSmallOptimized, typename GrowthPolicy>
+inline void kF::Core::Internal::VectorDetails<Base, Type, Range, IsSmallOptimized, GrowthPolicy>::clear(void) noexcept_destructible(Type)
 {
     if (data()) [[likely]]
         clearUnsafe();
 }
 
-template<typename Base, typename Type, std::integral Range, bool IsSmallOptimized>
-inline void kF::Core::Internal::VectorDetails<Base, Type, Range, IsSmallOptimized>::clearUnsafe(void) noexcept_destructible(Type)
+template<typename Base, typename Type, std::integral Range, bool IsSmallOptimized, typename GrowthPolicy>
+inline void kF::Core::Internal::VectorDetails<Base, Type, Range, IsSmallOptimized, GrowthPolicy>::clearUnsafe(void) noexcept_destructible(Type)
 {
     std::destroy_n(dataUnsafe(), sizeUnsafe());
     setSize(0);
 }
 
-template<typename Base, typename Type, std::integral Range, bool IsSmallOptimized>
-inline void kF::Core::Internal::VectorDetails<Base, Type, Range, IsSmallOptimized>::release(void) noexcept_destructible(Type)
+template<typename Base, typename Type, std::integral Range, bool IsSmallOptimized, typename GrowthPolicy>
+inline void kF::Core::Internal::VectorDetails<Base, Type, Range, IsSmallOptimized, GrowthPolicy>::clearParallel(const std::size_t threadCount) noexcept_destructible(Type)
+{
+    if (!data()) [[unlikely]]
+        return;
+    if constexpr (!std::is_trivially_destructible_v<Type>) {
+        Utils::ParallelChunks(dataUnsafe(), dataUnsafe() + sizeUnsafe(), threadCount, [](Type * const from, Type * const to) noexcept {
+            std::destroy(from, to);
+        });
+    }
+    setSize(0);
+}
+
+template<typename Base, typename Type, std::integral Range, bool IsSmallOptimized, typename GrowthPolicy>
+inline void kF::Core::Internal::VectorDetails<Base, Type, Range, IsSmallOptimized, GrowthPolicy>::release(void) noexcept_destructible(Type)
 {
     if (data()) [[likely]]
         releaseUnsafe();
 }
 
-template<typename Base, typename Type, std::integral Range, bool IsSmallOptimized>
-inline void kF::Core::Internal::VectorDetails<Base, Type, Range, IsSmallOptimized>::releaseUnsafe(void) noexcept_destructible(Type)
+template<typename Base, typename Type, std::integral Range, bool IsSmallOptimized, typename GrowthPolicy>
+inline void kF::Core::Internal::VectorDetails<Base, Type, Range, IsSmallOptimized, GrowthPolicy>::releaseUnsafe(void) noexcept_destructible(Type)
 {
     const auto currentData = dataUnsafe();
     const auto currentCapacity = capacityUnsafe();
@@ -369,8 +477,15 @@ inline void kF::Core::Internal::VectorDetails<Base, Type, Range, IsSmallOptimize
     deallocate(currentData, currentCapacity);
 }
 
-template<typename Base, typename Type, std::integral Range, bool IsSmallOptimized>
-inline bool kF::Core::Internal::VectorDetails<Base, Type, Range, IsSmallOptimized>::reserve(const Range capacity)
+template<typename Base, typename Type, std::integral Range, bool IsSmallOptimized, typename GrowthPolicy>
+inline void kF::Core::Internal::VectorDetails<Base, Type, Range, IsSmallOptimized, GrowthPolicy>::releaseParallel(const std::size_t threadCount) noexcept_destructible(Type)
+{
+    clearParallel(threadCount);
+    release();
+}
+
+template<typename Base, typename Type, std::integral Range, bool IsSmallOptimized, typename GrowthPolicy>
+inline bool kF::Core::Internal::VectorDetails<Base, Type, Range, IsSmallOptimized, GrowthPolicy>::reserve(const Range capacity)
     noexcept(nothrow_forward_constructible(Type) && nothrow_destructible(Type))
 {
     if (data())
@@ -379,29 +494,35 @@ inline bool kF::Core::Internal::VectorDetails<Base, Type, Range, IsSmallOptimize
         return reserveUnsafe<false>(capacity);
 }
 
-template<typename Base, typename Type, std::integral Range, bool IsSmallOptimized>
+template<typename Base, typename Type, std::integral Range, bool IsSmallOptimized, typename GrowthPolicy>
+inline bool kF::Core::Internal::VectorDetails<Base, Type, Range, IsSmallOptimized, GrowthPolicy>::shrinkTo(const Range capacity)
+    noexcept(nothrow_forward_constructible(Type) && nothrow_destructible(Type))
+{
+    if (!data()) [[unlikely]]
+        return false;
+    const auto currentSize = sizeUnsafe();
+    const auto currentCapacity = capacityUnsafe();
+    const auto desiredCapacity = std::max(capacity, currentSize);
+
+    if (desiredCapacity >= currentCapacity) [[unlikely]]
+        return false;
+    else if (!desiredCapacity) {
+        releaseUnsafe();
+        return this->capacity() < currentCapacity;
+    }
+    return relocateBuffer(currentCapacity, desiredCapacity);
+}
+
+template<typename Base, typename Type, std::integral Range, bool IsSmallOptimized, typename GrowthPolicy>
 template<bool IsSafe>
-inline bool kF::Core::Internal::VectorDetails<Base, Type, Range, IsSmallOptimized>::reserveUnsafe(const Range capacity)
+inline bool kF::Core::Internal::VectorDetails<Base, Type, Range, IsSmallOptimized, GrowthPolicy>::reserveUnsafe(const Range capacity)
     noexcept(nothrow_forward_constructible(Type) && nothrow_destructible(Type))
 {
     if constexpr (IsSafe) {
         const auto currentCapacity = capacityUnsafe();
         if (currentCapacity >= capacity) [[unlikely]]
             return false;
-        const auto currentSize = sizeUnsafe();
-        const auto currentData = dataUnsafe();
-        const auto tmpData = allocate(capacity);
-        setData(tmpData);
-        setSize(currentSize);
-        setCapacity(capacity);
-        if constexpr (IsSmallOptimized) {
-            if (tmpData == currentData)
-                return false;
-        }
-        std::uninitialized_move_n(currentData, currentSize, tmpData);
-        std::destroy_n(currentData, currentSize);
-        deallocate(currentData, currentCapacity);
-        return true;
+        return relocateBuffer(currentCapacity, capacity);
     } else {
         if (capacity == 0)
             return false;
@@ -412,30 +533,60 @@ inline bool kF::Core::Internal::VectorDetails<Base, Type, Range, IsSmallOptimize
     }
 }
 
-template<typename Base, typename Type, std::integral Range, bool IsSmallOptimized>
-inline void kF::Core::Internal::VectorDetails<Base, Type, Range, IsSmallOptimized>::grow(const Range minimum)
+template<typename Base, typename Type, std::integral Range, bool IsSmallOptimized, typename GrowthPolicy>
+inline void kF::Core::Internal::VectorDetails<Base, Type, Range, IsSmallOptimized, GrowthPolicy>::grow(const Range minimum)
     noexcept(nothrow_forward_constructible(Type) && nothrow_destructible(Type))
 {
-    const auto currentData = dataUnsafe();
-    const Range currentSize = sizeUnsafe();
     const Range currentCapacity = capacityUnsafe();
-    const Range desiredCapacity = static_cast<Range>(currentCapacity + static_cast<Range>(std::max(currentCapacity, minimum)));
-    const auto tmpData = allocate(desiredCapacity);
 
-    setData(tmpData);
-    setSize(currentSize);
-    setCapacity(desiredCapacity);
+    relocateBuffer(currentCapacity, GrowthPolicy::template NextCapacity<Type, Range>(currentCapacity, minimum));
+}
+
+template<typename Base, typename Type, std::integral Range, bool IsSmallOptimized, typename GrowthPolicy>
+inline bool kF::Core::Internal::VectorDetails<Base, Type, Range, IsSmallOptimized, GrowthPolicy>::relocateBuffer(const Range currentCapacity, const Range capacity)
+    noexcept(nothrow_forward_constructible(Type) && nothrow_destructible(Type))
+{
+    if (tryReallocate(currentCapacity, capacity))
+        return true;
+    const auto currentData = dataUnsafe();
+    const auto currentSize = sizeUnsafe();
+    const auto tmpData = allocate(capacity);
+
     if constexpr (IsSmallOptimized) {
-        if (tmpData == currentData)
-            return;
+        // Already in the cache, only a growth is recorded as shrinking would free nothing
+        if (tmpData == currentData) {
+            if (capacity > currentCapacity)
+                setCapacity(capacity);
+            return false;
+        }
     }
-    std::uninitialized_move_n(currentData, currentSize, tmpData);
-    std::destroy_n(currentData, currentSize);
+    // Elements are relocated before updating the base as it may share storage between its cache and its heap state
+    Utils::RelocateForward(currentData, currentData + currentSize, tmpData);
+    setData(tmpData);
+    setSize(currentSize);
+    setCapacity(capacity);
     deallocate(currentData, currentCapacity);
+    return true;
+}
+
+template<typename Base, typename Type, std::integral Range, bool IsSmallOptimized, typename GrowthPolicy>
+inline bool kF::Core::Internal::VectorDetails<Base, Type, Range, IsSmallOptimized, GrowthPolicy>::tryReallocate(const Range currentCapacity, const Range capacity) noexcept
+{
+    if constexpr (IsTriviallyRelocatable<Type>::Value && requires { this->reallocate(nullptr, Range(), Range()); }) {
+        const auto currentSize = sizeUnsafe();
+        const auto tmpData = this->reallocate(dataUnsafe(), currentCapacity, capacity);
+        if (!tmpData) [[unlikely]]
+            return false;
+        setData(tmpData);
+        setSize(currentSize);
+        setCapacity(capacity);
+        return true;
+    } else
+        return false;
 }
 
-template<typename Base, typename Type, std::integral Range, bool IsSmallOptimized>
-inline void kF::Core::Internal::VectorDetails<Base, Type, Range, IsSmallOptimized>::move(Range from, Range to, Range output) noexcept_ndebug
+template<typename Base, typename Type, std::integral Range, bool IsSmallOptimized, typename GrowthPolicy>
+inline void kF::Core::Internal::VectorDetails<Base, Type, Range, IsSmallOptimized, GrowthPolicy>::move(Range from, Range to, Range output) noexcept_ndebug
 {
     kFAssert(output < from || output > to,
         throw std::logic_error("VectorDetails::move: Invalid move range"));
@@ -451,8 +602,8 @@ inline void kF::Core::Internal::VectorDetails<Base, Type, Range, IsSmallOptimize
     std::rotate(it + from, it + to, it + output);
 }
 
-template<typename Base, typename Type, std::integral Range, bool IsSmallOptimized>
-inline bool kF::Core::Internal::VectorDetails<Base, Type, Range, IsSmallOptimized>::operator==(const VectorDetails &other) const noexcept
+template<typename Base, typename Type, std::integral Range, bool IsSmallOptimized, typename GrowthPolicy>
+inline bool kF::Core::Internal::VectorDetails<Base, Type, Range, IsSmallOptimized, GrowthPolicy>::operator==(const VectorDetails &other) const noexcept
     requires std::equality_comparable<Type>
 {
     const auto count = size();